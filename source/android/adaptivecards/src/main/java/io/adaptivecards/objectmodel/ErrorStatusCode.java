@@ -14,7 +14,9 @@ public enum ErrorStatusCode {
   RequiredPropertyMissing,
   InvalidPropertyValue,
   UnsupportedParserOverride,
-  IdCollision;
+  IdCollision,
+  FrozenObjectModification,
+  CloneNotSupported;
 
   public final int swigValue() {
     return swigValue;
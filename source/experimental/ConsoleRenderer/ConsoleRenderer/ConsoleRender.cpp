@@ -141,7 +141,7 @@ size_t RenderElement(std::shared_ptr<BaseCardElement> element,  size_t columnWid
     case CardElementType::TextBlock:
     {
         auto textBlock = std::dynamic_pointer_cast<TextBlock>(element);
-        auto textOut = ConvertToVector(textBlock->GetText(), columnWidth);
+        auto textOut = ConvertToVector(textBlock->GetTextRef(), columnWidth);
         //ApplyTextProperties(textBlock->GetTextWeight() == TextWeight::Bolder, textBlock->GetTextColor(), textOut);
         CompositeVector(consoleString, textOut, columnWidth, x, y);
         rowsRendered = textOut.size();
@@ -150,8 +150,8 @@ size_t RenderElement(std::shared_ptr<BaseCardElement> element,  size_t columnWid
     case CardElementType::Image:
     {
         auto imageElem = std::dynamic_pointer_cast<Image>(element);
-        std::string imageText = imageElem->GetAltText();
-        imageText.append(" <" + imageElem->GetUrl() + ">");
+        std::string imageText = imageElem->GetAltTextRef();
+        imageText.append(" <").append(imageElem->GetUrlRef()).append(">");
         auto textBlock = ConvertToVector(imageText, columnWidth);
         CompositeVector(consoleString, textBlock, columnWidth, x, y);
         rowsRendered = textBlock.size();
@@ -213,23 +213,30 @@ size_t RenderColumn(Column &column, size_t columnWidth, size_t x, size_t y, std:
     return columnY;
 }
 
-size_t RenderFact(Fact &set, size_t columnWidth, size_t x, size_t y, std::vector<std::string> &consoleString)
+size_t RenderTitleValue(const std::string &title, const std::string &value, size_t columnWidth, size_t x, size_t y, std::vector<std::string> &consoleString)
 {
     const size_t itemWidth = (columnWidth / 2) - 1;
-    auto titleBlock = ConvertToVector(set.GetTitle(), itemWidth);
-    auto valueBlock = ConvertToVector(set.GetValue(), itemWidth);
+    auto titleBlock = ConvertToVector(title, itemWidth);
+    auto valueBlock = ConvertToVector(value, itemWidth);
 
     CompositeVector(consoleString, titleBlock, itemWidth, x, y);
     CompositeVector(consoleString, valueBlock, itemWidth, x + itemWidth + 1, y);
     return std::max(titleBlock.size(), valueBlock.size());
 }
 
+size_t RenderFact(Fact &set, size_t columnWidth, size_t x, size_t y, std::vector<std::string> &consoleString)
+{
+    return RenderTitleValue(set.GetTitleRef(), set.GetValueRef(), columnWidth, x, y, consoleString);
+}
+
 size_t RenderFactSet(FactSet &set, size_t columnWidth, size_t x, size_t y, std::vector<std::string> &consoleString)
 {
     size_t cRows = 0;
-    for (auto fact : set.GetFacts())
+    // reads the facts as stored, without making Fact objects of them
+    for (size_t i = 0; i < set.GetFactCount(); i++)
     {
-        cRows += RenderFact(*fact, columnWidth, x, y+cRows, consoleString);
+        const auto fact = set.GetFactView(i);
+        cRows += RenderTitleValue(fact.GetTitle(), fact.GetValue(), columnWidth, x, y+cRows, consoleString);
     }
     return cRows;
 }
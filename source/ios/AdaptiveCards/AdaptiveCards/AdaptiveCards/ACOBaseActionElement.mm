@@ -77,7 +77,7 @@ using namespace AdaptiveCards;
 {
     if(_elem && _type == ACROpenUrl){
         std::shared_ptr<OpenUrlAction> openUrlAction = std::dynamic_pointer_cast<OpenUrlAction>(_elem);
-        return [NSString stringWithCString:openUrlAction->GetUrl().c_str() encoding:NSUTF8StringEncoding];
+        return [NSString stringWithCString:openUrlAction->GetUrlRef().c_str() encoding:NSUTF8StringEncoding];
     }
     return @"";
 }
@@ -42,7 +42,7 @@ using namespace AdaptiveCards;
         _allActionsHaveIcons = YES;
         _buttonPadding = 5;
         if(!_config->GetImageBaseUrl().empty()) {
-            NSString *tmpURLString = [NSString stringWithCString:_config->GetImageBaseUrl().c_str() encoding:NSUTF8StringEncoding];
+            NSString *tmpURLString = [NSString stringWithCString:_config->GetImageBaseUrlRef().c_str() encoding:NSUTF8StringEncoding];
             _baseURL = [NSURL URLWithString:tmpURLString];
         }
     }
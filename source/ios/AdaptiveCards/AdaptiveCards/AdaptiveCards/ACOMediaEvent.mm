@@ -19,8 +19,8 @@ static NSSet<NSString *> *validMediaTypes   = [[NSSet alloc] initWithObjects:@"a
 {
     self = [super init];
     if(self){
-        _url = [NSString stringWithCString:mediaSource->GetUrl().c_str() encoding:NSUTF8StringEncoding];
-        _mimeType = [NSString stringWithCString:mediaSource->GetMimeType().c_str() encoding:NSUTF8StringEncoding];
+        _url = [NSString stringWithCString:mediaSource->GetUrlRef().c_str() encoding:NSUTF8StringEncoding];
+        _mimeType = [NSString stringWithCString:mediaSource->GetMimeTypeRef().c_str() encoding:NSUTF8StringEncoding];
         _isValid = NO;
         if([_mimeType length]){
             // valid media type eg. video/mp4
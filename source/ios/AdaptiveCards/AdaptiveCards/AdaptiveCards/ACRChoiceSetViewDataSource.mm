@@ -68,7 +68,7 @@ const CGFloat accessoryViewWidth = 50.0f;
         _shouldWrap = choiceSet->GetWrap();
         _userSelections = [[NSMutableDictionary alloc] init];
         _currentSelectedIndexPath = nil;
-        NSString *defaultValues = [NSString stringWithCString:_choiceSetDataSource->GetValue().c_str()
+        NSString *defaultValues = [NSString stringWithCString:_choiceSetDataSource->GetValueRef().c_str()
                                                      encoding:NSUTF8StringEncoding];
         _defaultValuesArray = [defaultValues componentsSeparatedByCharactersInSet:
                                [NSCharacterSet characterSetWithCharactersInString:@","]];
@@ -77,15 +77,13 @@ const CGFloat accessoryViewWidth = 50.0f;
             _defaultValuesSet = [NSMutableSet setWithArray:_defaultValuesArray];
         }
 
-        NSUInteger index = 0;
-        for(const auto& choice : _choiceSetDataSource->GetChoices()) {
-            NSString *keyForDefaultValue = [NSString stringWithCString:choice->GetValue().c_str()
+        for(size_t index = 0; index < _choiceSetDataSource->GetChoiceCount(); ++index) {
+            NSString *keyForDefaultValue = [NSString stringWithCString:_choiceSetDataSource->GetChoiceView(index).GetValueData()
                                                               encoding:NSUTF8StringEncoding];
 
             if([_defaultValuesSet containsObject:keyForDefaultValue]){
                 _userSelections[[NSNumber numberWithInteger:index]] = [NSNumber numberWithBool:YES];
             }
-            ++index;
         }
     }
     return self;
@@ -95,7 +93,7 @@ const CGFloat accessoryViewWidth = 50.0f;
 // so the size is always 1 when there are more than one choices
 - (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section
 {
-    return (_choiceSetDataSource->GetChoices().size());
+    return (_choiceSetDataSource->GetChoiceCount());
 }
 
 - (NSInteger)numberOfSectionsInTableView:(UITableView *)tableView
@@ -121,7 +119,7 @@ const CGFloat accessoryViewWidth = 50.0f;
         }
     }
 
-    NSString *title = [NSString stringWithCString:_choiceSetDataSource->GetChoices()[indexPath.row]->GetTitle().c_str()
+    NSString *title = [NSString stringWithCString:_choiceSetDataSource->GetChoiceView(indexPath.row).GetTitleData()
                                encoding:NSUTF8StringEncoding];
     cell.textLabel.text = title;
     cell.textLabel.lineBreakMode = NSLineBreakByTruncatingTail;
@@ -221,7 +219,7 @@ const CGFloat accessoryViewWidth = 50.0f;
         if([_userSelections[key] boolValue] == YES)
         {
             [values addObject:
-             [NSString stringWithCString:_choiceSetDataSource->GetChoices()[[key integerValue]]->GetValue().c_str()
+             [NSString stringWithCString:_choiceSetDataSource->GetChoiceView([key integerValue]).GetValueData()
                                 encoding:NSUTF8StringEncoding]];
         }
     }
@@ -238,7 +236,7 @@ const CGFloat accessoryViewWidth = 50.0f;
         if([_userSelections[key] boolValue] == YES)
         {
             [values addObject:
-             [NSString stringWithCString:_choiceSetDataSource->GetChoices()[[key integerValue]]->GetTitle().c_str()
+             [NSString stringWithCString:_choiceSetDataSource->GetChoiceView([key integerValue]).GetTitleData()
                                 encoding:NSUTF8StringEncoding]];
         }
     }
@@ -51,13 +51,14 @@ static NSString *pickerCell = @"pickerCell";
         _titlesMap = [[NSMutableDictionary alloc] init];
         NSMutableDictionary *valuesMap = [[NSMutableDictionary alloc] init];
 
-        NSString *defaultValue = [NSString stringWithCString:_choiceSetInput->GetValue().c_str()
+        NSString *defaultValue = [NSString stringWithCString:_choiceSetInput->GetValueRef().c_str()
                                                      encoding:NSUTF8StringEncoding];
         NSMutableArray *mutableArrayStrings = [[NSMutableArray alloc] init];
         NSInteger index = 0;
-        for(auto choice : _choiceSetInput->GetChoices()){
-            NSString *title = [NSString stringWithCString:choice->GetTitle().c_str() encoding:NSUTF8StringEncoding];
-            NSString *value = [NSString stringWithCString:choice->GetValue().c_str() encoding:NSUTF8StringEncoding];
+        for(size_t i = 0; i < _choiceSetInput->GetChoiceCount(); ++i){
+            const auto choice = _choiceSetInput->GetChoiceView(i);
+            NSString *title = [NSString stringWithCString:choice.GetTitleData() encoding:NSUTF8StringEncoding];
+            NSString *value = [NSString stringWithCString:choice.GetValueData() encoding:NSUTF8StringEncoding];
             _titlesMap[title] = value;
             if(_userSelectedRow != 0 && [defaultValue isEqualToString:value]) {
                 _userSelectedRow = index;
@@ -83,7 +84,7 @@ static NSString *pickerCell = @"pickerCell";
 
 - (NSInteger)tableView:(UITableView *)tableView numberOfRowsInSection:(NSInteger)section
 {
-    return _choiceSetInput->GetChoices().size() > 0 ? 2 : 0;
+    return _choiceSetInput->GetChoiceCount() > 0 ? 2 : 0;
 }
 
 - (NSInteger)numberOfSectionsInTableView:(UITableView *)tableView
@@ -233,7 +234,7 @@ static NSString *pickerCell = @"pickerCell";
 
 - (NSInteger)pickerView:(UIPickerView *)pickerView numberOfRowsInComponent:(NSInteger)component
 {
-    return _choiceSetInput->GetChoices().size();
+    return _choiceSetInput->GetChoiceCount();
 }
 
 - (NSInteger)numberOfComponentsInPickerView:(UIPickerView *)pickerView
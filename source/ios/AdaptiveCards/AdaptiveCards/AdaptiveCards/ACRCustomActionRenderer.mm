@@ -37,7 +37,7 @@
 
     ACRRegistration *reg = [ACRRegistration getInstance];
     if(reg) {
-        NSString *type = [NSString stringWithCString:customAction->GetElementTypeString().c_str() encoding:NSUTF8StringEncoding];
+        NSString *type = [NSString stringWithCString:customAction->GetElementTypeStringRef().c_str() encoding:NSUTF8StringEncoding];
         NSObject<ACOIBaseActionElementParser> *parser = [reg getCustomActionElementParser:type];
 
         Json::Value blob = customAction->GetAdditionalProperties();
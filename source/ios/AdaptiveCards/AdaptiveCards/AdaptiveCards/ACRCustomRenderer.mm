@@ -37,7 +37,7 @@
 
     ACRRegistration *reg = [ACRRegistration getInstance];
     if(reg) {
-        NSString *type = [NSString stringWithCString:customElem->GetElementTypeString().c_str() encoding:NSUTF8StringEncoding];
+        NSString *type = [NSString stringWithCString:customElem->GetElementTypeStringRef().c_str() encoding:NSUTF8StringEncoding];
         Json::Value blob = customElem->GetAdditionalProperties();
         Json::FastWriter fastWriter;
         NSString *jsonString = [[NSString alloc] initWithCString:fastWriter.write(blob).c_str() encoding:NSUTF8StringEncoding];
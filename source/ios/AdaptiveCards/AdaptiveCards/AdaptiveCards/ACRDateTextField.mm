@@ -43,13 +43,13 @@ using namespace AdaptiveCards;
         {
             std::shared_ptr<DateInput> dateInput = std::dynamic_pointer_cast<DateInput>(elem);
 
-            valueStr = [NSString stringWithCString:dateInput->GetValue().c_str()
+            valueStr = [NSString stringWithCString:dateInput->GetValueRef().c_str()
                                                  encoding:NSUTF8StringEncoding];
-            placeHolderStr = [NSString stringWithCString:dateInput->GetPlaceholder().c_str()
+            placeHolderStr = [NSString stringWithCString:dateInput->GetPlaceholderRef().c_str()
                                                 encoding:NSUTF8StringEncoding];
-            minDateStr = [NSString stringWithCString:dateInput->GetMin().c_str()
+            minDateStr = [NSString stringWithCString:dateInput->GetMinRef().c_str()
                                             encoding:NSUTF8StringEncoding];
-            maxDateStr = [NSString stringWithCString:dateInput->GetMax().c_str()
+            maxDateStr = [NSString stringWithCString:dateInput->GetMaxRef().c_str()
                                             encoding:NSUTF8StringEncoding];
             formatter.timeStyle = NSDateFormatterNoStyle;
 
@@ -62,13 +62,13 @@ using namespace AdaptiveCards;
         {
             std::shared_ptr<TimeInput> timeInput = std::dynamic_pointer_cast<TimeInput>(elem);
 
-            valueStr = [NSString stringWithCString:timeInput->GetValue().c_str()
+            valueStr = [NSString stringWithCString:timeInput->GetValueRef().c_str()
                                           encoding:NSUTF8StringEncoding];
-            placeHolderStr = [NSString stringWithCString:timeInput->GetPlaceholder().c_str()
+            placeHolderStr = [NSString stringWithCString:timeInput->GetPlaceholderRef().c_str()
                                                 encoding:NSUTF8StringEncoding];
-            minDateStr = [NSString stringWithCString:timeInput->GetMin().c_str()
+            minDateStr = [NSString stringWithCString:timeInput->GetMinRef().c_str()
                                             encoding:NSUTF8StringEncoding];
-            maxDateStr = [NSString stringWithCString:timeInput->GetMax().c_str()
+            maxDateStr = [NSString stringWithCString:timeInput->GetMaxRef().c_str()
                                             encoding:NSUTF8StringEncoding];
             formatter.timeStyle = NSDateFormatterShortStyle;
 
@@ -123,9 +123,10 @@
 
     [factSetWrapperView adjustHuggingForLastElement];
 
-    for(auto fact :fctSet->GetFacts())
+    for(size_t i = 0; i < fctSet->GetFactCount(); ++i)
     {
-        NSString *title = [NSString stringWithCString:fact->GetTitle().c_str() encoding:NSUTF8StringEncoding];
+        const auto fact = fctSet->GetFactView(i);
+        NSString *title = [NSString stringWithCString:fact.GetTitleData() encoding:NSUTF8StringEncoding];
         ACRUILabel *titleLab = [ACRFactSetRenderer buildLabel:title
                                                     superview:viewGroup
                                                    hostConfig:acoConfig
@@ -143,7 +144,7 @@
             constraintForTitleLab.active = YES;
             constraintForTitleLab.priority = UILayoutPriorityRequired;
         }
-        NSString *value = [NSString stringWithCString:fact->GetValue().c_str() encoding:NSUTF8StringEncoding];
+        NSString *value = [NSString stringWithCString:fact.GetValueData() encoding:NSUTF8StringEncoding];
         ACRUILabel *valueLab = [ACRFactSetRenderer buildLabel:value
                                                     superview:viewGroup
                                                    hostConfig:acoConfig
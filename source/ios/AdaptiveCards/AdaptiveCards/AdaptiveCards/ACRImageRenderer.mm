@@ -47,7 +47,7 @@
 
     NSMutableDictionary *imageViewMap = [rootView getImageMap];
     // Syncronize access to imageViewMap
-    NSString *key = [NSString stringWithCString:imgElem->GetUrl().c_str() encoding:[NSString defaultCStringEncoding]];
+    NSString *key = [NSString stringWithCString:imgElem->GetUrlRef().c_str() encoding:[NSString defaultCStringEncoding]];
     UIImage *img = imageViewMap[key];
     ImageSize size = ImageSize::None;
     if (!hasExplicitMeasurements){
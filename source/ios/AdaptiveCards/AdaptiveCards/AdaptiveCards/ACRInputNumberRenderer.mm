@@ -38,7 +38,7 @@
     ACRNumericTextField *numInput = [[ACRNumericTextField alloc] init];
     numInput.id = [NSString stringWithCString:numInputBlck->GetId().c_str()
                                      encoding:NSUTF8StringEncoding];
-    numInput.placeholder = [NSString stringWithCString:numInputBlck->GetPlaceholder().c_str() encoding:NSUTF8StringEncoding];
+    numInput.placeholder = [NSString stringWithCString:numInputBlck->GetPlaceholderRef().c_str() encoding:NSUTF8StringEncoding];
     numInput.text = [NSString stringWithFormat: @"%d", numInputBlck->GetValue()];
     numInput.allowsEditingTextAttributes = YES;
     numInput.borderStyle = UITextBorderStyleRoundedRect;
@@ -106,13 +106,13 @@
             inputview = txtInput;
         }
 
-        NSString *placeHolderStr = [NSString stringWithCString:inputBlck->GetPlaceholder().c_str()
+        NSString *placeHolderStr = [NSString stringWithCString:inputBlck->GetPlaceholderRef().c_str()
                                                     encoding:NSUTF8StringEncoding];
         txtInput.id = [NSString stringWithCString:inputBlck->GetId().c_str()
                                          encoding:NSUTF8StringEncoding];
         txtInput.maxLength = inputBlck->GetMaxLength();
         txtInput.placeholder = placeHolderStr;
-        txtInput.text = [NSString stringWithCString:inputBlck->GetValue().c_str() encoding:NSUTF8StringEncoding];
+        txtInput.text = [NSString stringWithCString:inputBlck->GetValueRef().c_str() encoding:NSUTF8StringEncoding];
         txtInput.allowsEditingTextAttributes = YES;
         txtInput.isRequired  = inputBlck->GetIsRequired();
 
@@ -43,7 +43,7 @@
     std::shared_ptr<Media> mediaElem = std::dynamic_pointer_cast<Media>(elem);
 
     NSMutableDictionary *imageViewMap = [rootView getImageMap];
-    NSString *key = [NSString stringWithCString:mediaElem->GetPoster().c_str() encoding:[NSString defaultCStringEncoding]];
+    NSString *key = [NSString stringWithCString:mediaElem->GetPosterRef().c_str() encoding:[NSString defaultCStringEncoding]];
     UIImage *img = imageViewMap[key];
     UIImageView *view = nil;
     CGFloat heightToWidthRatio = 0.0f;
@@ -26,9 +26,9 @@
     std::shared_ptr<BaseCardElement> elem = [element element];
     std::shared_ptr<TextInput> inputBlck = std::dynamic_pointer_cast<TextInput>(elem);
     _maxLength = inputBlck->GetMaxLength();
-    _placeholderText = [[NSString alloc] initWithCString:inputBlck->GetPlaceholder().c_str() encoding:NSUTF8StringEncoding];
+    _placeholderText = [[NSString alloc] initWithCString:inputBlck->GetPlaceholderRef().c_str() encoding:NSUTF8StringEncoding];
     if(inputBlck->GetValue().size()){
-        self.text = [[NSString alloc] initWithCString:inputBlck->GetValue().c_str() encoding:NSUTF8StringEncoding];
+        self.text = [[NSString alloc] initWithCString:inputBlck->GetValueRef().c_str() encoding:NSUTF8StringEncoding];
     } else if([_placeholderText length]){
         self.text = _placeholderText;
         self.textColor = [UIColor lightGrayColor];
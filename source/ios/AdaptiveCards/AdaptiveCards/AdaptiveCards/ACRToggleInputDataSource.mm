@@ -29,7 +29,7 @@ const CGFloat padding = 16.0f;
     self = [super init];
 
     if(self) {
-        _title = [NSString stringWithCString:toggleInput->GetTitle().c_str()
+        _title = [NSString stringWithCString:toggleInput->GetTitleRef().c_str()
                                     encoding:NSUTF8StringEncoding];
         _toggleSwitch = [[UISwitch alloc] init];
         _toggleInputDataSource = toggleInput;
@@ -41,9 +41,9 @@ const CGFloat padding = 16.0f;
             _toggleSwitch.on = YES;
         }
 
-        self.valueOn  = [[NSString alloc]initWithCString:_toggleInputDataSource->GetValueOn().c_str()
+        self.valueOn  = [[NSString alloc]initWithCString:_toggleInputDataSource->GetValueOnRef().c_str()
                                            encoding:NSUTF8StringEncoding];
-        self.valueOff = [[NSString alloc]initWithCString:_toggleInputDataSource->GetValueOff().c_str()
+        self.valueOff = [[NSString alloc]initWithCString:_toggleInputDataSource->GetValueOffRef().c_str()
                                            encoding:NSUTF8StringEncoding];
     }
     return self;
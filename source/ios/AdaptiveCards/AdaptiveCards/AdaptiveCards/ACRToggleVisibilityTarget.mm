@@ -37,7 +37,7 @@
 - (void)doSelectAction
 {
     for(const auto &target : _action->GetTargetElements()) {
-        NSString *hashString = [NSString stringWithCString:target->GetElementId().c_str() encoding:NSUTF8StringEncoding];
+        NSString *hashString = [NSString stringWithCString:target->GetElementIdRef().c_str() encoding:NSUTF8StringEncoding];
         NSUInteger tag = hashString.hash;
         UIView *view = [_rootView viewWithTag:tag];
 
@@ -212,22 +212,23 @@ typedef UIImage* (^ImageLoadBlock)(NSURL *url);
                 NSString *key = [NSString stringWithCString:elem->GetId().c_str() encoding:[NSString defaultCStringEncoding]];
                 key = [key stringByAppendingString:@"*"];
                 int rowFactId = 0;
-                for(auto fact : factSet->GetFacts()) {
-                    std::string title = fact->GetTitle();
+                for(size_t i = 0; i < factSet->GetFactCount(); ++i) {
+                    const auto fact = factSet->GetFactView(i);
+                    std::string title = fact.GetTitle();
                     [self processTextConcurrently:factSet
                                       elementType:CardElementType::FactSet
                                        textConfig:[_hostConfig getHostConfig]->GetFactSet().title
                                         elementId:[key stringByAppendingString:[[NSNumber numberWithInt:rowFactId++] stringValue]]
                                              text:title
-                                             lang:fact->GetLanguage()];
+                                             lang:factSet->GetFactLanguageRef(i)];
 
-                    std::string value = fact->GetValue();
+                    std::string value = fact.GetValue();
                     [self processTextConcurrently:factSet
                                       elementType:CardElementType::FactSet
                                        textConfig:[_hostConfig getHostConfig]->GetFactSet().value
                                         elementId:[key stringByAppendingString:[[NSNumber numberWithInt:rowFactId++] stringValue]]
                                              text:value
-                                             lang:fact->GetLanguage()];
+                                             lang:factSet->GetFactLanguageRef(i)];
                 }
                 break;
             }
@@ -522,6 +523,7 @@ typedef UIImage* (^ImageLoadBlock)(NSURL *url);
 }
 
 // add postfix to existing BaseCardElement ID to be used as key
+// writes to the model, so frozen (e.g. cached) cards must be cloned before they're rendered
 - (void)tagBaseCardElement:(std::shared_ptr<BaseCardElement> const &)elem
 {
     std::string serial_number_as_string = std::to_string(_serialNumber);
@@ -613,11 +615,11 @@ typedef UIImage* (^ImageLoadBlock)(NSURL *url);
     if(elem->GetElementType() == CardElementType::Media) {
         std::shared_ptr<Media> mediaElem = std::static_pointer_cast<Media>(elem);
         number = [NSNumber numberWithUnsignedLongLong:(unsigned long long)mediaElem.get()];
-        nSUrlStr = [NSString stringWithCString:mediaElem->GetPoster().c_str() encoding:[NSString defaultCStringEncoding]];
+        nSUrlStr = [NSString stringWithCString:mediaElem->GetPosterRef().c_str() encoding:[NSString defaultCStringEncoding]];
     } else {
         std::shared_ptr<Image> imgElem = std::static_pointer_cast<Image>(elem);
         number = [NSNumber numberWithUnsignedLongLong:(unsigned long long)imgElem.get()];
-        nSUrlStr = [NSString stringWithCString:imgElem->GetUrl().c_str() encoding:[NSString defaultCStringEncoding]];
+        nSUrlStr = [NSString stringWithCString:imgElem->GetUrlRef().c_str() encoding:[NSString defaultCStringEncoding]];
     }
     if(!key) {
         key = [number stringValue];
@@ -0,0 +1,89 @@
+#include "stdafx.h"
+#include "AdaptiveCardBuilder.h"
+#include "Fact.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(AdaptiveCardBuilderTest)
+    {
+    public:
+        TEST_METHOD(BuiltCardMatchesParsedCard)
+        {
+            AdaptiveCardBuilder builder("1.2");
+            builder.SetSpeak("Weather").SetLanguage("en");
+            builder.Body().AddTextBlock("Sunny").SetWrap(true);
+            builder.Body().AddContainer([](ElementListBuilder& items) {
+                items.AddImage("https://example.com/sun.png").SetAltText("sun");
+                items.AddFactSet({{"High", "25"}, {"Low", "12"}});
+            });
+            builder.Body().AddColumnSet([](ColumnListBuilder& columns) {
+                columns.AddColumn("auto", [](ElementListBuilder& items) { items.AddTextInput("city").SetPlaceholder("City"); });
+                columns.AddColumn("stretch", [](ElementListBuilder& items) {
+                    items.AddChoiceSetInput("unit", {{"Celsius", "c"}, {"Fahrenheit", "f"}});
+                });
+            });
+            builder.Body().AddActionSet([](ActionListBuilder& actions) { actions.AddToggleVisibility("Details", {"city"}); });
+            builder.Actions().AddOpenUrl("Forecast", "https://example.com/forecast");
+            builder.Actions().AddSubmit("Refresh");
+            auto card = builder.Build();
+
+            const std::string expectedJson = R"({"type":"AdaptiveCard","version":"1.2","speak":"Weather","lang":"en","body":[
+                {"type":"TextBlock","text":"Sunny","wrap":true},
+                {"type":"Container","items":[
+                    {"type":"Image","url":"https://example.com/sun.png","altText":"sun"},
+                    {"type":"FactSet","facts":[{"title":"High","value":"25"},{"title":"Low","value":"12"}]}]},
+                {"type":"ColumnSet","columns":[
+                    {"type":"Column","width":"auto","items":[{"type":"Input.Text","id":"city","placeholder":"City"}]},
+                    {"type":"Column","width":"stretch","items":[{"type":"Input.ChoiceSet","id":"unit",
+                        "choices":[{"title":"Celsius","value":"c"},{"title":"Fahrenheit","value":"f"}]}]}]},
+                {"type":"ActionSet","actions":[{"type":"Action.ToggleVisibility","title":"Details","targetElements":["city"]}]}],
+                "actions":[{"type":"Action.OpenUrl","title":"Forecast","url":"https://example.com/forecast"},
+                           {"type":"Action.Submit","title":"Refresh"}]})";
+            auto parsed = AdaptiveCard::DeserializeFromString(expectedJson, "1.2")->GetAdaptiveCard();
+
+            Assert::AreEqual(parsed->SerializeToCanonicalString(), card->SerializeToCanonicalString());
+        }
+
+        TEST_METHOD(BuilderMovesStringsIntoTheCard)
+        {
+            std::string text(200, 't');
+            const char* textBuffer = text.data();
+            std::string factValue(200, 'v');
+            const char* factValueBuffer = factValue.data();
+
+            AdaptiveCardBuilder builder("1.2");
+            const TextBlock& textBlock = builder.Body().AddTextBlock(std::move(text));
+            std::vector<std::pair<std::string, std::string>> facts;
+            facts.emplace_back("title", std::move(factValue));
+            const FactSet& factSet = builder.Body().AddFactSet(std::move(facts));
+
+            // the strings' buffers were handed over rather than copied
+            Assert::IsTrue(textBuffer == textBlock.GetTextRef().data());
+            Assert::IsTrue(factValueBuffer == factSet.GetFacts()[0]->GetValueRef().data());
+
+            // and the card owns the elements that were built, not copies of them
+            auto card = builder.Build();
+            Assert::IsTrue(&textBlock == card->GetBody()[0].get());
+            Assert::IsTrue(textBuffer == std::static_pointer_cast<TextBlock>(card->GetBody()[0])->GetTextRef().data());
+        }
+
+        TEST_METHOD(BuilderIsReusableAfterBuild)
+        {
+            AdaptiveCardBuilder builder("1.2");
+            builder.SetSpeak("first").SetStyle(ContainerStyle::Emphasis).Body().AddTextBlock("one");
+            auto first = builder.Build();
+
+            builder.Body().AddTextBlock("two");
+            auto second = builder.Build();
+
+            Assert::AreEqual<size_t>(1, first->GetBody().size());
+            Assert::AreEqual<size_t>(1, second->GetBody().size());
+            Assert::AreEqual(std::string("1.2"), second->GetVersion());
+            Assert::IsTrue(second->GetSpeak().empty());
+            Assert::IsTrue(ContainerStyle::None == second->GetStyle());
+        }
+    };
+}
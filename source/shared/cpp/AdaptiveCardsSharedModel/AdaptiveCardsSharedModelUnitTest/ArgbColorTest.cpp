@@ -0,0 +1,102 @@
+#include "stdafx.h"
+#include "ArgbColor.h"
+#include "HostConfig.h"
+#include "Image.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ArgbColorTest)
+    {
+    public:
+        TEST_METHOD(ParseAndFormat)
+        {
+            ArgbColor color;
+            Assert::IsTrue(ArgbColor::TryParse("#ABf65314", color));
+            Assert::AreEqual(0xABF65314u, color.argb);
+            Assert::AreEqual<int>(0xAB, color.GetAlpha());
+            Assert::AreEqual<int>(0xF6, color.GetRed());
+            Assert::AreEqual<int>(0x53, color.GetGreen());
+            Assert::AreEqual<int>(0x14, color.GetBlue());
+            Assert::AreEqual("#ABF65314"s, color.ToString());
+
+            Assert::IsTrue(ArgbColor::TryParse("#f65314", color));
+            Assert::AreEqual(0xFFF65314u, color.argb);
+
+            for (const auto& invalid : {""s, "#"s, "F65314"s, "#F6531"s, "#FF7F7F7F7F"s, "#GG000000"s, "#ABF6531 "s})
+            {
+                Assert::IsFalse(ArgbColor::TryParse(invalid, color));
+                Assert::AreEqual(0xFFF65314u, color.argb);
+                Assert::IsTrue(ArgbColor() == ArgbColor::Parse(invalid));
+            }
+        }
+
+        TEST_METHOD(ImageBackgroundColor)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.0","body":[
+                {"type":"Image","url":"a","backgroundColor":"#f65314"},
+                {"type":"Image","url":"b","backgroundColor":"blue"},
+                {"type":"Image","url":"c"}]})",
+                                                            "1.0")
+                            ->GetAdaptiveCard();
+
+            const auto image = [&card](size_t index) { return std::static_pointer_cast<Image>(card->GetBody()[index]); };
+            Assert::AreEqual("#FFf65314"s, image(0)->GetBackgroundColor());
+            Assert::AreEqual(0xFFF65314u, image(0)->GetBackgroundColorArgb().argb);
+            Assert::AreEqual(0u, image(1)->GetBackgroundColorArgb().argb);
+            Assert::AreEqual(0u, image(2)->GetBackgroundColorArgb().argb);
+
+            image(2)->SetBackgroundColor("#80102030");
+            Assert::AreEqual(0x80102030u, image(2)->GetBackgroundColorArgb().argb);
+        }
+
+        TEST_METHOD(HostConfigColorsMatchTheirStrings)
+        {
+            const auto expectMatchingColors = [](const HostConfig& hostConfig) {
+                for (auto style : {ContainerStyle::None, ContainerStyle::Default, ContainerStyle::Emphasis, ContainerStyle::Good,
+                                   ContainerStyle::Attention, ContainerStyle::Warning, ContainerStyle::Accent})
+                {
+                    Assert::IsTrue(ArgbColor::Parse(hostConfig.GetBackgroundColor(style)) == hostConfig.GetBackgroundColorArgb(style));
+                    Assert::IsTrue(ArgbColor::Parse(hostConfig.GetBorderColor(style)) == hostConfig.GetBorderColorArgb(style));
+                    for (auto color : {ForegroundColor::Default, ForegroundColor::Dark, ForegroundColor::Light, ForegroundColor::Accent,
+                                       ForegroundColor::Good, ForegroundColor::Warning, ForegroundColor::Attention})
+                    {
+                        for (bool isSubtle : {false, true})
+                        {
+                            Assert::IsTrue(ArgbColor::Parse(hostConfig.GetForegroundColor(style, color, isSubtle)) ==
+                                           hostConfig.GetForegroundColorArgb(style, color, isSubtle));
+                        }
+                    }
+                }
+                Assert::IsTrue(ArgbColor::Parse(hostConfig.GetSeparator().lineColor) == hostConfig.GetSeparatorLineColorArgb());
+            };
+
+            HostConfig defaults;
+            expectMatchingColors(defaults);
+            Assert::AreEqual(0xB2000000u, defaults.GetSeparatorLineColorArgb().argb);
+            Assert::AreEqual(0xFF0000FFu, defaults.GetForegroundColorArgb(ContainerStyle::Default, ForegroundColor::Accent, false).argb);
+
+            HostConfig parsed = HostConfig::DeserializeFromString(R"({"separator":{"lineColor":"#112233"},
+                "containerStyles":{"emphasis":{"backgroundColor":"#44556677","foregroundColors":{"good":{"subtle":"#8899AA"}}}}})");
+            expectMatchingColors(parsed);
+            Assert::AreEqual(0xFF112233u, parsed.GetSeparatorLineColorArgb().argb);
+            Assert::AreEqual(0x44556677u, parsed.GetBackgroundColorArgb(ContainerStyle::Emphasis).argb);
+            Assert::AreEqual(0xFF8899AAu, parsed.GetForegroundColorArgb(ContainerStyle::Emphasis, ForegroundColor::Good, true).argb);
+
+            // setters refresh the packed colors
+            auto styles = parsed.GetContainerStyles();
+            styles.accentPalette.borderColor = "#01020304";
+            parsed.SetContainerStyles(styles);
+            auto separator = parsed.GetSeparator();
+            separator.lineColor = "#05060708";
+            parsed.SetSeparator(separator);
+            expectMatchingColors(parsed);
+            Assert::AreEqual(0x01020304u, parsed.GetBorderColorArgb(ContainerStyle::Accent).argb);
+            Assert::AreEqual(0x05060708u, parsed.GetSeparatorLineColorArgb().argb);
+        }
+    };
+}
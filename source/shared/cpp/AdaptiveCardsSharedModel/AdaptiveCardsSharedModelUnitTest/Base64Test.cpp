@@ -1,8 +1,11 @@
 #include "stdafx.h"
 #include "AdaptiveBase64Util.h"
+#include <chrono>
+#include <random>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace AdaptiveCards;
+using namespace std::string_literals;
 
 namespace AdaptiveCardsSharedModelUnitTest
 {
@@ -69,5 +72,110 @@ namespace AdaptiveCardsSharedModelUnitTest
             }
 
         }
+
+        static bool DecodeInto(const std::string& encoded, std::string& decoded, AdaptiveBase64Util::Validation validation)
+        {
+            std::vector<char> buffer(AdaptiveBase64Util::MaxDecodedLength(encoded.size()));
+            size_t decodedLength;
+            const bool isValid = AdaptiveBase64Util::Decode(encoded.data(), encoded.size(), buffer.data(), decodedLength, validation);
+            decoded.assign(buffer.data(), decodedLength);
+            return isValid;
+        }
+
+        TEST_METHOD(ValidationModesTest)
+        {
+            using Validation = AdaptiveBase64Util::Validation;
+            std::string decoded;
+
+            Assert::IsTrue(DecodeInto("Zm9vYmE=", decoded, Validation::Strict));
+            Assert::AreEqual("fooba"s, decoded);
+            Assert::IsTrue(DecodeInto("", decoded, Validation::Strict));
+            Assert::AreEqual(""s, decoded);
+
+            // padding may only be left out, and whitespace skipped, leniently
+            for (const auto& encoded : {"Zm9vYmE"s, "Zm9v\r\nYmE=\n"s, " Zm 9v YmE"s})
+            {
+                Assert::IsFalse(DecodeInto(encoded, decoded, Validation::Strict));
+                Assert::IsTrue(DecodeInto(encoded, decoded, Validation::Lenient));
+                Assert::AreEqual("fooba"s, decoded);
+            }
+
+            // invalid either way; the groups before the error are still decoded
+            for (const auto& encoded : {"Zm9vY"s, "Zm9vYmE==="s, "Zm9v=mE="s, "Zm9vYmE=Zg=="s, "Zm9v_mFy"s, "Zm9vYmFy\xC3\xA9"s})
+            {
+                Assert::IsFalse(DecodeInto(encoded, decoded, Validation::Strict));
+                Assert::IsFalse(DecodeInto(encoded, decoded, Validation::Lenient));
+                Assert::AreEqual("foo"s, decoded.substr(0, 3));
+            }
+            Assert::AreEqual(3u, static_cast<unsigned int>(AdaptiveBase64Util::Decode("Zm9v_mFy").size()));
+        }
+
+        TEST_METHOD(RoundTripTest)
+        {
+            // every length up to a few blocks, so that both whole blocks and the bytes after them are covered
+            std::mt19937 random(1234);
+            for (size_t length = 0; length < 200; ++length)
+            {
+                std::vector<char> data(length);
+                for (auto& byte : data)
+                {
+                    byte = static_cast<char>(random());
+                }
+
+                const std::string encoded = AdaptiveBase64Util::Encode(data);
+                Assert::AreEqual(AdaptiveBase64Util::EncodedLength(length), encoded.size());
+
+                // the same as encoding each group of 3 bytes on its own
+                std::string expected;
+                for (size_t i = 0; i < length; i += 3)
+                {
+                    expected += AdaptiveBase64Util::Encode(std::vector<char>(data.begin() + i, data.begin() + std::min(length, i + 3)));
+                }
+                Assert::AreEqual(expected, encoded);
+
+                std::string decoded;
+                Assert::IsTrue(DecodeInto(encoded, decoded, AdaptiveBase64Util::Validation::Strict));
+                Assert::IsTrue(decoded == std::string(data.begin(), data.end()));
+
+                // an invalid character anywhere is caught, however far into the data it is
+                if (!encoded.empty())
+                {
+                    std::string damaged = encoded;
+                    damaged[length % damaged.size()] = '*';
+                    Assert::IsFalse(DecodeInto(damaged, decoded, AdaptiveBase64Util::Validation::Lenient));
+                }
+            }
+        }
+
+        TEST_METHOD(ThroughputBenchmark)
+        {
+            std::vector<char> data(4 * 1024 * 1024);
+            std::mt19937 random(42);
+            for (auto& byte : data)
+            {
+                byte = static_cast<char>(random());
+            }
+
+            auto start = std::chrono::steady_clock::now();
+            const std::string encoded = AdaptiveBase64Util::Encode(data);
+            const auto encodeTime = std::chrono::steady_clock::now() - start;
+
+            start = std::chrono::steady_clock::now();
+            std::vector<char> decoded(AdaptiveBase64Util::MaxDecodedLength(encoded.size()));
+            size_t decodedLength;
+            Assert::IsTrue(AdaptiveBase64Util::Decode(encoded.data(), encoded.size(), decoded.data(), decodedLength));
+            const auto decodeTime = std::chrono::steady_clock::now() - start;
+
+            decoded.resize(decodedLength);
+            Assert::IsTrue(data == decoded);
+
+            const auto megabytesPerSecond = [&data](std::chrono::steady_clock::duration time) {
+                const auto microseconds = std::max<long long>(1, std::chrono::duration_cast<std::chrono::microseconds>(time).count());
+                return std::to_string(static_cast<long long>(data.size() / static_cast<double>(microseconds)));
+            };
+            Logger::WriteMessage(("Base64 of 4MB: encode " + megabytesPerSecond(encodeTime) + "MB/s, decode " +
+                                  megabytesPerSecond(decodeTime) + "MB/s")
+                                     .c_str());
+        }
     };
 }
@@ -0,0 +1,161 @@
+#include "stdafx.h"
+#include "CardDiff.h"
+#include "CardFixtures.h"
+#include "Container.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    using namespace CardFixtures;
+
+    namespace
+    {
+        // edits as "<type> <path>[ <from>]" lines, for comparing whole scripts at once
+        std::string Describe(const std::vector<CardEdit>& edits)
+        {
+            std::string description;
+            for (const auto& edit : edits)
+            {
+                switch (edit.type)
+                {
+                case CardEditType::ChangeProperty:
+                    description += "change " + edit.path;
+                    break;
+                case CardEditType::Insert:
+                    description += "insert " + edit.path;
+                    break;
+                case CardEditType::Remove:
+                    description += "remove " + edit.path;
+                    break;
+                case CardEditType::Move:
+                    description += "move " + edit.fromPath + " " + edit.path;
+                    break;
+                }
+                description += "\n";
+            }
+            return description;
+        }
+    }
+
+    TEST_CLASS(CardDiffTest)
+    {
+    public:
+        TEST_METHOD(EqualCardsHaveNoEdits)
+        {
+            const std::string body = Text("a", "one") + R"(,{"type":"Container","items":[)" + Text("", "two") + "]}";
+            Assert::IsTrue(DiffCards(*Parse(body), *Parse(body)).empty());
+        }
+
+        TEST_METHOD(PropertyChanges)
+        {
+            auto oldCard = Parse(Text("a", "one") + R"(,{"type":"Container","items":[{"type":"TextBlock","text":"x","size":"large"}]})");
+            auto newCard = Parse(Text("a", "uno") + R"(,{"type":"Container","items":[{"type":"TextBlock","text":"x","wrap":true}]})");
+            const auto edits = DiffCards(*oldCard, *newCard);
+            Assert::AreEqual("change /body/0/text\nchange /body/1/items/0/size\nchange /body/1/items/0/wrap\n"s, Describe(edits));
+
+            Assert::AreEqual("text"s, edits[0].propertyName);
+            Assert::AreEqual("one"s, edits[0].oldValue.asString());
+            Assert::AreEqual("uno"s, edits[0].newValue.asString());
+            Assert::IsTrue(edits[0].oldElement == oldCard->GetBody()[0]);
+            Assert::IsTrue(edits[0].newElement == newCard->GetBody()[0]);
+            Assert::IsTrue(edits[1].newValue.isNull());
+            Assert::IsTrue(edits[2].oldValue.isNull());
+            Assert::IsTrue(edits[2].newValue.asBool());
+
+            // card properties have no element
+            auto spoken = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.2","speak":"hi","body":[]})", "1.2")
+                              ->GetAdaptiveCard();
+            const auto cardEdits = DiffCards(*Parse(""), *spoken);
+            Assert::AreEqual("change /speak\n"s, Describe(cardEdits));
+            Assert::IsTrue(cardEdits[0].newElement == nullptr);
+        }
+
+        TEST_METHOD(InsertsRemovesAndMoves)
+        {
+            auto oldCard = Parse(Text("a", "A") + "," + Text("b", "B") + "," + Text("c", "C") + "," + Text("d", "D"));
+            auto newCard = Parse(Text("d", "D") + "," + Text("a", "A") + "," + Text("e", "E") + "," + Text("c", "C2"));
+            const auto edits = DiffCards(*oldCard, *newCard);
+            Assert::AreEqual("remove /body/1\ninsert /body/2\nmove /body/3 /body/0\nchange /body/3/text\n"s, Describe(edits));
+            Assert::AreEqual("E"s, edits[1].newValue["text"].asString());
+            Assert::IsTrue(edits[1].newElement == newCard->GetBody()[2]);
+
+            // without ids, unchanged elements are still found by content, and the rest are paired by position
+            const auto anonymous = DiffCards(*Parse(Text("", "A") + "," + Text("", "B") + "," + Text("", "C")),
+                                             *Parse(Text("", "C") + "," + Text("", "A") + "," + Text("", "X")));
+            Assert::AreEqual("move /body/2 /body/0\nchange /body/2/text\n"s, Describe(anonymous));
+
+            // elements of different types aren't paired
+            const auto retyped = DiffCards(*Parse(Text("", "A")), *Parse(R"({"type":"Image","url":"https://a.b/c.png"})"));
+            Assert::AreEqual("remove /body/0\ninsert /body/0\n"s, Describe(retyped));
+
+            // the same id on a different type isn't a match either
+            const auto reused = DiffCards(*Parse(Text("a", "A")), *Parse(R"({"type":"Container","id":"a","items":[]})"));
+            Assert::AreEqual("remove /body/0\ninsert /body/0\n"s, Describe(reused));
+        }
+
+        TEST_METHOD(FallbackAndShowCard)
+        {
+            const auto image = [](const std::string& fallbackText) {
+                return R"({"type":"Image","url":"https://a.b/c.png","fallback":)" + Text("", fallbackText) + "}";
+            };
+            const auto showCard = [](const std::string& body) {
+                return R"({"type":"Action.ShowCard","title":"more","card":{"type":"AdaptiveCard","body":[)" + body + "]}}";
+            };
+
+            auto oldCard = Parse(image("old"), showCard(Text("x", "1") + "," + Text("y", "2")));
+            auto newCard = Parse(image("new"), showCard(Text("y", "2")));
+            Assert::AreEqual("change /body/0/fallback/text\nremove /actions/0/card/body/0\n"s, Describe(DiffCards(*oldCard, *newCard)));
+
+            // a fallback on one side only is a property change
+            auto dropped = Parse(R"({"type":"Image","url":"https://a.b/c.png","fallback":"drop"})", showCard(Text("y", "2")));
+            const auto edits = DiffCards(*oldCard, *dropped);
+            Assert::AreEqual("change /body/0/fallback\nremove /actions/0/card/body/0\n"s, Describe(edits));
+            Assert::AreEqual("drop"s, edits[0].newValue.asString());
+        }
+
+        TEST_METHOD(PathsAreEscaped)
+        {
+            auto oldCard = Parse(R"({"type":"TextBlock","text":"x","a/b~c":1})");
+            auto newCard = Parse(R"({"type":"TextBlock","text":"x","a/b~c":2})");
+            const auto edits = DiffCards(*oldCard, *newCard);
+            Assert::AreEqual("change /body/0/a~1b~0c\n"s, Describe(edits));
+            Assert::AreEqual("a/b~c"s, edits[0].propertyName);
+        }
+
+        TEST_METHOD(LargeCardDiffTime)
+        {
+            const size_t count = 2000;
+            std::string oldBody;
+            std::string newBody;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string n = std::to_string(i);
+                const std::string item = R"({"type":"Container","id":"c)" + n + R"(","items":[)" + Text("", "Item " + n) + "]}";
+                oldBody += (i == 0 ? "" : ",") + item;
+                newBody += (i == 0 ? "" : ",") + (i == 1234 ? R"({"type":"Container","id":"c1234","items":[)" + Text("", "changed") + "]}" : item);
+            }
+            auto oldCard = Parse(oldBody);
+            auto newCard = Parse(newBody);
+
+            const auto start = std::chrono::steady_clock::now();
+            const auto edits = DiffCards(*oldCard, *newCard);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            Assert::AreEqual("change /body/1234/items/0/text\n"s, Describe(edits));
+
+            // a modified element is found without its hash or its ancestors' being brought up to date by hand
+            auto text = std::static_pointer_cast<TextBlock>(std::static_pointer_cast<Container>(newCard->GetBody()[7])->GetItems()[0]);
+            text->SetText("edited");
+            Assert::AreEqual("change /body/7/items/0/text\nchange /body/1234/items/0/text\n"s, Describe(DiffCards(*oldCard, *newCard)));
+
+            Logger::WriteMessage(("Diff of two "s + std::to_string(count) + "-container cards: " +
+                                  std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) + "us")
+                                     .c_str());
+        }
+    };
+}
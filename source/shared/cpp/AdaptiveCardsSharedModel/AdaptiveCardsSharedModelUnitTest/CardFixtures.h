@@ -0,0 +1,24 @@
+#pragma once
+
+#include "SharedAdaptiveCard.h"
+
+// Small json cards for tests that build many slightly different ones
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace CardFixtures
+    {
+        // A version 1.2 card with the given body and actions, each a comma-separated list of json objects
+        inline std::shared_ptr<AdaptiveCards::AdaptiveCard> Parse(const std::string& body, const std::string& actions = "")
+        {
+            const std::string json = R"({"type":"AdaptiveCard","version":"1.2","body":[)" + body + "]" +
+                                     (actions.empty() ? std::string() : R"(,"actions":[)" + actions + "]") + "}";
+            return AdaptiveCards::AdaptiveCard::DeserializeFromString(json, "1.2")->GetAdaptiveCard();
+        }
+
+        // A TextBlock's json, with no id if id is empty
+        inline std::string Text(const std::string& id, const std::string& text)
+        {
+            return R"({"type":"TextBlock",)" + (id.empty() ? std::string() : R"("id":")" + id + R"(",)") + R"("text":")" + text + R"("})";
+        }
+    }
+}
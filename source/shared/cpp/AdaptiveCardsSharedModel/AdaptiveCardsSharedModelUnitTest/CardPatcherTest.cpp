@@ -0,0 +1,317 @@
+#include "stdafx.h"
+#include "CardPatcher.h"
+#include "ActionSet.h"
+#include "AdaptiveCardParseException.h"
+#include "CardFixtures.h"
+#include "CardQuery.h"
+#include "CardState.h"
+#include "Container.h"
+#include "ContentHash.h"
+#include "FactSet.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    using namespace CardFixtures;
+
+    namespace
+    {
+        // the card after the patch should serialize as the patched json would parse
+        void AssertPatched(const std::string& expectedBody, const AdaptiveCard& card)
+        {
+            Assert::AreEqual(Parse(expectedBody)->Serialize(), card.Serialize());
+        }
+
+        ErrorStatusCode ApplyError(CardPatcher& patcher, const std::string& patch)
+        {
+            ParseContext context;
+            try
+            {
+                patcher.ApplyJson(patch, context);
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                return e.GetStatusCode();
+            }
+            Assert::Fail(L"patch should have failed");
+            return ErrorStatusCode::InvalidJson;
+        }
+    }
+
+    TEST_CLASS(CardPatcherTest)
+    {
+    public:
+        TEST_METHOD(PatchesElementsInPlace)
+        {
+            auto card = Parse(Text("a", "one") + R"(,{"type":"Container","items":[)" + Text("", "two") + "]}");
+            const auto first = card->GetBody()[0];
+            CardPatcher patcher(card);
+            ParseContext context;
+
+            // only the nested text block is parsed again
+            patcher.ApplyJson(R"([{"op":"replace","path":"/body/1/items/0/text","value":"deux"}])", context);
+            Assert::AreEqual(std::size_t{1}, patcher.GetLastStatistics().reparsedElements);
+            Assert::IsFalse(patcher.GetLastStatistics().reparsedCard);
+            Assert::IsTrue(first == card->GetBody()[0]);
+            AssertPatched(Text("a", "one") + R"(,{"type":"Container","items":[)" + Text("", "deux") + "]}", *card);
+
+            patcher.ApplyJson(R"([{"op":"add","path":"/body/-","value":{"type":"TextBlock","text":"three"}},
+                                  {"op":"add","path":"/body/1/items/0","value":{"type":"TextBlock","text":"zero"}},
+                                  {"op":"remove","path":"/body/0"},
+                                  {"op":"add","path":"/body/0/items/1/wrap","value":true}])",
+                              context);
+            AssertPatched(R"({"type":"Container","items":[)" + Text("", "zero") + R"(,{"type":"TextBlock","text":"deux","wrap":true}]},)" +
+                              Text("", "three"),
+                          *card);
+
+            // card properties parse the card's shell, leaving its elements be
+            const auto container = card->GetBody()[0];
+            patcher.ApplyJson(R"([{"op":"add","path":"/speak","value":"hello"}])", context);
+            Assert::IsTrue(patcher.GetLastStatistics().reparsedCard);
+            Assert::AreEqual("hello"s, card->GetSpeak());
+            Assert::IsTrue(container == card->GetBody()[0]);
+
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue == ApplyError(patcher, R"([{"op":"remove","path":"/body/2"}])"));
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue == ApplyError(patcher, R"([{"op":"remove","path":"/body/01"}])"));
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue == ApplyError(patcher, R"([{"op":"replace","path":"/body/-","value":{}}])"));
+            Assert::IsTrue(ErrorStatusCode::RequiredPropertyMissing == ApplyError(patcher, R"([{"op":"add","path":"/body/0"}])"));
+        }
+
+        TEST_METHOD(MoveCopyAndTest)
+        {
+            auto card = Parse(Text("", "A") + "," + Text("", "B") + R"(,{"type":"Image","url":"https://a.b/c.png","fallback":)" + Text("", "C") + "}");
+            CardPatcher patcher(card);
+            ParseContext context;
+
+            patcher.ApplyJson(R"([{"op":"test","path":"/body/2/fallback/text","value":"C"},
+                                  {"op":"move","from":"/body/0","path":"/body/1"},
+                                  {"op":"copy","from":"/body/0/text","path":"/body/2/fallback/text"}])",
+                              context);
+            AssertPatched(Text("", "B") + "," + Text("", "A") + R"(,{"type":"Image","url":"https://a.b/c.png","fallback":)" + Text("", "B") + "}",
+                          *card);
+
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue ==
+                           ApplyError(patcher, R"([{"op":"test","path":"/body/0/text","value":"A"}])"));
+
+            // numbers compare by value, however they're stored
+            auto inputCard = Parse(R"({"type":"Input.Text","id":"in","maxLength":10})");
+            CardPatcher inputPatcher(inputCard);
+            inputPatcher.ApplyJson(R"([{"op":"test","path":"/body/0/maxLength","value":10},
+                                       {"op":"test","path":"/body/0/maxLength","value":10.0}])",
+                                   context);
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue ==
+                           ApplyError(inputPatcher, R"([{"op":"test","path":"/body/0/maxLength","value":-10}])"));
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue ==
+                           ApplyError(inputPatcher, R"([{"op":"test","path":"/body/0/maxLength","value":"10"}])"));
+            Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue ==
+                           ApplyError(patcher, R"([{"op":"move","from":"/body/0","path":"/body/0/items"}])"));
+        }
+
+        TEST_METHOD(ConsecutiveOperationsOnOneElement)
+        {
+            auto card = Parse(Text("", "one") + "," + Text("", "two"));
+            CardPatcher patcher(card);
+            ParseContext context;
+
+            // an image without a url doesn't parse, so the element is parsed once both operations are applied
+            patcher.ApplyJson(R"([{"op":"replace","path":"/body/0/type","value":"Image"},
+                                  {"op":"add","path":"/body/0/url","value":"http://x"}])",
+                              context);
+            Assert::AreEqual(std::size_t{1}, patcher.GetLastStatistics().reparsedElements);
+            AssertPatched(R"({"type":"Image","text":"one","url":"http://x"},)" + Text("", "two"), *card);
+
+            // reads see the element as edited so far, and replacing it drops the edits
+            patcher.ApplyJson(R"([{"op":"replace","path":"/body/1/type","value":"Image"},
+                                  {"op":"test","path":"/body/1/type","value":"Image"},
+                                  {"op":"copy","from":"/body/0/url","path":"/body/1/url"},
+                                  {"op":"move","from":"/body/1/text","path":"/body/1/altText"},
+                                  {"op":"replace","path":"/body/0/url","value":"http://y"},
+                                  {"op":"remove","path":"/body/0/text"},
+                                  {"op":"replace","path":"/body/0","value":{"type":"TextBlock","text":"three"}}])",
+                              context);
+            Assert::AreEqual(std::size_t{2}, patcher.GetLastStatistics().reparsedElements);
+            AssertPatched(Text("", "three") + R"(,{"type":"Image","altText":"two","url":"http://x"})", *card);
+
+            // the element is parsed before anything that depends on its place in the card
+            Assert::IsTrue(ErrorStatusCode::RequiredPropertyMissing ==
+                           ApplyError(patcher, R"([{"op":"replace","path":"/body/0/type","value":"Image"},
+                                                   {"op":"remove","path":"/body/1"}])"));
+            AssertPatched(Text("", "three") + R"(,{"type":"Image","altText":"two","url":"http://x"})", *card);
+        }
+
+        TEST_METHOD(FailedPatchChangesNothing)
+        {
+            auto card = Parse(Text("a", "one") + "," + Text("b", "two"));
+            const std::string before = card->Serialize();
+            CardPatcher patcher(card);
+
+            // the first operation succeeds, then the second adds a duplicate id
+            Assert::IsTrue(ErrorStatusCode::IdCollision ==
+                           ApplyError(patcher, R"([{"op":"replace","path":"/body/0/text","value":"uno"},
+                                                   {"op":"add","path":"/body/-","value":{"type":"TextBlock","id":"b","text":"x"}}])"));
+            Assert::AreEqual(before, card->Serialize());
+
+            // the removed id is free again, but only once it has been removed
+            ParseContext context;
+            patcher.ApplyJson(R"([{"op":"remove","path":"/body/1"},
+                                  {"op":"add","path":"/body/-","value":{"type":"TextBlock","id":"b","text":"x"}}])",
+                              context);
+            AssertPatched(Text("a", "one") + "," + Text("b", "x"), *card);
+            Assert::IsTrue(ErrorStatusCode::IdCollision == ApplyError(patcher, R"([{"op":"replace","path":"/body/0/id","value":"b"}])"));
+
+            card->Freeze();
+            Assert::IsTrue(ErrorStatusCode::FrozenObjectModification ==
+                           ApplyError(patcher, R"([{"op":"remove","path":"/body/0"}])"));
+        }
+
+        TEST_METHOD(ToggleTargetsFollowPatchedElements)
+        {
+            auto card = Parse(Text("details", "old"), R"({"type":"Action.ToggleVisibility","title":"t","targetElements":["details","later"]})");
+            const auto targets = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions()[0])->GetTargetElements();
+            CardPatcher patcher(card);
+            ParseContext context;
+
+            patcher.ApplyJson(R"([{"op":"replace","path":"/body/0/text","value":"new"},
+                                  {"op":"add","path":"/body/-","value":{"type":"TextBlock","id":"later","text":"x"}}])",
+                              context);
+            Assert::IsTrue(targets[0]->GetElement() == card->GetBody()[0]);
+            Assert::IsTrue(targets[1]->GetElement() == card->GetBody()[1]);
+
+            patcher.ApplyJson(R"([{"op":"remove","path":"/body/1"}])", context);
+            Assert::IsTrue(targets[1]->GetElement() == nullptr);
+
+            // a replaced action's targets are resolved against the card
+            patcher.ApplyJson(R"([{"op":"replace","path":"/actions/0/targetElements","value":["details"]}])", context);
+            const auto newTargets = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions()[0])->GetTargetElements();
+            Assert::IsTrue(newTargets[0]->GetElement() == card->GetBody()[0]);
+        }
+
+        TEST_METHOD(ElementIndexFollowsPatches)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[)" + Text("a", "one") +
+                                         R"(,{"type":"Container","id":"box","items":[)" + Text("tb", "two") + "]}]}";
+            const auto parseResult = AdaptiveCard::DeserializeFromString(cardJson, "1.2");
+            const auto card = parseResult->GetAdaptiveCard();
+            CardPatcher patcher(parseResult);
+            ParseContext context;
+            const CardQuery textBlocks = CardQuery::Compile("TextBlock");
+            const auto selectIds = [&textBlocks, &parseResult]() {
+                std::string ids;
+                for (const auto element : textBlocks.Select(*parseResult))
+                {
+                    ids += element->GetId() + " ";
+                }
+                return ids;
+            };
+
+            // the re-parsed container and its item take their predecessors' places
+            patcher.ApplyJson(R"([{"op":"replace","path":"/body/1/items/0/text","value":"deux"}])", context);
+            const auto box = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            Assert::IsTrue(parseResult->GetElementById("box") == box);
+            Assert::IsTrue(parseResult->GetElementById("tb") == box->GetItems()[0]);
+            Assert::AreEqual("a tb "s, selectIds());
+            CardState state(parseResult);
+            Assert::IsTrue(state.SetIsVisible("tb", false));
+
+            // insertions and removals index the card again, in parse order
+            patcher.ApplyJson(R"([{"op":"add","path":"/body/1","value":{"type":"TextBlock","id":"mid","text":"x"}},
+                                  {"op":"remove","path":"/body/0"}])",
+                              context);
+            Assert::IsTrue(parseResult->GetElementById("a") == nullptr);
+            Assert::IsTrue(parseResult->GetElementById("mid") == card->GetBody()[0]);
+            Assert::AreEqual("mid tb "s, selectIds());
+
+            // a failed patch leaves the index as it was
+            ApplyError(patcher, R"([{"op":"replace","path":"/body/0/id","value":"renamed"},{"op":"remove","path":"/body/9"}])");
+            Assert::IsTrue(parseResult->GetElementById("mid") == card->GetBody()[0]);
+            Assert::IsTrue(parseResult->GetElementById("renamed") == nullptr);
+        }
+
+        TEST_METHOD(ContentHashFollowsPatches)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[)" + Text("", "a") +
+                                         R"(,{"type":"Container","items":[)" + Text("", "b") + "]}]}";
+            const auto parseResult = AdaptiveCard::DeserializeFromString(cardJson, "1.2");
+            const auto card = parseResult->GetAdaptiveCard();
+            CardPatcher patcher(parseResult);
+            ParseContext context;
+
+            patcher.ApplyJson(R"([{"op":"replace","path":"/body/0/text","value":"b"}])", context);
+            const std::string patchedJson = R"({"type":"AdaptiveCard","version":"1.2","body":[)" + Text("", "b") +
+                                            R"(,{"type":"Container","items":[)" + Text("", "b") + "]}]}";
+            Assert::IsTrue(AdaptiveCard::DeserializeFromString(patchedJson, "1.2")->GetContentHash() == parseResult->GetContentHash());
+            Assert::IsTrue(card->ComputeContentHash() == parseResult->GetContentHash());
+
+            // reading operations leave the card alone, even when they fail
+            const auto& constCard = static_cast<const AdaptiveCard&>(*card);
+            const auto cardStamp = card->GetChangeStamp();
+            const auto boxStamp = constCard.GetBody()[1]->GetChangeStamp();
+            const ContentHash patchedHash = parseResult->GetContentHash();
+            ApplyError(patcher, R"([{"op":"test","path":"/body/1/items/0/text","value":"c"}])");
+            patcher.ApplyJson(R"([{"op":"test","path":"/body/1/items/0/text","value":"b"}])", context);
+            Assert::AreEqual(cardStamp, card->GetChangeStamp());
+            Assert::AreEqual(boxStamp, constCard.GetBody()[1]->GetChangeStamp());
+            Assert::IsTrue(patchedHash == parseResult->GetContentHash());
+        }
+
+        TEST_METHOD(LargeFactSetPatchTime)
+        {
+            const size_t count = 2000;
+            std::string facts;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string n = std::to_string(i);
+                facts += (i == 0 ? R"({"title":"T)" : R"(,{"title":"T)") + n + R"(","value":"V)" + n + R"("})";
+            }
+            const auto factSet = [&facts](const std::string& from, const std::string& to) {
+                std::string json = R"({"type":"FactSet","facts":[)" + facts + "]}";
+                const auto position = json.find(from);
+                return json.replace(position, from.size(), to);
+            };
+
+            auto card = Parse(factSet("", ""));
+            CardPatcher patcher(card);
+            ParseContext context;
+            const std::string patch = R"([{"op":"replace","path":"/body/0/facts/1234/value","value":"changed"}])";
+            // the first patch counts the card's ids
+            patcher.ApplyJson(R"([{"op":"test","path":"/body/0/facts/0/title","value":"T0"}])", context);
+
+            const auto patchStart = std::chrono::steady_clock::now();
+            patcher.ApplyJson(patch, context);
+            const auto patchTime = std::chrono::steady_clock::now() - patchStart;
+            Assert::AreEqual(std::size_t{0}, patcher.GetLastStatistics().reparsedElements);
+            Assert::AreEqual(std::size_t{1}, patcher.GetLastStatistics().patchedFacts);
+            Assert::AreEqual("changed"s, std::static_pointer_cast<FactSet>(card->GetBody()[0])->GetFactView(1234).GetValue());
+
+            const auto parseStart = std::chrono::steady_clock::now();
+            const auto reparsed = Parse(factSet(R"("V1234")", R"("changed")"));
+            const auto parseTime = std::chrono::steady_clock::now() - parseStart;
+            Assert::AreEqual(reparsed->Serialize(), card->Serialize());
+
+            // a whole fact is inserted and removed without parsing the set either
+            patcher.ApplyJson(R"([{"op":"add","path":"/body/0/facts/0","value":{"title":"new","value":"fact"}},
+                                  {"op":"remove","path":"/body/0/facts/2000"}])",
+                              context);
+            Assert::AreEqual(std::size_t{2}, patcher.GetLastStatistics().patchedFacts);
+            Assert::AreEqual(count, std::static_pointer_cast<FactSet>(card->GetBody()[0])->GetFactCount());
+            Assert::AreEqual("new"s, std::static_pointer_cast<FactSet>(card->GetBody()[0])->GetFactView(0).GetTitle());
+
+            const auto micros = [](std::chrono::steady_clock::duration d) {
+                return std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(d).count()) + "us";
+            };
+            Logger::WriteMessage(("Patch of one fact in "s + std::to_string(count) + " facts: " + micros(patchTime) +
+                                  "; full parse: " + micros(parseTime))
+                                     .c_str());
+        }
+    };
+}
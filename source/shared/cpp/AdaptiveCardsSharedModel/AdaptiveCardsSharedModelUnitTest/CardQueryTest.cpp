@@ -0,0 +1,130 @@
+#include "stdafx.h"
+#include "CardQuery.h"
+#include "Container.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"Container","id":"form","style":"emphasis","items":[
+                {"type":"Input.Text","id":"name","inlineAction":{"type":"Action.Submit","id":"send"}},
+                {"type":"Container","id":"nested","items":[{"type":"Input.Number","id":"age"}]},
+                {"type":"Image","id":"logo","url":"http://a/logo.png","selectAction":{"type":"Action.OpenUrl","id":"open","url":"http://a"}}]},
+            {"type":"ColumnSet","id":"columns","columns":[{"type":"Column","id":"left","items":[
+                {"type":"Image","id":"plain","url":"http://a/plain.png"},
+                {"type":"Input.Toggle","id":"agree","title":"Agree","isVisible":false}]}]},
+            {"type":"Fancy","id":"fancy","fallback":{"type":"Input.Date","id":"fancy"}}],
+            "actions":[{"type":"Action.Submit","id":"submit"},
+                {"type":"Action.ShowCard","id":"more","card":{"type":"AdaptiveCard","body":[
+                    {"type":"Input.Time","id":"time"},
+                    {"type":"ActionSet","actions":[{"type":"Action.Submit","id":"innerSubmit"}]}]}}]})";
+
+        std::vector<std::string> Ids(const std::vector<BaseElement*>& elements)
+        {
+            std::vector<std::string> ids;
+            for (const auto element : elements)
+            {
+                ids.push_back(element->GetId());
+            }
+            return ids;
+        }
+
+        std::vector<std::string> Select(const std::string& selector)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            const CardQuery query = CardQuery::Compile(selector);
+
+            // the traversal and the parse-time type lists agree
+            const auto traversed = Ids(query.Select(*parseResult->GetAdaptiveCard()));
+            Assert::IsTrue(traversed == Ids(query.Select(*parseResult)));
+            return traversed;
+        }
+    }
+
+    TEST_CLASS(CardQueryTest)
+    {
+    public:
+        TEST_METHOD(TypeAndIdSelectors)
+        {
+            Assert::IsTrue(std::vector<std::string>{"logo", "plain"} == Select("Image"));
+            Assert::IsTrue(std::vector<std::string>{"name", "age", "agree", "fancy", "time"} == Select("Input.*"));
+            Assert::IsTrue(std::vector<std::string>{"send", "submit", "innerSubmit"} == Select("Action.Submit"));
+            Assert::IsTrue(std::vector<std::string>{"nested"} == Select("#nested"));
+            Assert::IsTrue(std::vector<std::string>{"age", "logo", "plain"} == Select("Input.Number, Image"));
+            Assert::IsTrue(Select("TextBlock").empty());
+            Assert::AreEqual<size_t>(18, Select("*").size());
+        }
+
+        TEST_METHOD(PropertyPredicates)
+        {
+            Assert::IsTrue(std::vector<std::string>{"logo"} == Select("Image[selectAction]"));
+            Assert::IsTrue(std::vector<std::string>{"agree"} == Select("[isVisible=false]"));
+            Assert::IsTrue(std::vector<std::string>{"form"} == Select("Container[style=emphasis]"));
+            Assert::IsTrue(std::vector<std::string>{"form"} == Select("Container[ style = 'emphasis' ]"));
+            Assert::IsTrue(std::vector<std::string>{"open"} == Select("[url=\"http://a\"]"));
+            Assert::IsTrue(std::vector<std::string>{"agree"} == Select("Input.Toggle#agree[title=Agree]"));
+            Assert::IsTrue(Select("Input.Toggle[title=Disagree]").empty());
+        }
+
+        TEST_METHOD(Combinators)
+        {
+            Assert::IsTrue(std::vector<std::string>{"name", "age"} == Select("#form Input.*"));
+            Assert::IsTrue(std::vector<std::string>{"name"} == Select("#form > Input.*"));
+            Assert::IsTrue(std::vector<std::string>{"age"} == Select("Container Container > Input.Number"));
+            Assert::IsTrue(std::vector<std::string>{"innerSubmit"} == Select("Action.ShowCard Action.Submit"));
+            Assert::IsTrue(std::vector<std::string>{"time"} == Select("Action.ShowCard > AdaptiveCard > Input.*"));
+            Assert::IsTrue(std::vector<std::string>{"left"} == Select("ColumnSet>Column"));
+            Assert::IsTrue(std::vector<std::string>{"open"} == Select("Image[selectAction] > *"));
+            Assert::IsTrue(std::vector<std::string>{"name", "agree"} == Select("ColumnSet Input.*, Container > Input.Text"));
+            Assert::IsTrue(Select("ColumnSet > Image").empty());
+        }
+
+        TEST_METHOD(SelectWithinElement)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+            auto form = std::static_pointer_cast<Container>(card->GetBody()[0]);
+
+            const CardQuery query = CardQuery::Compile("Input.*");
+            Assert::IsTrue(std::vector<std::string>{"name", "age"} == Ids(query.Select(*form)));
+            Assert::IsTrue(std::vector<std::string>{"form", "nested"} == Ids(CardQuery::Compile("Container").Select(*form)));
+        }
+
+        TEST_METHOD(ModifiedCardsUseTheTraversal)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            auto card = parseResult->GetAdaptiveCard();
+            card->GetBody().erase(card->GetBody().begin());
+
+            // removed elements drop out of the parse-time lists as well
+            const CardQuery query = CardQuery::Compile("Input.*");
+            Assert::IsTrue(std::vector<std::string>{"agree", "fancy", "time"} == Ids(query.Select(*parseResult)));
+
+            // added ones only show up through the traversal
+            card->GetBody().push_back(std::make_shared<Container>());
+            Assert::AreEqual<size_t>(1, CardQuery::Compile("Container").Select(*card).size());
+            Assert::AreEqual<size_t>(0, CardQuery::Compile("Container").Select(*parseResult).size());
+        }
+
+        TEST_METHOD(MalformedSelectorsThrow)
+        {
+            for (const auto& selector : {"", "Image >", "Image,", "#", "[", "[url", "[url=]", "[url='a]", "Image!", "> Image"})
+            {
+                try
+                {
+                    CardQuery::Compile(selector);
+                    Assert::Fail(L"expected an exception");
+                }
+                catch (const AdaptiveCardParseException& e)
+                {
+                    Assert::IsTrue(ErrorStatusCode::InvalidPropertyValue == e.GetStatusCode());
+                }
+            }
+        }
+    };
+}
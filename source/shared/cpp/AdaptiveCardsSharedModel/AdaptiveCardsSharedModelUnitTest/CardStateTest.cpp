@@ -0,0 +1,101 @@
+#include "stdafx.h"
+#include "CardState.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include "TextInput.h"
+#include "ToggleVisibilityAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"TextBlock","id":"title","text":"Title"},
+            {"type":"Container","id":"details","isVisible":false,"items":[
+                {"type":"TextBlock","id":"more","text":"More"},
+                {"type":"Image","url":"https://a.b/c.png","fallback":{"type":"TextBlock","text":"no image"}}]},
+            {"type":"Input.Text","id":"name","value":"Ada"},
+            {"type":"Input.Number","id":"count"}],
+            "actions":[{"type":"Action.ToggleVisibility","title":"Toggle","targetElements":["details",{"elementId":"title","isVisible":false},"missing"]}]})";
+
+        std::string VisibleIds(const CardState& state)
+        {
+            std::string ids;
+            for (const CardNode& node : state.VisibleElements())
+            {
+                const auto element = node.GetElement();
+                ids += (element->GetIdRef().empty() ? element->GetElementTypeStringRef() : element->GetIdRef()) + " ";
+            }
+            return ids;
+        }
+    }
+
+    TEST_CLASS(CardStateTest)
+    {
+    public:
+        TEST_METHOD(ToggleVisibility)
+        {
+            std::shared_ptr<const ParseResult> parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            parseResult->GetAdaptiveCard()->Freeze();
+            const std::shared_ptr<const AdaptiveCard> card = parseResult->GetAdaptiveCard();
+            const auto& toggle = static_cast<const ToggleVisibilityAction&>(*card->GetActions()[0]);
+
+            // two sessions share the frozen card
+            CardState first(parseResult);
+            CardState second(parseResult);
+            Assert::AreEqual("title name count "s, VisibleIds(first));
+
+            first.ApplyToggle(toggle);
+            Assert::AreEqual("details more Image name count "s, VisibleIds(first));
+            Assert::IsTrue(first.IsVisible("details"));
+            Assert::IsFalse(first.IsVisible(*card->GetBody()[0]));
+            Assert::AreEqual("title name count "s, VisibleIds(second));
+            Assert::IsFalse(card->GetBody()[1]->GetIsVisible());
+
+            // details toggles back, while title stays hidden
+            first.ApplyToggle(toggle);
+            Assert::AreEqual("name count "s, VisibleIds(first));
+
+            Assert::IsTrue(second.SetIsVisible("more", false));
+            Assert::IsTrue(second.SetIsVisible("details", true));
+            Assert::IsFalse(second.SetIsVisible("missing", true));
+            Assert::AreEqual("title details Image name count "s, VisibleIds(second));
+            second.Clear();
+            Assert::AreEqual("title name count "s, VisibleIds(second));
+        }
+
+        TEST_METHOD(InputValues)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+            const auto& name = static_cast<const TextInput&>(*card->GetBody()[2]);
+            const auto& count = static_cast<const BaseInputElement&>(*card->GetBody()[3]);
+
+            // a state made from a card looks ids up by walking it
+            CardState state(card);
+            Assert::AreEqual("Ada"s, state.GetInputValue(name));
+            Assert::AreEqual(""s, state.GetInputValue(count));
+            Assert::IsTrue(state.FindInputValue("name") == nullptr);
+
+            state.SetInputValue(name, "Grace");
+            state.SetInputValue("count", "3");
+            Assert::AreEqual("Grace"s, state.GetInputValue(name));
+            Assert::AreEqual("3"s, state.GetInputValue(count));
+            Assert::AreEqual("Ada"s, name.GetValueRef());
+            Assert::AreEqual(std::size_t{2}, state.GetInputValues().size());
+
+            // copies are independent
+            CardState copy = state;
+            copy.ClearInputValue("name");
+            Assert::AreEqual("Ada"s, copy.GetInputValue(name));
+            Assert::AreEqual("Grace"s, state.GetInputValue(name));
+
+            Assert::IsTrue(state.SetIsVisible("details", true));
+            Assert::IsTrue(state.IsVisible("more"));
+            Assert::IsFalse(copy.IsVisible("details"));
+        }
+    };
+}
@@ -0,0 +1,201 @@
+#include "stdafx.h"
+#include "CardTraversal.h"
+#include "Container.h"
+#include "Image.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"Container","selectAction":{"type":"Action.Submit","title":"select"},"items":[
+                {"type":"TextBlock","text":"first"},
+                {"type":"Image","url":"http://a/b.png","selectAction":{"type":"Action.OpenUrl","url":"http://a"}}]},
+            {"type":"ColumnSet","columns":[{"type":"Column","items":[{"type":"Input.Text","id":"name",
+                "inlineAction":{"type":"Action.Submit","title":"inline"}}]}]},
+            {"type":"Unknown","fallback":{"type":"TextBlock","text":"fallback"}}],
+            "actions":[{"type":"Action.ShowCard","title":"more","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"inner"}]}}]})";
+
+        std::string Describe(const CardNode& node)
+        {
+            std::string description = std::to_string(node.GetDepth()) + ":";
+            switch (node.GetKind())
+            {
+            case CardNodeKind::Card:
+                description += "AdaptiveCard";
+                break;
+            default:
+                description += node.GetElement()->GetElementTypeString();
+                break;
+            }
+            return description + (node.IsFallback() ? "(fallback)" : "");
+        }
+
+        class CountingVisitor : public CardVisitor
+        {
+        public:
+            using CardVisitor::Visit;
+
+            bool Visit(TextBlock& textBlock) override
+            {
+                textBlocks.push_back(textBlock.GetText());
+                return true;
+            }
+
+            bool Visit(BaseActionElement&) override
+            {
+                ++actions;
+                return true;
+            }
+
+            bool Visit(Container&) override { return visitContainerItems; }
+
+            std::vector<std::string> textBlocks;
+            unsigned int actions = 0;
+            bool visitContainerItems = true;
+        };
+    }
+
+    TEST_CLASS(CardTraversalTest)
+    {
+    public:
+        TEST_METHOD(PreOrderCoversTheWholeGraph)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+
+            std::vector<std::string> visited;
+            for (const CardNode& node : PreOrder(*card))
+            {
+                visited.push_back(Describe(node));
+            }
+
+            const std::vector<std::string> expected{"0:AdaptiveCard",
+                                                    "1:Container",
+                                                    "2:TextBlock",
+                                                    "2:Image",
+                                                    "3:Action.OpenUrl",
+                                                    "2:Action.Submit",
+                                                    "1:ColumnSet",
+                                                    "2:Column",
+                                                    "3:Input.Text",
+                                                    "4:Action.Submit",
+                                                    "1:Unknown",
+                                                    "2:TextBlock(fallback)",
+                                                    "1:Action.ShowCard",
+                                                    "2:AdaptiveCard",
+                                                    "3:TextBlock"};
+            Assert::IsTrue(expected == visited);
+        }
+
+        TEST_METHOD(PostOrderVisitsChildrenFirst)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+
+            std::vector<std::string> visited;
+            for (const CardNode& node : PostOrder(*std::static_pointer_cast<Container>(card->GetBody()[0])))
+            {
+                visited.push_back(Describe(node));
+            }
+
+            const std::vector<std::string> expected{"1:TextBlock", "2:Action.OpenUrl", "1:Image", "1:Action.Submit", "0:Container"};
+            Assert::IsTrue(expected == visited);
+        }
+
+        TEST_METHOD(SkipChildrenPrunesSubtree)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+
+            size_t count = 0;
+            auto range = PreOrder(*card);
+            for (auto it = range.begin(); it != range.end(); ++it)
+            {
+                ++count;
+                if (it->GetKind() != CardNodeKind::Card)
+                {
+                    it.SkipChildren();
+                }
+            }
+
+            // the card, its four top-level elements and actions, and nothing below them
+            Assert::AreEqual<size_t>(5, count);
+        }
+
+        TEST_METHOD(VisitorDispatchesByType)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+
+            CountingVisitor visitor;
+            VisitCard(*card, visitor);
+            Assert::IsTrue(std::vector<std::string>{"first", "fallback", "inner"} == visitor.textBlocks);
+            Assert::AreEqual(4u, visitor.actions);
+
+            CountingVisitor pruningVisitor;
+            pruningVisitor.visitContainerItems = false;
+            VisitCard(*card, pruningVisitor);
+            Assert::IsTrue(std::vector<std::string>{"fallback", "inner"} == pruningVisitor.textBlocks);
+            Assert::AreEqual(2u, pruningVisitor.actions);
+        }
+
+        TEST_METHOD(DeepCardsDoNotRecurse)
+        {
+            constexpr size_t depth = 20000;
+            auto card = std::make_shared<AdaptiveCard>();
+            auto outer = std::make_shared<Container>();
+            card->GetBody().push_back(outer);
+            auto current = outer;
+            for (size_t i = 1; i < depth; ++i)
+            {
+                auto next = std::make_shared<Container>();
+                current->GetItems().push_back(next);
+                current = next;
+            }
+            current->GetItems().push_back(std::make_shared<TextBlock>());
+
+            size_t preOrderCount = 0;
+            unsigned int maxDepth = 0;
+            for (const CardNode& node : PreOrder(*card))
+            {
+                ++preOrderCount;
+                maxDepth = std::max(maxDepth, node.GetDepth());
+            }
+
+            size_t postOrderCount = 0;
+            for (const CardNode& node : PostOrder(*card))
+            {
+                if (postOrderCount++ == 0)
+                {
+                    Assert::IsTrue(CardElementType::TextBlock == node.GetCardElementType());
+                }
+            }
+
+            Assert::AreEqual(depth + 2, preOrderCount);
+            Assert::AreEqual(depth + 2, postOrderCount);
+            Assert::AreEqual(static_cast<unsigned int>(depth + 1), maxDepth);
+
+            // release the chain from the bottom up so that destruction doesn't recurse either
+            std::vector<std::shared_ptr<Container>> chain;
+            for (auto container = outer; container != nullptr;)
+            {
+                chain.push_back(container);
+                auto& items = container->GetItems();
+                container = (items.empty() || items[0]->GetElementType() != CardElementType::Container) ?
+                    nullptr :
+                    std::static_pointer_cast<Container>(items[0]);
+            }
+            card->GetBody().clear();
+            outer.reset();
+            current.reset();
+            while (!chain.empty())
+            {
+                chain.back()->GetItems().clear();
+                chain.pop_back();
+            }
+        }
+    };
+}
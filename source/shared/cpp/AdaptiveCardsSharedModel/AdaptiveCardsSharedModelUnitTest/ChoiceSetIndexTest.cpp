@@ -0,0 +1,158 @@
+#include "stdafx.h"
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        std::string MakeCard(size_t count, const std::string& value, bool isMultiSelect)
+        {
+            std::string choices;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string n = std::to_string(i);
+                choices += (i == 0 ? "" : ",") + R"({"title":"Item )"s + n + R"(","value":"v)" + n + R"("})";
+            }
+            return R"({"type":"AdaptiveCard","version":"1.2","body":[{"type":"Input.ChoiceSet","id":"choice","isMultiSelect":)" +
+                   (isMultiSelect ? "true"s : "false"s) + R"(,"value":")" + value + R"(","choices":[)" + choices + "]}]}";
+        }
+
+        std::shared_ptr<ChoiceSetInput> Parse(const std::string& json, size_t indexThreshold)
+        {
+            ParseContext context;
+            context.SetChoiceIndexThreshold(indexThreshold);
+            auto card = AdaptiveCard::DeserializeFromString(json, "1.2", context)->GetAdaptiveCard();
+            return std::static_pointer_cast<ChoiceSetInput>(card->GetBody()[0]);
+        }
+
+        void ExpectSameAnswers(const ChoiceSetInput& indexed, const ChoiceSetInput& linear)
+        {
+            for (const auto& value : {"v0"s, "v7"s, "v19"s, "v20"s, ""s, "V7"s})
+            {
+                Assert::AreEqual(linear.FindChoiceByValue(value), indexed.FindChoiceByValue(value));
+                Assert::AreEqual(linear.IsValueSelected(value), indexed.IsValueSelected(value));
+            }
+            for (const auto& prefix : {"item 1"s, "ITEM 1"s, ""s, "Item 19"s, "Item 190"s, "x"s})
+            {
+                Assert::IsTrue(linear.FindChoicesByTitlePrefix(prefix) == indexed.FindChoicesByTitlePrefix(prefix));
+            }
+            for (const auto& value : {"v1"s, "v1,v2"s, ""s, "v1,nope"s, "nope"s})
+            {
+                Assert::AreEqual(linear.IsValidValue(value), indexed.IsValidValue(value));
+            }
+        }
+    }
+
+    TEST_CLASS(ChoiceSetIndexTest)
+    {
+    public:
+        TEST_METHOD(IndexIsBuiltFromTheThreshold)
+        {
+            const std::string json = MakeCard(20, "v3,v7", true);
+            Assert::IsFalse(Parse(json, 0)->HasChoiceIndex());
+            Assert::IsFalse(Parse(json, 21)->HasChoiceIndex());
+            Assert::IsTrue(Parse(json, 20)->HasChoiceIndex());
+        }
+
+        TEST_METHOD(IndexedAndLinearQueriesAgree)
+        {
+            const std::string json = MakeCard(20, "v3,v7", true);
+            auto indexed = Parse(json, 1);
+            auto linear = Parse(json, 0);
+            ExpectSameAnswers(*indexed, *linear);
+
+            Assert::AreEqual<size_t>(7, indexed->FindChoiceByValue("v7"));
+            Assert::AreEqual(ChoiceSetIndex::NoChoice, indexed->FindChoiceByValue("v20"));
+            const std::vector<size_t> expected{1, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+            Assert::IsTrue(expected == indexed->FindChoicesByTitlePrefix("iTeM 1"));
+            Assert::IsTrue(indexed->IsValueSelected("v7"));
+            Assert::IsFalse(indexed->IsValueSelected("v3,v7"));
+            Assert::IsTrue(indexed->IsValidValue("v1,v2"));
+            Assert::IsFalse(indexed->IsValidValue("v1,nope"));
+
+            // a single-select set accepts at most one value
+            indexed->SetIsMultiSelect(false);
+            linear->SetIsMultiSelect(false);
+            Assert::IsFalse(indexed->IsValidValue("v1,v2"));
+            ExpectSameAnswers(*indexed, *linear);
+
+            indexed->SetValue("v19");
+            linear->SetValue("v19");
+            Assert::IsTrue(indexed->IsValueSelected("v19"));
+            Assert::IsFalse(indexed->IsValueSelected("v7"));
+            ExpectSameAnswers(*indexed, *linear);
+        }
+
+        TEST_METHOD(ModifyingChoicesDropsTheIndex)
+        {
+            auto choiceSet = Parse(MakeCard(5, "v1", false), 1);
+            auto copy = std::static_pointer_cast<ChoiceSetInput>(choiceSet->Clone());
+            Assert::IsTrue(copy->HasChoiceIndex());
+
+            auto& choices = choiceSet->GetChoices();
+            Assert::IsFalse(choiceSet->HasChoiceIndex());
+            choices[0]->SetValue("first");
+            Assert::AreEqual<size_t>(0, choiceSet->FindChoiceByValue("first"));
+            Assert::IsTrue(choiceSet->IsValueSelected("v1"));
+
+            choiceSet->BuildChoiceIndex();
+            Assert::AreEqual<size_t>(0, choiceSet->FindChoiceByValue("first"));
+            Assert::AreEqual(ChoiceSetIndex::NoChoice, choiceSet->FindChoiceByValue("v0"));
+
+            // the copy keeps its own index of the original choices
+            Assert::IsTrue(copy->HasChoiceIndex());
+            Assert::AreEqual<size_t>(0, copy->FindChoiceByValue("v0"));
+
+            // freezing keeps the index
+            copy->Freeze();
+            Assert::IsTrue(copy->HasChoiceIndex());
+            Assert::AreEqual<size_t>(5, static_cast<const ChoiceSetInput&>(*copy).GetChoices().size());
+            Assert::IsTrue(copy->HasChoiceIndex());
+        }
+
+        TEST_METHOD(LargeChoiceSetQueryTimes)
+        {
+            const size_t choiceCount = 10000;
+            const size_t queries = 1000;
+            std::string value;
+            for (size_t i = 0; i < 100; ++i)
+            {
+                value += (i == 0 ? "v"s : ",v"s) + std::to_string(i * 97);
+            }
+            const std::string json = MakeCard(choiceCount, value, true);
+            auto indexed = Parse(json, 1000);
+            auto linear = Parse(json, 0);
+
+            const auto time = [&](const ChoiceSetInput& choiceSet) {
+                size_t found = 0;
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < queries; ++i)
+                {
+                    const std::string n = std::to_string((i * 7919) % choiceCount);
+                    found += choiceSet.FindChoicesByTitlePrefix("item " + n).size();
+                    found += choiceSet.IsValidValue(value) ? 1 : 0;
+                    found += choiceSet.IsValueSelected("v" + n) ? 1 : 0;
+                }
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+                return std::make_pair(found, std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+            };
+
+            const auto indexedResult = time(*indexed);
+            const auto linearResult = time(*linear);
+            Assert::AreEqual(linearResult.first, indexedResult.first);
+
+            Logger::WriteMessage(("Choice set queries on "s + std::to_string(choiceCount) + " choices, per query: indexed " +
+                                  std::to_string(indexedResult.second / queries) + "us, linear " +
+                                  std::to_string(linearResult.second / queries) + "us")
+                                     .c_str());
+        }
+    };
+}
@@ -0,0 +1,135 @@
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "ChoiceSetInput.h"
+#include "ChoiceInput.h"
+#include "ColumnSet.h"
+#include "Column.h"
+#include "Container.h"
+#include "ParseResult.h"
+#include "RichTextBlock.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(CloneTest)
+    {
+    public:
+        TEST_METHOD(ClonedCardSerializesIdentically)
+        {
+            auto original = AdaptiveCard::DeserializeFromFile("EverythingBagel.json", "1.2")->GetAdaptiveCard();
+            auto clone = original->Clone();
+
+            Assert::IsTrue(clone != original);
+            Assert::AreEqual(original->Serialize(), clone->Serialize());
+            Assert::IsTrue(original->ComputeContentHash() == clone->ComputeContentHash());
+        }
+
+        TEST_METHOD(CloneIsIndependentOfOriginal)
+        {
+            std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","id":"outer","selectAction":{"type":"Action.Submit","title":"go"},"items":[
+                    {"type":"TextBlock","id":"greeting","text":"Hello","unknownProperty":"kept"}]},
+                {"type":"ColumnSet","columns":[{"type":"Column","items":[{"type":"Input.ChoiceSet","id":"choice",
+                    "choices":[{"title":"a","value":"1"}]}]}]},
+                {"type":"RichTextBlock","paragraphs":[{"inlines":[{"type":"TextRun","text":"rich"}]}]}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"inner"}]}}]})";
+            auto original = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            const std::string originalJson = original->Serialize();
+
+            auto clone = original->Clone();
+            auto container = std::static_pointer_cast<Container>(clone->GetBody()[0]);
+            auto textBlock = std::static_pointer_cast<TextBlock>(container->GetItems()[0]);
+            auto column = std::static_pointer_cast<ColumnSet>(clone->GetBody()[1])->GetColumns()[0];
+            auto choiceSet = std::static_pointer_cast<ChoiceSetInput>(column->GetItems()[0]);
+            auto richText = std::static_pointer_cast<RichTextBlock>(clone->GetBody()[2]);
+            auto showCard = std::static_pointer_cast<ShowCardAction>(clone->GetActions()[0]);
+
+            // identity and extra properties carry over
+            auto originalContainer = std::static_pointer_cast<Container>(original->GetBody()[0]);
+            Assert::IsTrue(container->GetInternalId() == originalContainer->GetInternalId());
+            Assert::IsTrue(textBlock->GetInternalId() == originalContainer->GetItems()[0]->GetInternalId());
+            Assert::AreEqual(std::string("kept"), textBlock->GetAdditionalProperties()["unknownProperty"].asString());
+
+            // nothing is shared
+            Assert::IsTrue(container != originalContainer);
+            Assert::IsTrue(container->GetSelectAction() != originalContainer->GetSelectAction());
+            Assert::IsTrue(showCard->GetCard() != std::static_pointer_cast<ShowCardAction>(original->GetActions()[0])->GetCard());
+
+            textBlock->SetText("Goodbye");
+            container->GetSelectAction()->SetTitle("stop");
+            choiceSet->GetChoices()[0]->SetTitle("b");
+            std::static_pointer_cast<TextRun>(richText->GetParagraphs()[0]->GetInlines()[0])->SetText("plain");
+            showCard->GetCard()->GetBody().clear();
+
+            Assert::AreEqual(originalJson, original->Serialize());
+            Assert::AreNotEqual(originalJson, clone->Serialize());
+        }
+
+        TEST_METHOD(CloneCopiesFallbackAndUnfreezes)
+        {
+            std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","items":[],"fallback":{"type":"TextBlock","text":"fallback"}}]})";
+            auto original = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            original->Freeze();
+            const auto& frozen = static_cast<const AdaptiveCard&>(*original);
+
+            auto clone = original->Clone();
+            auto fallback = clone->GetBody()[0]->GetFallbackContent();
+
+            Assert::IsFalse(clone->IsFrozen());
+            Assert::IsFalse(clone->GetBody()[0]->IsFrozen());
+            Assert::IsFalse(fallback->IsFrozen());
+            Assert::IsTrue(fallback != frozen.GetBody()[0]->GetFallbackContent());
+            Assert::IsTrue(fallback->GetInternalId() == frozen.GetBody()[0]->GetFallbackContent()->GetInternalId());
+
+            std::static_pointer_cast<TextBlock>(fallback)->SetText("changed");
+            Assert::AreEqual(std::string("fallback"),
+                             std::static_pointer_cast<TextBlock>(frozen.GetBody()[0]->GetFallbackContent())->GetText());
+        }
+
+        TEST_METHOD(ClonedToggleTargetsReferToCopies)
+        {
+            std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"TextBlock","id":"details","text":"more"},
+                {"type":"ActionSet","actions":[{"type":"Action.ToggleVisibility","targetElements":["details"]}]}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[],
+                    "actions":[{"type":"Action.ToggleVisibility","targetElements":["details"]}]}}]})";
+            auto original = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            const auto targetOf = [](const std::shared_ptr<BaseActionElement>& action) {
+                return std::static_pointer_cast<ToggleVisibilityAction>(action)->GetTargetElements()[0]->GetElement();
+            };
+
+            auto clone = original->Clone();
+            auto actionSet = std::static_pointer_cast<ActionSet>(clone->GetBody()[1]);
+            auto showCard = std::static_pointer_cast<ShowCardAction>(clone->GetActions()[0]);
+            Assert::IsTrue(targetOf(actionSet->GetActions()[0]) == clone->GetBody()[0]);
+            Assert::IsTrue(targetOf(showCard->GetCard()->GetActions()[0]) == clone->GetBody()[0]);
+            Assert::IsTrue(targetOf(std::static_pointer_cast<ActionSet>(original->GetBody()[1])->GetActions()[0]) == original->GetBody()[0]);
+
+            // a target whose element wasn't copied along with it refers to nothing
+            auto actionSetCopy = std::static_pointer_cast<ActionSet>(original->GetBody()[1]->Clone());
+            Assert::IsTrue(targetOf(actionSetCopy->GetActions()[0]) == nullptr);
+        }
+
+        TEST_METHOD(CustomElementsWithoutCloneThrow)
+        {
+            auto custom = std::make_shared<BaseCardElement>(CardElementType::Custom);
+            try
+            {
+                custom->Clone();
+                Assert::Fail(L"Cloning an element without a Clone() override should throw");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::CloneNotSupported == e.GetStatusCode());
+            }
+        }
+    };
+}
@@ -0,0 +1,135 @@
+#include "stdafx.h"
+#include "AdaptiveCardParseException.h"
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        std::string MakeCard(size_t count)
+        {
+            std::string facts;
+            std::string choices;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string n = std::to_string(i);
+                facts += (i == 0 ? "" : ",") + R"({"title":"Fact title )"s + n + R"(","value":"Fact value )" + n + R"("})";
+                choices += (i == 0 ? "" : ",") + R"({"title":"Choice )"s + n + R"(","value":")" + n + R"("})";
+            }
+            return R"({"type":"AdaptiveCard","version":"1.2","lang":"de","body":[{"type":"FactSet","facts":[)" + facts +
+                   R"(]},{"type":"Input.ChoiceSet","id":"choice","choices":[)" + choices + "]}]}";
+        }
+
+        std::shared_ptr<AdaptiveCard> Parse(const std::string& json)
+        {
+            return AdaptiveCard::DeserializeFromString(json, "1.2")->GetAdaptiveCard();
+        }
+    }
+
+    TEST_CLASS(ColumnarCollectionsTest)
+    {
+    public:
+        TEST_METHOD(ViewsReadParsedItems)
+        {
+            auto card = Parse(MakeCard(2000));
+            auto factSet = std::static_pointer_cast<FactSet>(card->GetBody()[0]);
+            auto choiceSet = std::static_pointer_cast<ChoiceSetInput>(card->GetBody()[1]);
+
+            Assert::AreEqual<size_t>(2000, factSet->GetFactCount());
+            Assert::AreEqual("Fact title 1234"s, factSet->GetFactView(1234).GetTitle());
+            Assert::AreEqual("Fact value 1234"s, factSet->GetFactView(1234).GetValue());
+            Assert::AreEqual("Fact value 1999"s, std::string(factSet->GetFactView(1999).GetValueData()));
+            Assert::AreEqual("de"s, factSet->GetFactLanguageRef(0));
+
+            Assert::AreEqual<size_t>(2000, choiceSet->GetChoiceCount());
+            Assert::AreEqual("Choice 0"s, choiceSet->GetChoiceView(0).GetTitle());
+            Assert::AreEqual<size_t>(3, choiceSet->GetChoiceView(999).GetValueLength());
+        }
+
+        TEST_METHOD(MaterializedItemsMatchTheColumns)
+        {
+            const std::string json = MakeCard(50);
+            auto card = Parse(json);
+            auto factSet = std::static_pointer_cast<FactSet>(card->GetBody()[0]);
+            auto choiceSet = std::static_pointer_cast<ChoiceSetInput>(card->GetBody()[1]);
+            const std::string columnarJson = card->Serialize();
+
+            const auto& facts = static_cast<const FactSet&>(*factSet).GetFacts();
+            Assert::AreEqual<size_t>(50, facts.size());
+            Assert::AreEqual("Fact title 7"s, facts[7]->GetTitle());
+            Assert::AreEqual("de"s, facts[7]->GetLanguage());
+            // const access makes read-only facts alongside the columns, once
+            Assert::IsTrue(facts[7] == static_cast<const FactSet&>(*factSet).GetFacts()[7]);
+            try
+            {
+                facts[7]->SetTitle("changed");
+                Assert::Fail(L"Facts read through const access can't be modified");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::FrozenObjectModification == e.GetStatusCode());
+            }
+            Assert::AreEqual<size_t>(50, choiceSet->GetChoices().size());
+            Assert::AreEqual("7"s, choiceSet->GetChoices()[7]->GetValue());
+
+            // the non-const accessors materialize, after which the views and the serialized form read the items
+            Assert::AreEqual(columnarJson, card->Serialize());
+            factSet->GetFacts()[7]->SetTitle("changed");
+            choiceSet->GetChoices().pop_back();
+            Assert::AreEqual("changed"s, factSet->GetFactView(7).GetTitle());
+            Assert::AreEqual<size_t>(49, choiceSet->GetChoiceCount());
+            Assert::AreNotEqual(columnarJson, card->Serialize());
+        }
+
+        TEST_METHOD(CopiesAndFreezing)
+        {
+            auto card = Parse(MakeCard(10));
+            auto factSet = std::static_pointer_cast<FactSet>(card->GetBody()[0]);
+            const std::string json = factSet->Serialize();
+
+            // copies of columnar sets are independent
+            auto clone = std::static_pointer_cast<FactSet>(factSet->Clone());
+            clone->GetFacts()[0]->SetValue("changed");
+            Assert::AreEqual("Fact value 0"s, factSet->GetFactView(0).GetValue());
+            Assert::AreEqual(json, factSet->Serialize());
+
+            // frozen sets stay columnar, and their const accessors write only to what they make
+            card->Freeze();
+            Assert::AreEqual<size_t>(10, static_cast<const FactSet&>(*factSet).GetFacts().size());
+            Assert::AreEqual(json, factSet->Serialize());
+        }
+
+        TEST_METHOD(ItemsAreStillValidated)
+        {
+            for (const auto& json : {R"({"type":"FactSet","facts":[{"title":"a"}]})",
+                                     R"({"type":"Input.ChoiceSet","id":"c","choices":[{"value":"a"}]})"})
+            {
+                try
+                {
+                    Parse(R"({"type":"AdaptiveCard","version":"1.2","body":[)"s + json + "]}");
+                    Assert::Fail(L"expected an exception");
+                }
+                catch (const AdaptiveCardParseException& e)
+                {
+                    Assert::IsTrue(ErrorStatusCode::RequiredPropertyMissing == e.GetStatusCode());
+                }
+            }
+
+            // empty strings are kept apart from their neighbours
+            auto card = Parse(R"({"type":"AdaptiveCard","version":"1.2","body":[{"type":"FactSet","facts":[
+                {"title":"","value":""},{"title":"x","value":""}]}]})");
+            auto factSet = std::static_pointer_cast<FactSet>(card->GetBody()[0]);
+            Assert::AreEqual<size_t>(0, factSet->GetFactView(0).GetTitleLength());
+            Assert::AreEqual("x"s, factSet->GetFactView(1).GetTitle());
+            Assert::AreEqual(""s, factSet->GetFactView(1).GetValue());
+        }
+    };
+}
@@ -0,0 +1,88 @@
+#include "stdafx.h"
+#include "ContentHash.h"
+#include "ParseResult.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(ContentHashTest)
+    {
+    public:
+        TEST_METHOD(KeyOrderAndWhitespaceDoNotAffectHash)
+        {
+            std::string first = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"Hello","size":"large"}]})";
+            std::string second = R"({
+                "body": [ { "size": "large", "text": "Hello", "type": "TextBlock" } ],
+                "version": "1.0",
+                "type": "AdaptiveCard"
+            })";
+
+            auto firstResult = AdaptiveCard::DeserializeFromString(first, "1.0");
+            auto secondResult = AdaptiveCard::DeserializeFromString(second, "1.0");
+
+            Assert::IsFalse(firstResult->GetContentHash().IsEmpty());
+            Assert::IsTrue(firstResult->GetContentHash() == secondResult->GetContentHash());
+            Assert::AreEqual(firstResult->GetAdaptiveCard()->SerializeToCanonicalString(),
+                             secondResult->GetAdaptiveCard()->SerializeToCanonicalString());
+        }
+
+        TEST_METHOD(ExplicitDefaultsDoNotAffectHash)
+        {
+            std::string implicitDefaults = R"({"type":"AdaptiveCard","version":"1.0",
+                "body":[{"type":"TextBlock","text":"Hello"}],
+                "actions":[{"type":"Action.Submit","title":"Go"}]})";
+            std::string explicitDefaults = R"({"type":"AdaptiveCard","version":"1.0",
+                "body":[{"type":"TextBlock","text":"Hello","wrap":false,"isVisible":true,"spacing":"default","separator":false,"weight":"Default"}],
+                "actions":[{"type":"Action.Submit","title":"Go","sentiment":"default"}]})";
+
+            auto implicitResult = AdaptiveCard::DeserializeFromString(implicitDefaults, "1.0");
+            auto explicitResult = AdaptiveCard::DeserializeFromString(explicitDefaults, "1.0");
+
+            Assert::IsTrue(implicitResult->GetContentHash() == explicitResult->GetContentHash());
+        }
+
+        TEST_METHOD(DifferentContentHashesDifferently)
+        {
+            std::string first = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"Hello"}]})";
+            std::string second = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"Hello!"}]})";
+            std::string third = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"Hello","wrap":true}]})";
+
+            auto firstHash = AdaptiveCard::DeserializeFromString(first, "1.0")->GetContentHash();
+            auto secondHash = AdaptiveCard::DeserializeFromString(second, "1.0")->GetContentHash();
+            auto thirdHash = AdaptiveCard::DeserializeFromString(third, "1.0")->GetContentHash();
+
+            Assert::IsTrue(firstHash != secondHash);
+            Assert::IsTrue(firstHash != thirdHash);
+            Assert::IsTrue(secondHash != thirdHash);
+        }
+
+        TEST_METHOD(HasherIsIndependentOfChunking)
+        {
+            const std::string input = "The quick brown fox jumps over the lazy dog";
+
+            ContentHasher whole;
+            whole.Append(input.data(), input.size());
+
+            ContentHasher pieces;
+            for (size_t i = 0; i < input.size(); i += 5)
+            {
+                pieces.Append(input.data() + i, std::min<size_t>(5, input.size() - i));
+            }
+
+            Assert::IsTrue(whole.Finish() == pieces.Finish());
+            Assert::AreEqual<size_t>(32, whole.Finish().ToString().size());
+        }
+
+        TEST_METHOD(NumbersHashByValue)
+        {
+            Json::Value asInt = ParseUtil::GetJsonValueFromString(R"({"value":1})");
+            Json::Value asReal = ParseUtil::GetJsonValueFromString(R"({"value":1.0})");
+            Json::Value asString = ParseUtil::GetJsonValueFromString(R"({"value":"1"})");
+
+            Assert::IsTrue(ContentHashUtil::HashJson(asInt) == ContentHashUtil::HashJson(asReal));
+            Assert::IsTrue(ContentHashUtil::HashJson(asInt) != ContentHashUtil::HashJson(asString));
+        }
+    };
+}
@@ -0,0 +1,150 @@
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "BackgroundImage.h"
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateInput.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "NumberInput.h"
+#include "OpenUrlAction.h"
+#include "Paragraph.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "ToggleVisibilityAction.h"
+#include "UnknownAction.h"
+#include "UnknownElement.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        // Upper bounds on sizeof, in bytes, so that an element type only grows deliberately: raise its bound along
+        // with it. The bounds are the sizes measured on 64-bit builds against libstdc++ without its debug mode, and
+        // they're only checked there; other standard libraries and ABIs lay the members out differently.
+        struct FootprintBound
+        {
+            const wchar_t* name;
+            size_t size;
+            size_t limit;
+        };
+    }
+
+    TEST_CLASS(ElementFootprintTest)
+    {
+    public:
+        TEST_METHOD(ElementSizes)
+        {
+#if defined(__GLIBCXX__) && defined(__LP64__) && !defined(_GLIBCXX_DEBUG)
+            const FootprintBound bounds[] = {
+                {L"BaseElement", sizeof(BaseElement), 176},
+                {L"BaseCardElement", sizeof(BaseCardElement), 184},
+                {L"BaseActionElement", sizeof(BaseActionElement), 280},
+                {L"BaseInputElement", sizeof(BaseInputElement), 184},
+                {L"CollectionTypeElement", sizeof(CollectionTypeElement), 232},
+                {L"TextElementProperties", sizeof(TextElementProperties), 72},
+                {L"ActionSet", sizeof(ActionSet), 216},
+                {L"ChoiceSetInput", sizeof(ChoiceSetInput), 392},
+                {L"Column", sizeof(Column), 296},
+                {L"ColumnSet", sizeof(ColumnSet), 272},
+                {L"Container", sizeof(Container), 256},
+                {L"DateInput", sizeof(DateInput), 312},
+                {L"FactSet", sizeof(FactSet), 312},
+                {L"Image", sizeof(Image), 328},
+                {L"ImageSet", sizeof(ImageSet), 216},
+                {L"Media", sizeof(Media), 272},
+                {L"NumberInput", sizeof(NumberInput), 232},
+                {L"RichTextBlock", sizeof(RichTextBlock), 216},
+                {L"TextBlock", sizeof(TextBlock), 264},
+                {L"TextInput", sizeof(TextInput), 280},
+                {L"TimeInput", sizeof(TimeInput), 312},
+                {L"ToggleInput", sizeof(ToggleInput), 320},
+                {L"UnknownElement", sizeof(UnknownElement), 184},
+                {L"OpenUrlAction", sizeof(OpenUrlAction), 312},
+                {L"ShowCardAction", sizeof(ShowCardAction), 296},
+                {L"SubmitAction", sizeof(SubmitAction), 320},
+                {L"ToggleVisibilityAction", sizeof(ToggleVisibilityAction), 304},
+                {L"UnknownAction", sizeof(UnknownAction), 280},
+                {L"BackgroundImage", sizeof(BackgroundImage), 72},
+                {L"ChoiceInput", sizeof(ChoiceInput), 88},
+                {L"Fact", sizeof(Fact), 120},
+                {L"Inline", sizeof(Inline), 88},
+                {L"MediaSource", sizeof(MediaSource), 96},
+                {L"Paragraph", sizeof(Paragraph), 104},
+                {L"TextRun", sizeof(TextRun), 176},
+            };
+            for (const auto& bound : bounds)
+            {
+                Assert::IsTrue(bound.size <= bound.limit, (std::wstring(bound.name) + L" takes " + std::to_wstring(bound.size) + L" bytes").c_str());
+            }
+#endif
+        }
+
+        TEST_METHOD(UnknownPropertiesAreStillCollected)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"TextBlock","text":"hi","size":"large","spacing":"large","wrap":true,"extra":1},
+                {"type":"Container","style":"emphasis","items":[],"extra":2},
+                {"type":"RichTextBlock","paragraphs":[{"inlines":[{"type":"TextRun","text":"run","weight":"bolder","extra":3}],"extra":5}]}],
+                "actions":[{"type":"Action.Submit","title":"go","data":{},"extra":4}]})";
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+
+            const auto expectOnlyExtra = [](const Json::Value& additionalProperties, int extra) {
+                Assert::AreEqual<size_t>(1, additionalProperties.getMemberNames().size());
+                Assert::AreEqual(extra, additionalProperties["extra"].asInt());
+            };
+
+            expectOnlyExtra(card->GetBody()[0]->GetAdditionalProperties(), 1);
+            expectOnlyExtra(card->GetBody()[1]->GetAdditionalProperties(), 2);
+            expectOnlyExtra(card->GetActions()[0]->GetAdditionalProperties(), 4);
+
+            auto richTextBlock = std::static_pointer_cast<RichTextBlock>(card->GetBody()[2]);
+            Assert::IsTrue(richTextBlock->GetAdditionalProperties().empty());
+            expectOnlyExtra(richTextBlock->GetParagraphs()[0]->GetAdditionalProperties(), 5);
+            expectOnlyExtra(richTextBlock->GetParagraphs()[0]->GetInlines()[0]->GetAdditionalProperties(), 3);
+        }
+
+        TEST_METHOD(FallbackAndRequiresAreCopied)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","id":"a","items":[],"requires":{"foo":"1.0"},"fallback":{"type":"TextBlock","text":"b"}},
+                {"type":"TextBlock","text":"c","fallback":"drop"},
+                {"type":"TextBlock","text":"d"}]})";
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            auto container = std::static_pointer_cast<Container>(card->GetBody()[0]);
+
+            Container copy{*container};
+            Assert::IsTrue(FallbackType::Content == copy.GetFallbackType());
+            Assert::IsTrue(copy.GetFallbackContent() == container->GetFallbackContent());
+            Assert::IsFalse(copy.MeetsRequirements({}));
+            Assert::IsTrue(copy.MeetsRequirements({{"foo", "1.1"}}));
+            Assert::AreEqual(container->Serialize(), copy.Serialize());
+
+            // setting fallback on the copy leaves the original alone
+            copy.SetFallbackType(FallbackType::Drop);
+            Assert::IsTrue(FallbackType::Content == container->GetFallbackType());
+
+            Assert::IsTrue(FallbackType::Drop == card->GetBody()[1]->GetFallbackType());
+            Assert::IsTrue(FallbackType::None == card->GetBody()[2]->GetFallbackType());
+            Assert::IsTrue(card->GetBody()[2]->GetFallbackContent() == nullptr);
+            Assert::IsTrue(card->GetBody()[2]->MeetsRequirements({}));
+        }
+    };
+}
@@ -0,0 +1,116 @@
+#include "stdafx.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        // the toggle actions precede the elements they target
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"ActionSet","actions":[{"type":"Action.ToggleVisibility","id":"toggle",
+                "targetElements":["details",{"elementId":"column","isVisible":false},"missing"]}]},
+            {"type":"Container","id":"details","items":[{"type":"TextBlock","id":"text","text":"hello"}]},
+            {"type":"ColumnSet","columns":[{"type":"Column","id":"column","items":[]}]},
+            {"type":"Fancy","id":"phone","fallback":{"type":"Input.Text","id":"phone"}}],
+            "actions":[{"type":"Action.ShowCard","id":"more","card":{"type":"AdaptiveCard","body":[
+                {"type":"TextBlock","id":"inner","text":"inner"},
+                {"type":"ActionSet","actions":[{"type":"Action.ToggleVisibility","targetElements":["text"]}]}]}}]})";
+    }
+
+    TEST_CLASS(ElementIdIndexTest)
+    {
+    public:
+        TEST_METHOD(IndexFindsElementsAndActionsById)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            auto card = parseResult->GetAdaptiveCard();
+            const ElementIdIndex& index = parseResult->GetElementIndex();
+
+            auto details = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            auto columnSet = std::static_pointer_cast<ColumnSet>(card->GetBody()[2]);
+            auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+
+            Assert::IsTrue(details == parseResult->GetElementById("details"));
+            Assert::IsTrue(details->GetItems()[0] == index.FindCardElement("text"));
+            Assert::IsTrue(columnSet->GetColumns()[0] == index.FindCardElement("column"));
+            Assert::IsTrue(showCard == index.FindAction("more"));
+            Assert::IsTrue(showCard->GetCard()->GetBody()[0] == index.FindCardElement("inner"));
+            Assert::IsTrue(nullptr != index.FindAction("toggle"));
+
+            // lookups are typed, and unknown ids miss
+            Assert::IsTrue(nullptr == index.FindCardElement("more"));
+            Assert::IsTrue(nullptr == index.FindAction("details"));
+            Assert::IsTrue(nullptr == parseResult->GetElementById("missing"));
+
+            // fallback content shares its parent's id, and the parent is what the index refers to
+            Assert::IsTrue(card->GetBody()[3] == index.FindCardElement("phone"));
+            Assert::AreEqual<size_t>(7, index.Size());
+        }
+
+        TEST_METHOD(ToggleTargetsAreResolvedAtParseTime)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            auto card = parseResult->GetAdaptiveCard();
+
+            auto actionSet = std::static_pointer_cast<ActionSet>(card->GetBody()[0]);
+            auto toggle = std::static_pointer_cast<ToggleVisibilityAction>(actionSet->GetActions()[0]);
+            const auto& targets = toggle->GetTargetElements();
+            Assert::IsTrue(card->GetBody()[1] == targets[0]->GetElement());
+            Assert::IsTrue(parseResult->GetElementById("column") == targets[1]->GetElement());
+            Assert::IsTrue(nullptr == targets[2]->GetElement());
+
+            // a ShowCard's toggle can target the card it belongs to
+            auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+            auto innerActionSet = std::static_pointer_cast<ActionSet>(showCard->GetCard()->GetBody()[1]);
+            auto innerToggle = std::static_pointer_cast<ToggleVisibilityAction>(innerActionSet->GetActions()[0]);
+            Assert::IsTrue(parseResult->GetElementById("text") == innerToggle->GetTargetElements()[0]->GetElement());
+
+            // retargeting drops the resolved handle, as do clones
+            targets[1]->SetElementId("details");
+            Assert::IsTrue(nullptr == targets[1]->GetElement());
+            auto clonedToggle = std::static_pointer_cast<ToggleVisibilityAction>(toggle->Clone());
+            Assert::IsTrue(nullptr == clonedToggle->GetTargetElements()[0]->GetElement());
+        }
+
+        TEST_METHOD(IndexDoesNotKeepElementsAlive)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            auto card = parseResult->GetAdaptiveCard();
+            auto actionSet = std::static_pointer_cast<ActionSet>(card->GetBody()[0]);
+            auto toggle = std::static_pointer_cast<ToggleVisibilityAction>(actionSet->GetActions()[0]);
+
+            card->GetBody().erase(card->GetBody().begin() + 1);
+
+            Assert::IsTrue(nullptr == parseResult->GetElementById("details"));
+            Assert::IsTrue(nullptr == parseResult->GetElementById("text"));
+            Assert::IsTrue(nullptr == toggle->GetTargetElements()[0]->GetElement());
+            Assert::IsTrue(nullptr != parseResult->GetElementById("column"));
+        }
+
+        TEST_METHOD(ContextIsReusableAfterAParse)
+        {
+            ParseContext context;
+            auto first = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2", context);
+            auto second = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"TextBlock","id":"only","text":"only"}]})",
+                                                              "1.2",
+                                                              context);
+
+            Assert::AreEqual<size_t>(7, first->GetElementIndex().Size());
+            Assert::AreEqual<size_t>(1, second->GetElementIndex().Size());
+            Assert::IsTrue(nullptr == second->GetElementById("details"));
+        }
+    };
+}
@@ -0,0 +1,271 @@
+#include "stdafx.h"
+#include <thread>
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "Container.h"
+#include "ContentHash.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "ParseResult.h"
+#include "RichTextBlock.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+#include "ToggleVisibilityAction.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2",
+            "body":[
+                {"type":"Container","selectAction":{"type":"Action.Submit","title":"select"},
+                 "items":[{"type":"TextBlock","text":"original"}],
+                 "fallback":{"type":"TextBlock","text":"fallback"}},
+                {"type":"Image","url":"http://a/one.png"}],
+            "actions":[{"type":"Action.ShowCard","title":"more",
+                "card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"inner"},{"type":"Image","url":"http://a/two.png"}]}}]})";
+    }
+
+    TEST_CLASS(FreezeTest)
+    {
+    public:
+        TEST_METHOD(FrozenCardRejectsModification)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+            card->Freeze();
+
+            // a frozen card is read through const access
+            const auto& frozen = static_cast<const AdaptiveCard&>(*card);
+            auto container = std::static_pointer_cast<Container>(frozen.GetBody()[0]);
+            auto textBlock = std::static_pointer_cast<TextBlock>(static_cast<const Container&>(*container).GetItems()[0]);
+            auto showCard = std::static_pointer_cast<ShowCardAction>(frozen.GetActions()[0]);
+            auto showCardText = std::static_pointer_cast<TextBlock>(static_cast<const AdaptiveCard&>(*showCard->GetCard()).GetBody()[0]);
+
+            Assert::IsTrue(card->IsFrozen());
+            Assert::IsTrue(container->GetSelectAction()->IsFrozen());
+            Assert::IsTrue(container->GetFallbackContent()->IsFrozen());
+
+            ExpectFrozenException([&]() { card->SetSpeak("hi"); });
+            ExpectFrozenException([&]() { container->SetStyle(ContainerStyle::Emphasis); });
+            ExpectFrozenException([&]() { textBlock->SetText("changed"); });
+            ExpectFrozenException([&]() { textBlock->SetId("changed"); });
+            ExpectFrozenException([&]() { container->GetSelectAction()->SetTitle("changed"); });
+            ExpectFrozenException([&]() { showCard->GetCard()->SetVersion("1.0"); });
+            ExpectFrozenException([&]() { showCardText->SetWrap(true); });
+            ExpectFrozenException([&]() { container->GetFallbackContent()->SetId("changed"); });
+
+            // so are the collections, which the non-const accessors would hand out for modification
+            ExpectFrozenException([&]() { card->GetBody().clear(); });
+            ExpectFrozenException([&]() { card->GetActions(); });
+            ExpectFrozenException([&]() { container->GetItems(); });
+            ExpectFrozenException([&]() { showCard->GetCard()->GetBody(); });
+            Assert::AreEqual<size_t>(2, frozen.GetBody().size());
+        }
+
+        TEST_METHOD(FrozenPartsRejectModification)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.2","backgroundImage":"http://a/card.png",
+                "body":[
+                    {"type":"FactSet","facts":[{"title":"a","value":"b"}]},
+                    {"type":"Input.ChoiceSet","id":"pick","choices":[{"title":"One","value":"1"}]},
+                    {"type":"RichTextBlock","paragraphs":[{"inlines":[{"type":"TextRun","text":"run","selectAction":{"type":"Action.Submit"}}]}]},
+                    {"type":"Container","backgroundImage":"http://a/box.png","items":[]},
+                    {"type":"Media","sources":[{"mimeType":"video/mp4","url":"http://a/v.mp4"}]}]})",
+                                                            "1.2")
+                            ->GetAdaptiveCard();
+            card->Freeze();
+            const std::string originalJson = card->Serialize();
+
+            const auto& body = static_cast<const AdaptiveCard&>(*card).GetBody();
+            const auto& factSet = static_cast<const FactSet&>(*body[0]);
+            const auto& choiceSet = static_cast<const ChoiceSetInput&>(*body[1]);
+            const auto& paragraph = static_cast<const RichTextBlock&>(*body[2]).GetParagraphs()[0];
+            auto textRun = std::static_pointer_cast<TextRun>(static_cast<const Paragraph&>(*paragraph).GetInlines()[0]);
+            const auto& media = static_cast<const Media&>(*body[4]);
+
+            ExpectFrozenException([&]() { factSet.GetFacts()[0]->SetTitle("changed"); });
+            ExpectFrozenException([&]() { std::static_pointer_cast<FactSet>(body[0])->GetFacts(); });
+            ExpectFrozenException([&]() { choiceSet.GetChoices()[0]->SetValue("2"); });
+            ExpectFrozenException([&]() { paragraph->GetInlines().clear(); });
+            ExpectFrozenException([&]() { textRun->SetText("changed"); });
+            ExpectFrozenException([&]() { textRun->GetSelectAction()->SetTitle("changed"); });
+            ExpectFrozenException([&]() { static_cast<const Container&>(*body[3]).GetBackgroundImage()->SetUrl("http://a/other.png"); });
+            ExpectFrozenException([&]() { media.GetSources()[0]->SetUrl("http://a/other.mp4"); });
+            ExpectFrozenException([&]() { card->GetBackgroundImage()->SetUrl("http://a/other.png"); });
+            Assert::AreEqual(originalJson, card->Serialize());
+
+            // a derived element shares the frozen parts too: modified parts are replaced by copies
+            auto derivedMedia = BaseElement::Derive(media);
+            ExpectFrozenException([&]() { derivedMedia->GetSources()[0]->SetUrl("http://a/other.mp4"); });
+            auto source = std::make_shared<MediaSource>(*media.GetSources()[0]);
+            source->SetUrl("http://a/other.mp4");
+            derivedMedia->GetSources()[0] = source;
+            Assert::AreEqual("http://a/other.mp4"s, derivedMedia->GetSources()[0]->GetUrl());
+            Assert::AreEqual("http://a/v.mp4"s, media.GetSources()[0]->GetUrl());
+
+            // parsed facts stay columnar when frozen, and a derived set makes copies of its own from the columns
+            auto derivedFactSet = BaseElement::Derive(factSet);
+            derivedFactSet->GetFacts()[0]->SetTitle("changed");
+            Assert::AreEqual("changed"s, derivedFactSet->GetFacts()[0]->GetTitle());
+            Assert::AreEqual("a"s, factSet.GetFacts()[0]->GetTitle());
+
+            // a clone shares nothing with the original
+            auto clone = card->Clone();
+            clone->GetBackgroundImage()->SetUrl("http://a/other.png");
+            std::static_pointer_cast<FactSet>(clone->GetBody()[0])->GetFacts()[0]->SetTitle("changed");
+            Assert::AreEqual(originalJson, card->Serialize());
+        }
+
+        TEST_METHOD(FrozenToggleTargetsRejectModification)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.2",
+                "body":[{"type":"TextBlock","id":"text","text":"hi"}],
+                "actions":[{"type":"Action.ToggleVisibility","targetElements":["text",{"elementId":"text","isVisible":false}]}]})",
+                                                            "1.2")
+                            ->GetAdaptiveCard();
+            auto action = std::static_pointer_cast<ToggleVisibilityAction>(card->GetActions()[0]);
+            auto target = static_cast<const ToggleVisibilityAction&>(*action).GetTargetElements()[1];
+
+            // until the card is frozen, editing a target changes the action's hash
+            const ContentHash parsedHash = action->GetStructuralHash();
+            target->SetIsVisible(IsVisibleTrue);
+            Assert::IsTrue(parsedHash != action->GetStructuralHash());
+            Assert::IsTrue(action->GetStructuralHash() == ContentHashUtil::HashJson(action->SerializeToJsonValue()));
+
+            // a target fetched before freezing still belongs to the frozen action
+            card->Freeze();
+            const std::string originalJson = card->Serialize();
+            const ContentHash frozenHash = action->GetStructuralHash();
+            ExpectFrozenException([&]() { target->SetIsVisible(IsVisibleFalse); });
+            ExpectFrozenException([&]() { target->SetElementId("other"); });
+            Assert::AreEqual(originalJson, card->Serialize());
+            Assert::IsTrue(frozenHash == action->GetStructuralHash());
+        }
+
+        TEST_METHOD(DerivedCardSharesUntouchedSubtrees)
+        {
+            auto parseResult = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2");
+            auto frozen = parseResult->GetAdaptiveCard();
+            frozen->Freeze();
+            const std::string originalJson = frozen->SerializeToCanonicalString();
+            const auto& original = static_cast<const AdaptiveCard&>(*frozen);
+
+            // replace the text inside the container: only the card and the container are copied
+            auto derived = frozen->Derive();
+            auto container = BaseElement::Derive(static_cast<const Container&>(*original.GetBody()[0]));
+            auto textBlock = BaseElement::Derive(*std::static_pointer_cast<TextBlock>(container->GetItems()[0]));
+            textBlock->SetText("changed");
+            container->GetItems()[0] = textBlock;
+            derived->GetBody()[0] = container;
+
+            Assert::IsFalse(derived->IsFrozen());
+            Assert::IsTrue(derived->GetBody()[1] == original.GetBody()[1]);
+            Assert::IsTrue(derived->GetActions()[0] == original.GetActions()[0]);
+            Assert::IsTrue(container->GetSelectAction() == std::static_pointer_cast<Container>(original.GetBody()[0])->GetSelectAction());
+            Assert::IsTrue(textBlock->GetInternalId() ==
+                           static_cast<const Container&>(*original.GetBody()[0]).GetItems()[0]->GetInternalId());
+
+            Assert::AreEqual(originalJson, frozen->SerializeToCanonicalString());
+            Assert::IsTrue(parseResult->GetContentHash() == frozen->ComputeContentHash());
+            Assert::IsTrue(parseResult->GetContentHash() != derived->ComputeContentHash());
+
+            derived->Freeze();
+            Assert::IsTrue(textBlock->IsFrozen());
+            Assert::IsTrue(container->GetStructuralHash() == ContentHashUtil::HashJson(container->SerializeToJsonValue()));
+        }
+
+        TEST_METHOD(ConcurrentReadsOfFrozenCard)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+            card->Freeze();
+
+            const std::string expectedJson = card->SerializeToJsonValue().toStyledString();
+            std::vector<std::string> canonical(8);
+            std::vector<size_t> resourceCounts(8);
+            std::vector<std::thread> readers;
+            for (size_t i = 0; i < canonical.size(); ++i)
+            {
+                readers.emplace_back([&, i]() {
+                    canonical[i] = card->SerializeToCanonicalString();
+                    resourceCounts[i] = card->GetResourceInformation().size();
+                    static_cast<const AdaptiveCard&>(*card).GetBody()[0]->GetStructuralHash();
+                });
+            }
+            for (auto& reader : readers)
+            {
+                reader.join();
+            }
+
+            for (size_t i = 0; i < canonical.size(); ++i)
+            {
+                Assert::AreEqual(canonical[0], canonical[i]);
+                Assert::AreEqual<size_t>(2, resourceCounts[i]);
+            }
+            Assert::AreEqual(expectedJson, card->SerializeToJsonValue().toStyledString());
+        }
+
+        TEST_METHOD(ConcurrentReadsOfFrozenColumns)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"FactSet","facts":[{"title":"a","value":"b"},{"title":"c","value":"d"}]},
+                {"type":"Input.ChoiceSet","id":"pick","choices":[{"title":"One","value":"1"},{"title":"Two","value":"2"}]}]})",
+                                                            "1.2")
+                            ->GetAdaptiveCard();
+            card->Freeze();
+            const auto& body = static_cast<const AdaptiveCard&>(*card).GetBody();
+            const auto& factSet = static_cast<const FactSet&>(*body[0]);
+            const auto& choiceSet = static_cast<const ChoiceSetInput&>(*body[1]);
+            const std::string originalJson = card->Serialize();
+
+            // the first reads race to make the objects, which are made once and shared by every reader
+            std::vector<const void*> facts(8);
+            std::vector<const void*> choices(8);
+            std::vector<std::thread> readers;
+            for (size_t i = 0; i < facts.size(); ++i)
+            {
+                readers.emplace_back([&, i]() {
+                    facts[i] = factSet.GetFacts()[1].get();
+                    choices[i] = choiceSet.GetChoices()[1].get();
+                });
+            }
+            for (auto& reader : readers)
+            {
+                reader.join();
+            }
+
+            for (size_t i = 0; i < facts.size(); ++i)
+            {
+                Assert::IsTrue(facts[0] == facts[i]);
+                Assert::IsTrue(choices[0] == choices[i]);
+            }
+            Assert::AreEqual("c"s, factSet.GetFacts()[1]->GetTitle());
+            Assert::AreEqual("2"s, choiceSet.GetChoices()[1]->GetValue());
+            Assert::AreEqual("c"s, factSet.GetFactView(1).GetTitle());
+            Assert::AreEqual<size_t>(1, choiceSet.FindChoiceByValue("2"));
+            ExpectFrozenException([&]() { factSet.GetFacts()[1]->SetTitle("changed"); });
+            ExpectFrozenException([&]() { choiceSet.GetChoices()[1]->SetValue("3"); });
+            Assert::AreEqual(originalJson, card->Serialize());
+        }
+
+    private:
+        static void ExpectFrozenException(const std::function<void()>& modify)
+        {
+            try
+            {
+                modify();
+                Assert::Fail(L"Modifying a frozen element should throw");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::FrozenObjectModification == e.GetStatusCode());
+            }
+        }
+    };
+}
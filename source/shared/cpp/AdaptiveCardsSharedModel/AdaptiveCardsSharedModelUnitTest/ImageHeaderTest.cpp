@@ -0,0 +1,138 @@
+#include "stdafx.h"
+#include "AdaptiveBase64Util.h"
+#include "Image.h"
+#include "ImageHeaderUtil.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        std::vector<char> Bytes(const std::string& value) { return std::vector<char>(value.begin(), value.end()); }
+
+        std::vector<char> PngHeader(unsigned char width, unsigned char height)
+        {
+            // the signature and the IHDR chunk, with the sizes' low bytes set
+            auto header = Bytes("\x89PNG\r\n\x1A\n"s + "\0\0\0\x0DIHDR"s + "\0\0\0\0"s + "\0\0\0\0"s + "\x08\x06\0\0\0"s);
+            header[19] = static_cast<char>(width);
+            header[23] = static_cast<char>(height);
+            return header;
+        }
+
+        std::vector<char> JpegHeader(size_t metadataLength)
+        {
+            // SOI, an APP1 segment of metadataLength bytes, then SOF0 for 640x480
+            auto header = Bytes("\xFF\xD8\xFF\xE1"s);
+            const size_t segmentLength = metadataLength + 2;
+            header.push_back(static_cast<char>(segmentLength >> 8));
+            header.push_back(static_cast<char>(segmentLength & 0xFF));
+            header.insert(header.end(), metadataLength, 'x');
+            const auto frame = Bytes("\xFF\xC0\0\x11\x08\x01\xE0\x02\x80\x03"s);
+            header.insert(header.end(), frame.begin(), frame.end());
+            header.insert(header.end(), 100, '\0');
+            return header;
+        }
+
+        std::string DataUri(const std::string& mediaType, const std::vector<char>& data)
+        {
+            return "data:" + mediaType + ";base64," + AdaptiveBase64Util::Encode(data);
+        }
+
+        IntrinsicImageSize ReadDataUri(const std::string& url)
+        {
+            IntrinsicImageSize size;
+            Assert::IsTrue(ImageHeaderUtil::TryReadDataUri(url, size));
+            return size;
+        }
+    }
+
+    TEST_CLASS(ImageHeaderTest)
+    {
+    public:
+        TEST_METHOD(ReadsEachFormatsSize)
+        {
+            const auto png = ReadDataUri(DataUri("image/png", PngHeader(32, 16)));
+            Assert::IsTrue(png.format == ImageFormat::Png);
+            Assert::AreEqual(32u, png.width);
+            Assert::AreEqual(16u, png.height);
+
+            const auto gif = ReadDataUri(DataUri("image/gif", Bytes("GIF89a\x40\x01\x20\0\0\0\0"s)));
+            Assert::IsTrue(gif.format == ImageFormat::Gif);
+            Assert::AreEqual(320u, gif.width);
+            Assert::AreEqual(32u, gif.height);
+
+            // BITMAPINFOHEADER, stored top-down
+            auto bmpHeader = Bytes("BM"s + std::string(12, '\0') + "\x28\0\0\0"s + "\x10\0\0\0"s + "\xF8\xFF\xFF\xFF"s + "\x01\0"s);
+            const auto bmp = ReadDataUri(DataUri("image/bmp", bmpHeader));
+            Assert::IsTrue(bmp.format == ImageFormat::Bmp);
+            Assert::AreEqual(16u, bmp.width);
+            Assert::AreEqual(8u, bmp.height);
+
+            // the frame header follows 40KB of metadata, well past the first chunk decoded
+            const auto jpeg = ReadDataUri(DataUri("IMAGE/JPEG", JpegHeader(40000)));
+            Assert::IsTrue(jpeg.format == ImageFormat::Jpeg);
+            Assert::AreEqual(640u, jpeg.width);
+            Assert::AreEqual(480u, jpeg.height);
+
+            // the media type isn't needed; the header says what the image is
+            Assert::IsTrue(ReadDataUri("data:;base64," + AdaptiveBase64Util::Encode(PngHeader(1, 2))).format == ImageFormat::Png);
+        }
+
+        TEST_METHOD(RejectsOtherUrlsAndData)
+        {
+            IntrinsicImageSize size;
+            Assert::IsFalse(ImageHeaderUtil::TryReadDataUri("https://example.com/a.png", size));
+            Assert::IsFalse(ImageHeaderUtil::TryReadDataUri("data:image/svg+xml,<svg/>", size));
+            Assert::IsFalse(ImageHeaderUtil::TryReadDataUri(DataUri("image/png", Bytes("not an image at all")), size));
+
+            // cut short before the size
+            auto png = PngHeader(4, 4);
+            png.resize(20);
+            Assert::IsFalse(ImageHeaderUtil::TryReadDataUri(DataUri("image/png", png), size));
+            auto jpeg = JpegHeader(1000);
+            jpeg.resize(1005);
+            Assert::IsFalse(ImageHeaderUtil::TryReadDataUri(DataUri("image/jpeg", jpeg), size));
+            Assert::IsTrue(size.format == ImageFormat::Unknown);
+
+            // a header read directly
+            png = PngHeader(7, 9);
+            Assert::IsTrue(ImageHeaderUtil::TryReadHeader(png.data(), png.size(), size));
+            Assert::AreEqual(9u, size.height);
+        }
+
+        TEST_METHOD(ParsingSizesDataUriImagesWhenEnabled)
+        {
+            const std::string url = DataUri("image/png", PngHeader(48, 24));
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Image","url":")" + url + R"("},{"type":"Image","url":"https://example.com/a.png"}]})";
+
+            ParseContext context;
+            context.SetDataUriImageSizing(true);
+            const auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.2", context)->GetAdaptiveCard();
+            const auto image = std::static_pointer_cast<Image>(card->GetBody()[0]);
+            Assert::IsTrue(image->GetIntrinsicSize().format == ImageFormat::Png);
+            Assert::AreEqual(48u, image->GetIntrinsicSize().width);
+            Assert::IsTrue(std::static_pointer_cast<Image>(card->GetBody()[1])->GetIntrinsicSize().format == ImageFormat::Unknown);
+
+            const auto resources = card->GetResourceInformation();
+            Assert::AreEqual(url, resources[0].url);
+            Assert::AreEqual(24u, resources[0].intrinsicSize.height);
+
+            // a new url clears the size
+            const auto copy = std::static_pointer_cast<Image>(image->Clone());
+            Assert::AreEqual(48u, copy->GetIntrinsicSize().width);
+            copy->SetUrl("https://example.com/b.png");
+            Assert::AreEqual(0u, copy->GetIntrinsicSize().width);
+            Assert::AreEqual(48u, image->GetIntrinsicSize().width);
+
+            // off by default
+            const auto unsized = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            Assert::IsTrue(std::static_pointer_cast<Image>(unsized->GetBody()[0])->GetIntrinsicSize().format == ImageFormat::Unknown);
+        }
+    };
+}
@@ -0,0 +1,292 @@
+#include "stdafx.h"
+#include "BackgroundImage.h"
+#include "ChoiceInput.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "IncrementalSerializer.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "Paragraph.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+#include "TextRun.h"
+#include "ToggleVisibilityAction.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"TextBlock","id":"status","text":"Waiting","extra":{"nested":[1,2.5,"three",null,true]}},
+            {"type":"Container","id":"box","selectAction":{"type":"Action.OpenUrl","url":"https://a.b/"},"items":[
+                {"type":"TextBlock","text":"one"},
+                {"type":"Image","url":"https://a.b/c.png","fallback":{"type":"TextBlock","text":"no image"}}]},
+            {"type":"ColumnSet","columns":[{"type":"Column","items":[{"type":"FactSet","facts":[{"title":"a","value":"b"}]}]}]},
+            {"type":"RichTextBlock","paragraphs":[{"inlines":[{"type":"TextRun","text":"run","selectAction":{"type":"Action.Submit","data":{"x":1}}}]}]},
+            {"type":"TextBlock","text":"quote \" and é and \u0001"}],
+            "actions":[{"type":"Action.ShowCard","title":"more","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"inner"}]}}]})";
+
+        std::shared_ptr<AdaptiveCard> Parse(const std::string& json)
+        {
+            return AdaptiveCard::DeserializeFromString(json, "1.2")->GetAdaptiveCard();
+        }
+    }
+
+    TEST_CLASS(IncrementalSerializerTest)
+    {
+    public:
+        TEST_METHOD(MatchesFullSerializationAcrossEdits)
+        {
+            auto card = Parse(c_cardJson);
+            IncrementalSerializer serializer;
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(0, serializer.GetLastStatistics().reusedElements);
+
+            // nothing changed: every top-level element is reused
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(6, serializer.GetLastStatistics().reusedElements);
+            Assert::AreEqual<size_t>(0, serializer.GetLastStatistics().serializedElements);
+
+            auto status = std::static_pointer_cast<TextBlock>(card->GetBody()[0]);
+            status->SetText("Done");
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(1, serializer.GetLastStatistics().serializedElements);
+
+            // a change deep down re-serializes the path to it and reuses its siblings
+            auto box = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            std::static_pointer_cast<TextBlock>(box->GetItems()[0])->SetIsVisible(false);
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(2, serializer.GetLastStatistics().serializedElements);
+
+            auto added = std::make_shared<TextBlock>();
+            added->SetText("two");
+            box->GetItems().push_back(added);
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            std::static_pointer_cast<TextBlock>(box->GetItems()[1]->GetFallbackContent())->SetText("still no image");
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            auto columnSet = std::static_pointer_cast<ColumnSet>(card->GetBody()[2]);
+            auto factSet = std::static_pointer_cast<FactSet>(columnSet->GetColumns()[0]->GetItems()[0]);
+            factSet->GetFacts()[0]->SetValue("c");
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+            showCard->GetCard()->SetSpeak("spoken");
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            std::static_pointer_cast<TextBlock>(showCard->GetCard()->GetBody()[0])->SetText("changed inner");
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            card->GetBody().erase(card->GetBody().begin());
+            card->SetFallbackText("fallback");
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(5, serializer.GetLastStatistics().reusedElements);
+        }
+
+        TEST_METHOD(CopiesAndDerivedCards)
+        {
+            auto card = Parse(c_cardJson);
+            card->Freeze();
+            IncrementalSerializer serializer;
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            // a derived card shares the untouched elements, whose text is reused
+            auto derived = card->Derive();
+            auto status = BaseElement::Derive(static_cast<const TextBlock&>(*static_cast<const AdaptiveCard&>(*card).GetBody()[0]));
+            status->SetText("Derived");
+            derived->GetBody()[0] = status;
+            Assert::AreEqual(derived->Serialize(), serializer.Serialize(*derived));
+            Assert::AreEqual<size_t>(1, serializer.GetLastStatistics().serializedElements);
+            Assert::AreEqual<size_t>(5, serializer.GetLastStatistics().reusedElements);
+
+            // copies are new elements even though they start out equal
+            TextBlock copy{*status};
+            Assert::AreNotEqual(status->GetChangeStamp(), copy.GetChangeStamp());
+
+            // a different card through the same serializer
+            auto other = Parse(R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"x"}]})");
+            Assert::AreEqual(other->Serialize(), serializer.Serialize(*other));
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+        }
+
+        TEST_METHOD(ChangeStamps)
+        {
+            auto card = Parse(c_cardJson);
+            auto box = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            const auto stamp = box->GetChangeStamp();
+            Assert::AreEqual(stamp, box->GetChangeStamp());
+
+            // nested changes and list edits leave the container's own stamp alone; its setters don't
+            std::static_pointer_cast<TextBlock>(box->GetItems()[0])->SetText("changed");
+            box->GetItems().pop_back();
+            Assert::AreEqual(stamp, box->GetChangeStamp());
+            box->SetBleed(true);
+            Assert::AreNotEqual(stamp, box->GetChangeStamp());
+
+            const auto cardStamp = card->GetChangeStamp();
+            card->SetLanguage("fr");
+            Assert::AreNotEqual(cardStamp, card->GetChangeStamp());
+
+            // freezing assigns the final stamp, and the collections can't be handed out for modification afterwards
+            card->Freeze();
+            const auto frozenStamp = box->GetChangeStamp();
+            try
+            {
+                box->GetItems();
+                Assert::Fail(L"A frozen container's items can't be modified");
+            }
+            catch (const AdaptiveCardParseException& e)
+            {
+                Assert::IsTrue(ErrorStatusCode::FrozenObjectModification == e.GetStatusCode());
+            }
+            Assert::AreEqual(frozenStamp, box->GetChangeStamp());
+        }
+
+        TEST_METHOD(EditsThroughKeptParts)
+        {
+            auto card = Parse(R"({"type":"AdaptiveCard","version":"1.2","backgroundImage":"https://a.b/card.png","body":[
+                {"type":"FactSet","facts":[{"title":"a","value":"b"}]},
+                {"type":"Input.ChoiceSet","id":"pick","choices":[{"title":"One","value":"1"}]},
+                {"type":"RichTextBlock","paragraphs":[{"inlines":[{"type":"TextRun","text":"run"}]}]},
+                {"type":"Container","backgroundImage":"https://a.b/box.png","items":[]},
+                {"type":"Media","sources":[{"mimeType":"video/mp4","url":"https://a.b/v.mp4"}]}],
+                "actions":[{"type":"Action.ToggleVisibility","targetElements":["pick"]}]})");
+            const auto& body = static_cast<const AdaptiveCard&>(*card).GetBody();
+            const auto& actions = static_cast<const AdaptiveCard&>(*card).GetActions();
+
+            // references kept across serializations; parsed facts and choices are columnar, and made editable objects
+            // through the non-const accessors
+            auto fact = std::static_pointer_cast<FactSet>(body[0])->GetFacts()[0];
+            auto choiceSet = std::static_pointer_cast<ChoiceSetInput>(body[1]);
+            auto choice = choiceSet->GetChoices()[0];
+            const auto& paragraph = static_cast<const RichTextBlock&>(*body[2]).GetParagraphs()[0];
+            auto textRun = std::static_pointer_cast<TextRun>(static_cast<const Paragraph&>(*paragraph).GetInlines()[0]);
+            auto containerImage = static_cast<const Container&>(*body[3]).GetBackgroundImage();
+            auto source = static_cast<const Media&>(*body[4]).GetSources()[0];
+            auto cardImage = card->GetBackgroundImage();
+            auto target = static_cast<const ToggleVisibilityAction&>(*actions[0]).GetTargetElements()[0];
+
+            IncrementalSerializer serializer;
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            const auto expectFresh = [&card, &serializer](const BaseElement& owner) {
+                const auto hash = owner.GetStructuralHash();
+                return [&card, &serializer, &owner, hash]() {
+                    Assert::AreNotEqual(hash.ToString(), owner.GetStructuralHash().ToString());
+                    Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+                    Assert::AreEqual<size_t>(1, serializer.GetLastStatistics().serializedElements);
+                };
+            };
+
+            std::function<void()> check = expectFresh(*body[0]);
+            fact->SetTitle("changed title");
+            check();
+
+            choiceSet->BuildChoiceIndex();
+            check = expectFresh(*choiceSet);
+            choice->SetValue("2");
+            check();
+            // the index went with the edit
+            Assert::IsFalse(choiceSet->HasChoiceIndex());
+            Assert::AreEqual<size_t>(0, choiceSet->FindChoiceByValue("2"));
+
+            check = expectFresh(*body[2]);
+            textRun->SetText("changed run");
+            check();
+
+            check = expectFresh(*body[3]);
+            containerImage->SetUrl("https://a.b/other.png");
+            check();
+
+            check = expectFresh(*body[4]);
+            source->SetUrl("https://a.b/other.mp4");
+            check();
+
+            check = expectFresh(*actions[0]);
+            target->SetIsVisible(IsVisibleFalse);
+            check();
+
+            const auto cardHash = card->ComputeContentHash();
+            cardImage->SetUrl("https://a.b/other-card.png");
+            Assert::AreNotEqual(cardHash.ToString(), card->ComputeContentHash().ToString());
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(0, serializer.GetLastStatistics().serializedElements);
+        }
+
+        TEST_METHOD(ListsEditedThroughKeptReferences)
+        {
+            auto card = Parse(c_cardJson);
+            auto box = std::static_pointer_cast<Container>(card->GetBody()[1]);
+            auto& items = box->GetItems();
+            items.push_back(std::make_shared<TextBlock>());
+
+            IncrementalSerializer serializer;
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+
+            // the list reference was handed out before serializing; what it holds is compared, not when it was fetched
+            items.pop_back();
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(1, serializer.GetLastStatistics().serializedElements);
+
+            std::swap(items[0], items[1]);
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(1, serializer.GetLastStatistics().serializedElements);
+
+            auto replacement = std::make_shared<TextBlock>();
+            replacement->SetText("replaced");
+            items[0] = replacement;
+            Assert::AreEqual(card->Serialize(), serializer.Serialize(*card));
+            Assert::AreEqual<size_t>(2, serializer.GetLastStatistics().serializedElements);
+        }
+
+        TEST_METHOD(LiveStatusUpdateTimes)
+        {
+            std::string items;
+            for (int i = 0; i < 2000; ++i)
+            {
+                items += (i == 0 ? "" : ",") + R"({"type":"TextBlock","text":"Row )"s + std::to_string(i) + R"(","wrap":true})";
+            }
+            auto card = Parse(R"({"type":"AdaptiveCard","version":"1.2","body":[{"type":"TextBlock","id":"status","text":"0"},
+                {"type":"Container","items":[)" + items + "]}]}");
+            auto status = std::static_pointer_cast<TextBlock>(card->GetBody()[0]);
+
+            IncrementalSerializer serializer;
+            serializer.Serialize(*card);
+
+            const int updates = 100;
+            long long incrementalMicroseconds = 0;
+            long long fullMicroseconds = 0;
+            for (int i = 1; i <= updates; ++i)
+            {
+                status->SetText(std::to_string(i));
+
+                auto start = std::chrono::steady_clock::now();
+                const std::string incremental = serializer.Serialize(*card);
+                incrementalMicroseconds +=
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+                start = std::chrono::steady_clock::now();
+                const std::string full = card->Serialize();
+                fullMicroseconds += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+                Assert::AreEqual(full, incremental);
+            }
+
+            Logger::WriteMessage(("Serialize after a one-element edit of a 2000 element card: incremental "s +
+                                  std::to_string(incrementalMicroseconds / updates) + "us, full " +
+                                  std::to_string(fullMicroseconds / updates) + "us")
+                                     .c_str());
+        }
+    };
+}
@@ -0,0 +1,110 @@
+#include "stdafx.h"
+#include "InputValidator.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_formJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"Input.Text","id":"name","isRequired":true,"maxLength":5},
+            {"type":"Input.Number","id":"age","min":18,"max":120},
+            {"type":"Input.Date","id":"start","min":"2020-01-01","max":"2020-12-31"},
+            {"type":"Input.Time","id":"at","min":"09:00","max":"17:30"},
+            {"type":"Input.ChoiceSet","id":"color","choices":[{"title":"Red","value":"r"},{"title":"Green","value":"g"}]},
+            {"type":"Input.ChoiceSet","id":"tags","isMultiSelect":true,"choices":[{"title":"A","value":"a"},{"title":"B","value":"b"}]},
+            {"type":"Input.Toggle","id":"agree","title":"Agree","isRequired":true}],
+            "actions":[{"type":"Action.ShowCard","title":"More","card":{"type":"AdaptiveCard","body":[
+                {"type":"Input.Text","id":"comment","maxLength":3}]}}]})";
+
+        InputValidator CompileForm()
+        {
+            return InputValidator::Compile(*AdaptiveCard::DeserializeFromString(c_formJson, "1.2")->GetAdaptiveCard());
+        }
+
+        // errors as "<id>:<type>" entries, for comparing whole results at once
+        std::string Describe(const std::vector<InputValidationError>& errors)
+        {
+            std::string description;
+            for (const auto& error : errors)
+            {
+                description += error.inputId + ":" + std::to_string(static_cast<int>(error.type)) + " ";
+            }
+            return description;
+        }
+
+        std::string Validate(const InputValidator& validator, const std::string& submission)
+        {
+            return Describe(validator.Validate(ParseUtil::GetJsonValueFromString(submission)));
+        }
+    }
+
+    TEST_CLASS(InputValidatorTest)
+    {
+    public:
+        TEST_METHOD(ValidSubmissions)
+        {
+            const auto validator = CompileForm();
+            Assert::AreEqual(std::size_t{8}, validator.GetInputCount());
+
+            Assert::AreEqual(""s, Validate(validator, R"({"name":"Ada","agree":"true"})"));
+            Assert::AreEqual(""s, Validate(validator, R"({"name":"Zoë ☃","age":"42.5","start":"2020-02-29","at":"17:30",
+                                                          "color":"g","tags":"a,b","agree":"false","comment":"ok","extra":{"x":1}})"));
+            // numbers may come as JSON numbers
+            Assert::AreEqual(""s, Validate(validator, R"({"name":"Ada","age":18,"agree":"true"})"));
+        }
+
+        TEST_METHOD(InvalidSubmissions)
+        {
+            const auto validator = CompileForm();
+            const auto required = std::to_string(static_cast<int>(InputValidationErrorType::Required));
+            const auto format = std::to_string(static_cast<int>(InputValidationErrorType::InvalidFormat));
+            const auto tooLong = std::to_string(static_cast<int>(InputValidationErrorType::TooLong));
+            const auto below = std::to_string(static_cast<int>(InputValidationErrorType::BelowMinimum));
+            const auto above = std::to_string(static_cast<int>(InputValidationErrorType::AboveMaximum));
+            const auto choice = std::to_string(static_cast<int>(InputValidationErrorType::InvalidChoice));
+
+            Assert::AreEqual("name:" + required + " agree:" + required + " ", Validate(validator, R"({"name":""})"));
+            Assert::AreEqual("name:" + required + " agree:" + required + " ", Validate(validator, "[]"));
+            Assert::AreEqual("name:" + tooLong + " age:" + below + " start:" + above + " at:" + below + " color:" + choice +
+                                 " tags:" + choice + " comment:" + tooLong + " ",
+                             Validate(validator, R"({"name":"Adaline","age":"17","start":"2021-01-01","at":"08:59",
+                                                     "color":"r,g","tags":"a,c","agree":"true","comment":"long"})"));
+            Assert::AreEqual("name:" + format + " age:" + format + " start:" + format + " at:" + format + " ",
+                             Validate(validator, R"({"name":5,"age":"0x20","start":"2019-02-29","at":"24:00","agree":"true"})"));
+            Assert::AreEqual("age:" + above + " ", Validate(validator, R"({"name":"Ada","age":121,"agree":"true"})"));
+        }
+
+        TEST_METHOD(BatchMatchesSingleValidation)
+        {
+            const auto validator = CompileForm();
+            std::vector<Json::Value> submissions;
+            for (int i = 0; i < 2000; ++i)
+            {
+                submissions.push_back(ParseUtil::GetJsonValueFromString(
+                    R"({"name":"n)" + std::to_string(i) + R"(","age":")" + std::to_string(i % 150) + R"(","agree":"true"})"));
+            }
+
+            const auto start = std::chrono::steady_clock::now();
+            const auto results = validator.ValidateBatch(submissions, 4);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            Assert::AreEqual(submissions.size(), results.size());
+            for (std::size_t i = 0; i < submissions.size(); ++i)
+            {
+                Assert::AreEqual(Describe(validator.Validate(submissions[i])), Describe(results[i]));
+            }
+            Assert::IsTrue(validator.ValidateBatch({}).empty());
+
+            Logger::WriteMessage(("Validated "s + std::to_string(submissions.size()) + " submissions on 4 threads: " +
+                                  std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) + "us")
+                                     .c_str());
+        }
+    };
+}
@@ -0,0 +1,179 @@
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ParseResultCache.h"
+#include "SharedAdaptiveCard.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    class UpperCaseTextBlockParser : public BaseCardElementParser
+    {
+    public:
+        std::shared_ptr<BaseCardElement> Deserialize(ParseContext& context, const Json::Value& value) override
+        {
+            std::string text = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Text);
+            std::transform(text.begin(), text.end(), text.begin(), ::toupper);
+            auto textBlock = std::make_shared<TextBlock>();
+            textBlock->SetText(text);
+            return textBlock;
+        }
+
+        std::shared_ptr<BaseCardElement> DeserializeFromString(ParseContext& context, const std::string& value) override
+        {
+            return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
+        }
+    };
+
+    TEST_CLASS(ParseResultCacheTest)
+    {
+    public:
+        TEST_METHOD(IdenticalCardsShareParseResult)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"Hello"}]})";
+            ParseResultCache cache(1024 * 1024);
+
+            auto first = cache.DeserializeFromString(cardJson, "1.0");
+            auto second = cache.DeserializeFromString(cardJson, "1.0");
+
+            Assert::IsTrue(first == second);
+            Assert::AreEqual<std::uint64_t>(1, cache.GetStatistics().hits);
+            Assert::AreEqual<std::uint64_t>(1, cache.GetStatistics().misses);
+            Assert::AreEqual<size_t>(1, cache.GetStatistics().entryCount);
+        }
+
+        TEST_METHOD(RendererVersionIsPartOfKey)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"Hello"}]})";
+            ParseResultCache cache(1024 * 1024);
+
+            auto first = cache.DeserializeFromString(cardJson, "1.0");
+            auto second = cache.DeserializeFromString(cardJson, "1.2");
+
+            Assert::IsTrue(first != second);
+            Assert::AreEqual<std::uint64_t>(2, cache.GetStatistics().misses);
+        }
+
+        TEST_METHOD(DataUriImageSizingIsPartOfKey)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"Image","url":"data:image/gif;base64,R0lGODlhBAACAAAAAAA="}]})";
+            ParseResultCache cache(1024 * 1024);
+
+            ParseContext sizingContext;
+            sizingContext.SetDataUriImageSizing(true);
+            auto sized = cache.DeserializeFromString(cardJson, "1.0", sizingContext);
+            auto unsized = cache.DeserializeFromString(cardJson, "1.0");
+
+            Assert::IsTrue(sized != unsized);
+            Assert::AreEqual(4u, sized->GetAdaptiveCard()->GetResourceInformation()[0].intrinsicSize.width);
+            Assert::AreEqual(0u, unsized->GetAdaptiveCard()->GetResourceInformation()[0].intrinsicSize.width);
+        }
+
+        TEST_METHOD(CustomParsersAreNeverShared)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"CustomText","text":"Hello"}]})";
+            ParseResultCache cache(1024 * 1024);
+
+            auto customRegistration = std::make_shared<ElementParserRegistration>();
+            customRegistration->AddParser("CustomText", std::make_shared<UpperCaseTextBlockParser>());
+            ParseContext customContext(customRegistration, nullptr);
+            auto customResult = cache.DeserializeFromString(cardJson, "1.0", customContext);
+
+            // default registrations share a fingerprint; this must not see the custom parse
+            ParseContext defaultContext;
+            auto defaultResult = cache.DeserializeFromString(cardJson, "1.0", defaultContext);
+            Assert::IsTrue(customResult != defaultResult);
+            // cached cards are frozen, so they're read through const access
+            const auto& defaultCard = static_cast<const AdaptiveCard&>(*defaultResult->GetAdaptiveCard());
+            Assert::IsTrue(defaultCard.GetBody()[0]->GetElementType() == CardElementType::Unknown);
+
+            ParseContext otherDefaultContext;
+            Assert::IsTrue(defaultResult == cache.DeserializeFromString(cardJson, "1.0", otherDefaultContext));
+
+            // re-registering, even the same parser type, produces a new fingerprint
+            customRegistration->AddParser("CustomText", std::make_shared<UpperCaseTextBlockParser>());
+            Assert::IsTrue(customResult != cache.DeserializeFromString(cardJson, "1.0", customContext));
+            Assert::AreEqual<std::uint64_t>(1, cache.GetStatistics().hits);
+        }
+
+        TEST_METHOD(CachedWarningsAreReportedOnHit)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","lang":"not a language","body":[]})";
+            ParseResultCache cache(1024 * 1024);
+
+            ParseContext firstContext;
+            cache.DeserializeFromString(cardJson, "1.0", firstContext);
+            ParseContext secondContext;
+            auto result = cache.DeserializeFromString(cardJson, "1.0", secondContext);
+
+            Assert::AreEqual<std::uint64_t>(1, cache.GetStatistics().hits);
+            Assert::IsFalse(result->GetWarnings().empty());
+            Assert::AreEqual(firstContext.warnings.size(), secondContext.warnings.size());
+        }
+
+        TEST_METHOD(RewritingContextsBypassTheCache)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"Image","url":"http://a/b.png"}]})";
+            ParseResultCache cache(1024 * 1024);
+            cache.DeserializeFromString(cardJson, "1.0");
+
+            ParseContext rewritingContext;
+            rewritingContext.SetUrlRewriter([](UrlKind, std::string& url) { url = "https://cdn/b.png"; });
+            auto rewritten = cache.DeserializeFromString(cardJson, "1.0", rewritingContext);
+            Assert::AreEqual("https://cdn/b.png"s, rewritten->GetAdaptiveCard()->GetResourceInformation()[0].url);
+            Assert::IsTrue(rewritten->GetAdaptiveCard()->IsFrozen());
+
+            // nor is the rewritten card handed to later callers
+            Assert::IsTrue(rewritten != cache.DeserializeFromString(cardJson, "1.0", rewritingContext));
+            Assert::AreEqual("http://a/b.png"s, cache.DeserializeFromString(cardJson, "1.0")->GetAdaptiveCard()->GetResourceInformation()[0].url);
+            Assert::AreEqual<size_t>(1, cache.GetStatistics().entryCount);
+        }
+
+        TEST_METHOD(ResourceCallbackSeesUrlsOnEveryParse)
+        {
+            const std::string cardJson = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"Image","url":"http://a/b.png"}]})";
+            ParseResultCache cache(1024 * 1024);
+            cache.DeserializeFromString(cardJson, "1.0");
+
+            std::vector<std::string> reported;
+            for (int i = 0; i < 2; ++i)
+            {
+                ParseContext context;
+                context.SetResourceCallback([&reported](UrlKind, const std::string& url) { reported.push_back(url); });
+                cache.DeserializeFromString(cardJson, "1.0", context);
+            }
+            Assert::AreEqual<size_t>(2, reported.size());
+            Assert::AreEqual<std::uint64_t>(0, cache.GetStatistics().hits);
+        }
+
+        TEST_METHOD(EvictsLeastRecentlyUsedWithinBudget)
+        {
+            const std::string first = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"1"}]})";
+            const std::string second = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"2"}]})";
+            const std::string third = R"({"type":"AdaptiveCard","version":"1.0","body":[{"type":"TextBlock","text":"3"}]})";
+            ParseResultCache cache(2 * (first.size() + 512));
+
+            auto firstResult = cache.DeserializeFromString(first, "1.0");
+            cache.DeserializeFromString(second, "1.0");
+            cache.DeserializeFromString(first, "1.0");
+            cache.DeserializeFromString(third, "1.0");
+
+            ParseResultCache::Statistics statistics = cache.GetStatistics();
+            Assert::AreEqual<std::uint64_t>(1, statistics.evictions);
+            Assert::AreEqual<size_t>(2, statistics.entryCount);
+            Assert::IsTrue(statistics.memoryUsage <= cache.GetMemoryBudget());
+
+            // "second" was least recently used
+            Assert::IsTrue(firstResult == cache.DeserializeFromString(first, "1.0"));
+            cache.DeserializeFromString(second, "1.0");
+            Assert::AreEqual<std::uint64_t>(2, cache.GetStatistics().hits);
+
+            cache.SetMemoryBudget(0);
+            Assert::AreEqual<size_t>(0, cache.GetStatistics().entryCount);
+            Assert::AreEqual<size_t>(0, cache.GetStatistics().memoryUsage);
+        }
+    };
+}
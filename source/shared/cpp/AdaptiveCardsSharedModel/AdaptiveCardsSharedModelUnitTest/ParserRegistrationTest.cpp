@@ -76,6 +76,10 @@ namespace AdaptiveCardsSharedModelUnitTest
             {
                 auto cardParserWrapper = std::static_pointer_cast<BaseCardElementParserWrapper>(elementParser.GetParser(elemType));
                 Assert::IsTrue(customElementParser == cardParserWrapper->GetActualParser());
+
+                // parsers are wrapped once, when registered, rather than on every lookup
+                Assert::IsTrue(cardParserWrapper == elementParser.GetParser(elemType));
+                Assert::IsTrue(actionParser.GetParser(elemType) == actionParser.GetParser(elemType));
             }
 
             // overwrite our new parser
@@ -0,0 +1,239 @@
+#include "stdafx.h"
+#include <chrono>
+#include "ActionSet.h"
+#include "Container.h"
+#include "Fact.h"
+#include "FactSet.h"
+#include "HostConfig.h"
+#include "Image.h"
+#include "ParseResult.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        // Reads every string a renderer would read through the copying getters
+        struct CopyingReader
+        {
+            static size_t Read(const TextBlock& textBlock) { return textBlock.GetText().size() + textBlock.GetLanguage().size(); }
+            static size_t Read(const Image& image) { return image.GetUrl().size() + image.GetAltText().size(); }
+            static size_t Read(const Fact& fact) { return fact.GetTitle().size() + fact.GetValue().size(); }
+            static size_t Read(const TextInput& input) { return input.GetPlaceholder().size() + input.GetValue().size(); }
+            static size_t Read(const BaseActionElement& action) { return action.GetTitle().size() + action.GetIconUrl().size(); }
+            static size_t Read(const BaseElement& element) { return element.GetId().size() + element.GetElementTypeString().size(); }
+            static size_t Read(const AdaptiveCard& card) { return card.GetVersion().size() + card.GetLanguage().size(); }
+            static size_t Read(const HostConfig& hostConfig)
+            {
+                return hostConfig.GetFontFamily(FontStyle::Default).size() +
+                       hostConfig.GetForegroundColor(ContainerStyle::Default, ForegroundColor::Default, false).size();
+            }
+        };
+
+        // ... and through the non-copying ones
+        struct RefReader
+        {
+            static size_t Read(const TextBlock& textBlock) { return textBlock.GetTextRef().size() + textBlock.GetLanguageRef().size(); }
+            static size_t Read(const Image& image) { return image.GetUrlRef().size() + image.GetAltTextRef().size(); }
+            static size_t Read(const Fact& fact) { return fact.GetTitleRef().size() + fact.GetValueRef().size(); }
+            static size_t Read(const TextInput& input) { return input.GetPlaceholderRef().size() + input.GetValueRef().size(); }
+            static size_t Read(const BaseActionElement& action) { return action.GetTitleRef().size() + action.GetIconUrlRef().size(); }
+            static size_t Read(const BaseElement& element) { return element.GetIdRef().size() + element.GetElementTypeStringRef().size(); }
+            static size_t Read(const AdaptiveCard& card) { return card.GetVersionRef().size() + card.GetLanguageRef().size(); }
+            static size_t Read(const HostConfig& hostConfig)
+            {
+                return hostConfig.GetFontFamilyRef(FontStyle::Default).size() +
+                       hostConfig.GetForegroundColorRef(ContainerStyle::Default, ForegroundColor::Default, false).size();
+            }
+        };
+
+        template<typename Reader> size_t WalkElements(const std::vector<std::shared_ptr<BaseCardElement>>& elements)
+        {
+            size_t bytesRead = 0;
+            for (const auto& element : elements)
+            {
+                bytesRead += Reader::Read(static_cast<const BaseElement&>(*element));
+                switch (element->GetElementType())
+                {
+                case CardElementType::Container:
+                    bytesRead += WalkElements<Reader>(static_cast<const Container&>(*element).GetItems());
+                    break;
+                case CardElementType::TextBlock:
+                    bytesRead += Reader::Read(static_cast<const TextBlock&>(*element));
+                    break;
+                case CardElementType::Image:
+                    bytesRead += Reader::Read(static_cast<const Image&>(*element));
+                    break;
+                case CardElementType::FactSet:
+                    for (const auto& fact : static_cast<const FactSet&>(*element).GetFacts())
+                    {
+                        bytesRead += Reader::Read(*fact);
+                    }
+                    break;
+                case CardElementType::TextInput:
+                    bytesRead += Reader::Read(static_cast<const TextInput&>(*element));
+                    break;
+                case CardElementType::ActionSet:
+                    for (const auto& action : static_cast<const ActionSet&>(*element).GetActions())
+                    {
+                        bytesRead += Reader::Read(*action);
+                    }
+                    break;
+                default:
+                    break;
+                }
+            }
+            return bytesRead;
+        }
+
+        template<typename Reader> size_t WalkCard(const AdaptiveCard& card, const HostConfig& hostConfig)
+        {
+            return Reader::Read(card) + Reader::Read(hostConfig) + WalkElements<Reader>(card.GetBody());
+        }
+
+        // Walks the element tree holding each child through Handle: a shared_ptr copy (an atomic increment and decrement
+        // of the shared count per element) or a const reference
+        template<typename Handle> size_t CountElements(const std::vector<std::shared_ptr<BaseCardElement>>& elements)
+        {
+            size_t count = elements.size();
+            for (Handle element : elements)
+            {
+                if (element->GetElementType() == CardElementType::Container)
+                {
+                    count += CountElements<Handle>(static_cast<const Container&>(*element).GetItems());
+                }
+            }
+            return count;
+        }
+
+        std::string MakeBenchmarkCard(size_t sections)
+        {
+            // strings are kept past the small-string limit so that every copy allocates
+            std::string body;
+            for (size_t i = 0; i < sections; ++i)
+            {
+                const std::string n = std::to_string(i);
+                body += (i == 0 ? "" : ",") + R"({"type":"Container","id":"section)"s + n + R"(","items":[
+                    {"type":"TextBlock","id":"heading)" + n + R"(","text":"Section heading number )" + n + R"( with some text"},
+                    {"type":"Image","url":"https://adaptivecards.io/content/section-image-)" + n + R"(.png","altText":"An image for this section"},
+                    {"type":"FactSet","facts":[{"title":"First fact title goes here","value":"First fact value goes here"},
+                                               {"title":"Second fact title goes here","value":"Second fact value goes here"}]},
+                    {"type":"Input.Text","id":"input)" + n + R"(","placeholder":"Placeholder text for the input"},
+                    {"type":"ActionSet","actions":[{"type":"Action.Submit","title":"Submit this section of the card"}]}]})";
+            }
+            return R"({"type":"AdaptiveCard","version":"1.2","lang":"en-US","body":[)" + body + "]}";
+        }
+    }
+
+    TEST_CLASS(RenderWalkBenchmarkTest)
+    {
+    public:
+        TEST_METHOD(RefWalkReadsTheSameContent)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(MakeBenchmarkCard(200), "1.2")->GetAdaptiveCard();
+            HostConfig hostConfig;
+            hostConfig.SetFontFamily("Segoe UI with a long deprecated font family name");
+
+            constexpr int iterations = 50;
+            size_t copyingBytes = 0;
+            size_t refBytes = 0;
+
+            const auto copyingStart = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                copyingBytes += WalkCard<CopyingReader>(*card, hostConfig);
+            }
+            const auto refStart = std::chrono::steady_clock::now();
+            for (int i = 0; i < iterations; ++i)
+            {
+                refBytes += WalkCard<RefReader>(*card, hostConfig);
+            }
+            const auto end = std::chrono::steady_clock::now();
+
+            Assert::AreEqual(copyingBytes, refBytes);
+
+            const auto copyingMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(refStart - copyingStart).count();
+            const auto refMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - refStart).count();
+            Logger::WriteMessage(("Render walk, copying getters: "s + std::to_string(copyingMicroseconds) +
+                                  "us, Ref getters: " + std::to_string(refMicroseconds) + "us")
+                                     .c_str());
+        }
+
+        TEST_METHOD(ParseAndHandleWalkTimes)
+        {
+            const std::string cardJson = MakeBenchmarkCard(200);
+
+            constexpr int parseIterations = 10;
+            const auto parseStart = std::chrono::steady_clock::now();
+            std::shared_ptr<AdaptiveCard> card;
+            for (int i = 0; i < parseIterations; ++i)
+            {
+                card = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            }
+            const auto parseEnd = std::chrono::steady_clock::now();
+
+            constexpr int walkIterations = 200;
+            size_t copyingCount = 0;
+            size_t refCount = 0;
+
+            const auto copyingStart = std::chrono::steady_clock::now();
+            for (int i = 0; i < walkIterations; ++i)
+            {
+                copyingCount += CountElements<std::shared_ptr<BaseCardElement>>(card->GetBody());
+            }
+            const auto refStart = std::chrono::steady_clock::now();
+            for (int i = 0; i < walkIterations; ++i)
+            {
+                refCount += CountElements<const std::shared_ptr<BaseCardElement>&>(card->GetBody());
+            }
+            const auto end = std::chrono::steady_clock::now();
+
+            Assert::AreEqual<size_t>(walkIterations * 200 * 6, copyingCount);
+            Assert::AreEqual(copyingCount, refCount);
+
+            const auto parseMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(parseEnd - parseStart).count();
+            const auto copyingMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(refStart - copyingStart).count();
+            const auto refMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(end - refStart).count();
+            Logger::WriteMessage(("Parse: "s + std::to_string(parseMicroseconds / parseIterations) +
+                                  "us per card, handle walk by copy: " + std::to_string(copyingMicroseconds) +
+                                  "us, by reference: " + std::to_string(refMicroseconds) + "us")
+                                     .c_str());
+        }
+
+        TEST_METHOD(RefAccessorsReferToStoredValues)
+        {
+            auto card = AdaptiveCard::DeserializeFromString(MakeBenchmarkCard(1), "1.2")->GetAdaptiveCard();
+            auto container = std::static_pointer_cast<Container>(card->GetBody()[0]);
+            auto textBlock = std::static_pointer_cast<TextBlock>(container->GetItems()[0]);
+
+            const std::string& text = textBlock->GetTextRef();
+            Assert::IsTrue(&text == &textBlock->GetTextRef());
+            Assert::AreEqual(textBlock->GetText(), text);
+            textBlock->SetText("changed");
+            Assert::AreEqual("changed"s, text);
+
+            Assert::AreEqual("section0"s, container->GetIdRef());
+            Assert::AreEqual("Container"s, container->GetElementTypeStringRef());
+            Assert::AreEqual("en-US"s, card->GetLanguageRef());
+        }
+
+        TEST_METHOD(HostConfigRefAccessorsMatchCopyingGetters)
+        {
+            HostConfig hostConfig = HostConfig::DeserializeFromString(R"({"fontFamily":"Deprecated",
+                "fontStyles":{"monospace":{"fontFamily":""}}})");
+
+            Assert::AreEqual("Deprecated"s, hostConfig.GetFontFamilyRef(FontStyle::Default));
+            Assert::AreEqual(hostConfig.GetFontFamily(FontStyle::Default), hostConfig.GetFontFamilyRef(FontStyle::Default));
+            Assert::AreEqual(hostConfig.GetFontFamily(FontStyle::Monospace), hostConfig.GetFontFamilyRef(FontStyle::Monospace));
+            Assert::AreEqual(hostConfig.GetBorderColor(ContainerStyle::Emphasis), hostConfig.GetBorderColorRef(ContainerStyle::Emphasis));
+            Assert::AreEqual(hostConfig.GetBackgroundColor(ContainerStyle::Good), hostConfig.GetBackgroundColorRef(ContainerStyle::Good));
+            Assert::AreEqual(hostConfig.GetForegroundColor(ContainerStyle::Accent, ForegroundColor::Warning, true),
+                             hostConfig.GetForegroundColorRef(ContainerStyle::Accent, ForegroundColor::Warning, true));
+        }
+    };
+}
@@ -0,0 +1,83 @@
+#include "stdafx.h"
+#include "ParseContext.h"
+#include "ResourcePrefetchPlan.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","backgroundImage":"bg.png","body":[
+            {"type":"Image","url":"hidden.png","isVisible":false},
+            {"type":"Container","isVisible":false,"items":[{"type":"Image","url":"nested.png"}]},
+            {"type":"Image","url":"a.png","width":"40px","height":"30px"},
+            {"type":"Image","url":"a.png","width":"80px"},
+            {"type":"Container","backgroundImage":"c.png","items":[{"type":"Image","url":"hidden.png"}]},
+            {"type":"Media","poster":"poster.png","sources":[{"mimeType":"video/mp4","url":"clip.mp4"}]},
+            {"type":"Image","url":"d.png","fallback":{"type":"Image","url":"fallback.png"}}],
+            "actions":[{"type":"Action.OpenUrl","title":"Go","iconUrl":"icon.png","url":"https://x.y/page"},
+                       {"type":"Action.ShowCard","title":"More","card":{"type":"AdaptiveCard","body":[
+                           {"type":"Image","url":"shown.png"},{"type":"Image","url":"a.png"}]}}]})";
+    }
+
+    TEST_CLASS(ResourcePrefetchPlanTest)
+    {
+    public:
+        TEST_METHOD(PlanIsDedupedAndVisibleFirst)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2")->GetAdaptiveCard();
+            const auto plan = BuildPrefetchPlan(*card);
+
+            std::string urls;
+            for (const auto& resource : plan)
+            {
+                urls += resource.url + (resource.isInitiallyVisible ? " " : "? ");
+            }
+            // hidden.png is shown in the second container, so it comes with the visible resources
+            Assert::AreEqual("bg.png hidden.png a.png c.png poster.png clip.mp4 d.png icon.png "
+                             "nested.png? fallback.png? shown.png? "s,
+                             urls);
+
+            Assert::IsTrue(plan[0].kind == UrlKind::BackgroundImage);
+            Assert::IsTrue(plan[3].kind == UrlKind::BackgroundImage);
+            Assert::IsTrue(plan[4].kind == UrlKind::MediaPoster);
+            Assert::IsTrue(plan[5].kind == UrlKind::MediaSource);
+            Assert::AreEqual("video/mp4"s, plan[5].mimeType);
+            Assert::IsTrue(plan[7].kind == UrlKind::ActionIcon);
+
+            // the first pixel size given for a.png wins
+            Assert::AreEqual(40u, plan[2].pixelWidth);
+            Assert::AreEqual(30u, plan[2].pixelHeight);
+            Assert::AreEqual(0u, plan[1].pixelWidth);
+        }
+
+        TEST_METHOD(ResourceCallbackReportsEachUrlOnce)
+        {
+            std::vector<std::string> reported;
+            ParseContext context;
+            context.SetUrlRewriter([](UrlKind, std::string& url) { url.insert(0, "https://cdn.example/"); });
+            context.SetResourceCallback([&reported](UrlKind kind, const std::string& url) {
+                Assert::IsTrue(kind != UrlKind::OpenUrl);
+                reported.push_back(url);
+            });
+
+            AdaptiveCard::DeserializeFromString(c_cardJson, "1.2", context);
+
+            // reported as parsed, so in parse order rather than by visibility, and after rewriting
+            Assert::AreEqual(static_cast<size_t>(11), reported.size());
+            Assert::AreEqual("https://cdn.example/bg.png"s, reported[0]);
+            Assert::AreEqual("https://cdn.example/hidden.png"s, reported[1]);
+            Assert::AreEqual(static_cast<std::ptrdiff_t>(1),
+                             std::count(reported.begin(), reported.end(), "https://cdn.example/a.png"s));
+
+            // the next card parsed with the context reports its urls afresh
+            reported.clear();
+            AdaptiveCard::DeserializeFromString(c_cardJson, "1.2", context);
+            Assert::AreEqual(static_cast<size_t>(11), reported.size());
+        }
+    };
+}
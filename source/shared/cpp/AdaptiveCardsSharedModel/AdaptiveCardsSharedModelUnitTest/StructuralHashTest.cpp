@@ -0,0 +1,193 @@
+#include "stdafx.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ContentHash.h"
+#include "FactSet.h"
+#include "ParseResult.h"
+#include "ShowCardAction.h"
+#include "TextBlock.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    TEST_CLASS(StructuralHashTest)
+    {
+    public:
+        TEST_METHOD(ComposedCardHashMatchesFullHash)
+        {
+            std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","speak":"hi",
+                "body":[
+                    {"type":"Container","items":[{"type":"TextBlock","text":"a"},{"type":"Image","url":"http://a/b.png"}]},
+                    {"type":"ColumnSet","columns":[{"type":"Column","width":"auto","items":[{"type":"TextBlock","text":"b"}]}]},
+                    {"type":"TextBlock","text":"c","fallback":{"type":"TextBlock","text":"d"}}],
+                "actions":[{"type":"Action.ShowCard","title":"more","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"e"}]}}]})";
+
+            auto parseResult = AdaptiveCard::DeserializeFromString(cardJson, "1.2");
+
+            Assert::IsTrue(parseResult->GetContentHash() == parseResult->GetAdaptiveCard()->ComputeContentHash());
+
+            // the fallback text card for an unsupported version, and results built around an existing card
+            auto fallbackResult = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"9.0","fallbackText":"old"})", "1.2");
+            Assert::IsTrue(fallbackResult->GetContentHash() == fallbackResult->GetAdaptiveCard()->ComputeContentHash());
+            ParseResult wrapped(parseResult->GetAdaptiveCard(), {});
+            Assert::IsTrue(wrapped.GetContentHash() == parseResult->GetContentHash());
+        }
+
+        TEST_METHOD(IdenticalSubtreesHashAlike)
+        {
+            std::string first = R"({"type":"AdaptiveCard","version":"1.0","body":[
+                {"type":"TextBlock","text":"first"},
+                {"type":"Container","items":[{"type":"TextBlock","text":"shared","wrap":true}]}]})";
+            std::string second = R"({"type":"AdaptiveCard","version":"1.0","body":[
+                {"type":"Container","items":[{"wrap":true,"text":"shared","type":"TextBlock"}]}]})";
+
+            auto firstCard = AdaptiveCard::DeserializeFromString(first, "1.0")->GetAdaptiveCard();
+            auto secondCard = AdaptiveCard::DeserializeFromString(second, "1.0")->GetAdaptiveCard();
+
+            Assert::IsTrue(firstCard->GetBody()[1]->GetStructuralHash() == secondCard->GetBody()[0]->GetStructuralHash());
+            Assert::IsTrue(firstCard->GetBody()[0]->GetStructuralHash() != secondCard->GetBody()[0]->GetStructuralHash());
+        }
+
+        TEST_METHOD(ChildChangePropagatesToAncestorsOnly)
+        {
+            std::string first = R"({"type":"AdaptiveCard","version":"1.0","body":[
+                {"type":"TextBlock","text":"sibling"},
+                {"type":"ColumnSet","columns":[{"type":"Column","items":[{"type":"TextBlock","text":"one"}]}]}]})";
+            std::string second = R"({"type":"AdaptiveCard","version":"1.0","body":[
+                {"type":"TextBlock","text":"sibling"},
+                {"type":"ColumnSet","columns":[{"type":"Column","items":[{"type":"TextBlock","text":"two"}]}]}]})";
+
+            auto firstResult = AdaptiveCard::DeserializeFromString(first, "1.0");
+            auto secondResult = AdaptiveCard::DeserializeFromString(second, "1.0");
+            auto firstBody = firstResult->GetAdaptiveCard()->GetBody();
+            auto secondBody = secondResult->GetAdaptiveCard()->GetBody();
+
+            Assert::IsTrue(firstBody[0]->GetStructuralHash() == secondBody[0]->GetStructuralHash());
+            Assert::IsTrue(firstBody[1]->GetStructuralHash() != secondBody[1]->GetStructuralHash());
+            Assert::IsTrue(firstResult->GetContentHash() != secondResult->GetContentHash());
+
+            auto firstColumn = std::static_pointer_cast<ColumnSet>(firstBody[1])->GetColumns()[0];
+            auto secondColumn = std::static_pointer_cast<ColumnSet>(secondBody[1])->GetColumns()[0];
+            Assert::IsTrue(firstColumn->GetStructuralHash() != secondColumn->GetStructuralHash());
+        }
+
+        TEST_METHOD(ActionsAndFallbackContributeToHash)
+        {
+            std::string base = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","selectAction":{"type":"Action.OpenUrl","url":"http://a"},"items":[],
+                 "fallback":{"type":"TextBlock","text":"x"}}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"y"}]}}]})";
+            std::string selectActionChanged = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","selectAction":{"type":"Action.OpenUrl","url":"http://b"},"items":[],
+                 "fallback":{"type":"TextBlock","text":"x"}}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"y"}]}}]})";
+            std::string fallbackChanged = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","selectAction":{"type":"Action.OpenUrl","url":"http://a"},"items":[],
+                 "fallback":{"type":"TextBlock","text":"z"}}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"y"}]}}]})";
+            std::string showCardChanged = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","selectAction":{"type":"Action.OpenUrl","url":"http://a"},"items":[],
+                 "fallback":{"type":"TextBlock","text":"x"}}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"z"}]}}]})";
+
+            auto baseCard = AdaptiveCard::DeserializeFromString(base, "1.2")->GetAdaptiveCard();
+            auto selectActionCard = AdaptiveCard::DeserializeFromString(selectActionChanged, "1.2")->GetAdaptiveCard();
+            auto fallbackCard = AdaptiveCard::DeserializeFromString(fallbackChanged, "1.2")->GetAdaptiveCard();
+            auto showCardCard = AdaptiveCard::DeserializeFromString(showCardChanged, "1.2")->GetAdaptiveCard();
+
+            Assert::IsTrue(baseCard->GetBody()[0]->GetStructuralHash() != selectActionCard->GetBody()[0]->GetStructuralHash());
+            Assert::IsTrue(baseCard->GetBody()[0]->GetStructuralHash() != fallbackCard->GetBody()[0]->GetStructuralHash());
+            Assert::IsTrue(baseCard->GetBody()[0]->GetStructuralHash() == showCardCard->GetBody()[0]->GetStructuralHash());
+            Assert::IsTrue(baseCard->GetActions()[0]->GetStructuralHash() != showCardCard->GetActions()[0]->GetStructuralHash());
+        }
+
+        TEST_METHOD(HashesFollowMutation)
+        {
+            std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","items":[{"type":"ColumnSet","columns":[{"type":"Column","items":[{"type":"TextBlock","text":"before"}]}]}]},
+                {"type":"TextBlock","text":"sibling"}],
+                "actions":[{"type":"Action.ShowCard","card":{"type":"AdaptiveCard","body":[{"type":"TextBlock","text":"shown"}]}}]})";
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            auto container = card->GetBody()[0];
+            auto column = std::static_pointer_cast<ColumnSet>(std::static_pointer_cast<Container>(container)->GetItems()[0])->GetColumns()[0];
+            auto textBlock = std::static_pointer_cast<TextBlock>(column->GetItems()[0]);
+            const auto matchesFullHash = [](const BaseElement& element) {
+                return element.GetStructuralHash() == ContentHashUtil::HashJson(element.SerializeToJsonValue());
+            };
+
+            // a setter deep in the tree reaches every ancestor's hash, and leaves the sibling's alone
+            const ContentHash parsedHash = container->GetStructuralHash();
+            const ContentHash siblingHash = card->GetBody()[1]->GetStructuralHash();
+            textBlock->SetText("after");
+            Assert::IsTrue(parsedHash != container->GetStructuralHash());
+            Assert::IsTrue(matchesFullHash(*textBlock));
+            Assert::IsTrue(matchesFullHash(*column));
+            Assert::IsTrue(matchesFullHash(*container));
+            Assert::IsTrue(siblingHash == card->GetBody()[1]->GetStructuralHash());
+            Assert::IsTrue(card->ComputeContentHash() == ContentHashUtil::HashJson(card->SerializeToJsonValue()));
+
+            // so do lists changed through non-const accessors, and the cards of ShowCard actions
+            column->GetItems().push_back(std::make_shared<TextBlock>());
+            Assert::IsTrue(matchesFullHash(*container));
+            auto showCard = std::static_pointer_cast<ShowCardAction>(card->GetActions()[0]);
+            const ContentHash showCardHash = showCard->GetStructuralHash();
+            showCard->GetCard()->SetSpeak("shown");
+            Assert::IsTrue(showCardHash != showCard->GetStructuralHash());
+            Assert::IsTrue(matchesFullHash(*showCard));
+
+            // elements that were never parsed hash on demand
+            auto unparsed = std::make_shared<TextBlock>();
+            unparsed->SetText("after");
+            Assert::IsTrue(unparsed->GetStructuralHash() == textBlock->GetStructuralHash());
+            unparsed->SetText("later");
+            Assert::IsTrue(unparsed->GetStructuralHash() != textBlock->GetStructuralHash());
+        }
+
+        TEST_METHOD(CachedHashesFollowEdits)
+        {
+            std::string cardJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+                {"type":"Container","items":[{"type":"TextBlock","text":"first"}]},
+                {"type":"FactSet","facts":[{"title":"a","value":"b"}]}]})";
+            auto card = AdaptiveCard::DeserializeFromString(cardJson, "1.2")->GetAdaptiveCard();
+            const auto& container = static_cast<const Container&>(*card->GetBody()[0]);
+            StructuralHashCache cache;
+            const auto matchesFullHash = [&cache, &card]() {
+                const ContentHash hash = cache.Get(*card);
+                cache.Prune();
+                return hash == ContentHashUtil::HashJson(card->SerializeToJsonValue());
+            };
+            Assert::IsTrue(cache.Get(*card) == card->ComputeContentHash());
+
+            std::static_pointer_cast<TextBlock>(container.GetItems()[0])->SetText("second");
+            Assert::IsTrue(matchesFullHash());
+            std::static_pointer_cast<FactSet>(card->GetBody()[1])->SetFact(0, "a", "c");
+            Assert::IsTrue(matchesFullHash());
+
+            // lists are read through const access, so edits made past the accessors count too
+            const_cast<std::vector<std::shared_ptr<BaseCardElement>>&>(container.GetItems()).clear();
+            Assert::IsTrue(matchesFullHash());
+            const_cast<std::vector<std::shared_ptr<BaseCardElement>>&>(container.GetItems()).push_back(std::make_shared<TextBlock>());
+            Assert::IsTrue(matchesFullHash());
+
+            // an element nested in two trees
+            auto shared = std::make_shared<TextBlock>();
+            auto first = std::make_shared<Container>();
+            auto second = std::make_shared<Container>();
+            first->GetItems().push_back(shared);
+            second->GetItems().push_back(shared);
+            cache.Get(*first);
+            cache.Get(*second);
+            shared->SetText("shared");
+            Assert::IsTrue(cache.Get(*first) == ContentHashUtil::HashJson(first->SerializeToJsonValue()));
+            Assert::IsTrue(cache.Get(*second) == ContentHashUtil::HashJson(second->SerializeToJsonValue()));
+
+            // frozen trees read their stored hashes
+            card->Freeze();
+            Assert::IsTrue(matchesFullHash());
+            Assert::IsTrue(card->ComputeContentHash() == cache.Get(*card));
+        }
+    };
+}
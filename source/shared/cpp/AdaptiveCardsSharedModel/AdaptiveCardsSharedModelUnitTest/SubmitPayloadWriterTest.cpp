@@ -0,0 +1,112 @@
+#include "stdafx.h"
+#include "SubmitPayloadWriter.h"
+#include "ActionSet.h"
+#include "CardState.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include <chrono>
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_formJson = R"({"type":"AdaptiveCard","version":"1.2","body":[
+            {"type":"Input.Text","id":"name","value":"Ada"},
+            {"type":"Input.Number","id":"age","value":36},
+            {"type":"ActionSet","actions":[{"type":"Action.Submit","title":"Plain"}]},
+            {"type":"Image","url":"https://a.b/c.png","fallback":{"type":"Input.Text","id":"hidden"}}],
+            "actions":[
+                {"type":"Action.Submit","title":"Save","data":{"kind":"save","name":"overridden","n":[1,2]}},
+                {"type":"Action.Submit","title":"Raw","data":"just text"},
+                {"type":"Action.ShowCard","title":"More","card":{"type":"AdaptiveCard","body":[
+                    {"type":"Input.Toggle","id":"agree","title":"Agree","value":"true"}],
+                    "actions":[{"type":"Action.Submit","title":"Nested"}]}}]})";
+
+        const SubmitAction& ActionAt(const AdaptiveCard& card, std::size_t index)
+        {
+            return static_cast<const SubmitAction&>(*card.GetActions()[index]);
+        }
+    }
+
+    TEST_CLASS(SubmitPayloadWriterTest)
+    {
+    public:
+        TEST_METHOD(PayloadsFollowScopeAndData)
+        {
+            const auto card = AdaptiveCard::DeserializeFromString(c_formJson, "1.2")->GetAdaptiveCard();
+            const auto writer = SubmitPayloadWriter::Compile(card);
+            const auto& plain = static_cast<const SubmitAction&>(
+                *std::static_pointer_cast<ActionSet>(card->GetBody()[2])->GetActions()[0]);
+            const auto& nested = ActionAt(*std::static_pointer_cast<ShowCardAction>(card->GetActions()[2])->GetCard(), 0);
+
+            std::string payload;
+            writer.Write(plain, payload);
+            Assert::AreEqual(R"({"name":"Ada","age":"36"})"s, payload);
+
+            // inputs replace data members of the same name
+            payload.clear();
+            writer.Write(ActionAt(*card, 0), payload);
+            Assert::AreEqual(R"({"kind":"save","n":[1,2],"name":"Ada","age":"36"})"s, payload);
+
+            payload.clear();
+            writer.Write(ActionAt(*card, 1), payload);
+            Assert::AreEqual(R"("just text")"s, payload);
+
+            // a ShowCard's card submits its own inputs along with the enclosing card's
+            CardState state(card);
+            state.SetInputValue("name", "Zoë \"Z\"");
+            state.SetInputValue("agree", "false");
+            Assert::AreEqual(R"({"name":"Zo\u00eb \"Z\"","age":"36","agree":"false"})"s, writer.GetPayload(nested, state));
+            Assert::AreEqual(R"({"name":"Zo\u00eb \"Z\"","age":"36"})"s, writer.GetPayload(plain, state));
+
+            // the same as merging with jsoncpp
+            Json::Value merged = ActionAt(*card, 0).GetDataJsonAsValue();
+            merged["name"] = "Zoë \"Z\"";
+            merged["age"] = "36";
+            Assert::IsTrue(merged == ParseUtil::GetJsonValueFromString(writer.GetPayload(ActionAt(*card, 0), state)));
+
+            const auto other = AdaptiveCard::DeserializeFromString(c_formJson, "1.2")->GetAdaptiveCard();
+            Assert::ExpectException<AdaptiveCardParseException>([&]() { writer.GetPayload(ActionAt(*other, 0), state); });
+        }
+
+        TEST_METHOD(LargeFormPayloadTime)
+        {
+            const size_t count = 2000;
+            std::string body;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const std::string n = std::to_string(i);
+                body += R"({"type":"Input.Text","id":"field)" + n + R"(","value":"value )" + n + R"("},)";
+            }
+            const auto card = AdaptiveCard::DeserializeFromString(R"({"type":"AdaptiveCard","version":"1.2","body":[)" + body +
+                                                                      R"({"type":"TextBlock","text":"end"}],
+                                                                      "actions":[{"type":"Action.Submit","data":{"form":"large"}}]})",
+                                                                  "1.2")
+                                  ->GetAdaptiveCard();
+            const auto writer = SubmitPayloadWriter::Compile(card);
+            CardState state(card);
+            state.SetInputValue("field7", "seven");
+
+            const auto start = std::chrono::steady_clock::now();
+            std::string payload;
+            writer.Write(ActionAt(*card, 0), state, payload);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            const auto parsed = ParseUtil::GetJsonValueFromString(payload);
+            Assert::AreEqual(static_cast<Json::ArrayIndex>(count + 1), parsed.size());
+            Assert::AreEqual("seven"s, parsed["field7"].asString());
+            Assert::AreEqual("value 1999"s, parsed["field1999"].asString());
+            Assert::AreEqual("large"s, parsed["form"].asString());
+
+            Logger::WriteMessage(("Payload of "s + std::to_string(count) + " inputs: " +
+                                  std::to_string(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count()) + "us")
+                                     .c_str());
+        }
+    };
+}
@@ -0,0 +1,103 @@
+#include "stdafx.h"
+#include "BackgroundImage.h"
+#include "Container.h"
+#include "Image.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "OpenUrlAction.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace AdaptiveCards;
+using namespace std::string_literals;
+
+namespace AdaptiveCardsSharedModelUnitTest
+{
+    namespace
+    {
+        const std::string c_cardJson = R"({"type":"AdaptiveCard","version":"1.2","backgroundImage":"bg.png","body":[
+            {"type":"Image","url":"a.png"},
+            {"type":"Image","url":"a.png"},
+            {"type":"Container","backgroundImage":{"url":"https://x.y/c.png","fillMode":"repeat"},"items":[]},
+            {"type":"Media","poster":"poster.png","sources":[{"mimeType":"video/mp4","url":"clip.mp4"}]}],
+            "actions":[{"type":"Action.OpenUrl","title":"Go","iconUrl":"icon.png","url":"https://x.y/page"},
+                       {"type":"Action.Submit","title":"Send"}]})";
+
+        const char* KindName(UrlKind kind)
+        {
+            switch (kind)
+            {
+            case UrlKind::Image:
+                return "image";
+            case UrlKind::BackgroundImage:
+                return "background";
+            case UrlKind::MediaSource:
+                return "source";
+            case UrlKind::MediaPoster:
+                return "poster";
+            case UrlKind::ActionIcon:
+                return "icon";
+            case UrlKind::OpenUrl:
+            default:
+                return "open";
+            }
+        }
+    }
+
+    TEST_CLASS(UrlRewriteTest)
+    {
+    public:
+        TEST_METHOD(RewritesEveryUrlProperty)
+        {
+            std::string calls;
+            ParseContext context;
+            context.SetUrlRewriter([&calls](UrlKind kind, std::string& url) {
+                calls += std::string(KindName(kind)) + ":" + url + " ";
+                if (url.find("://") == std::string::npos)
+                {
+                    // as resolving HostConfig's imageBaseUrl
+                    url.insert(0, "https://cdn.example/");
+                }
+            });
+
+            const auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2", context)->GetAdaptiveCard();
+            Assert::AreEqual("background:bg.png image:a.png image:a.png background:https://x.y/c.png poster:poster.png "
+                             "source:clip.mp4 icon:icon.png open:https://x.y/page "s,
+                             calls);
+
+            const auto& body = card->GetBody();
+            Assert::AreEqual("https://cdn.example/bg.png"s, card->GetBackgroundImage()->GetUrl());
+            Assert::AreEqual("https://cdn.example/a.png"s, std::static_pointer_cast<Image>(body[0])->GetUrl());
+            Assert::AreEqual("https://x.y/c.png"s, std::static_pointer_cast<Container>(body[2])->GetBackgroundImage()->GetUrl());
+            const auto media = std::static_pointer_cast<Media>(body[3]);
+            Assert::AreEqual("https://cdn.example/poster.png"s, media->GetPoster());
+            Assert::AreEqual("https://cdn.example/clip.mp4"s, media->GetSources()[0]->GetUrl());
+            Assert::AreEqual("https://cdn.example/icon.png"s, card->GetActions()[0]->GetIconUrl());
+            Assert::AreEqual("https://x.y/page"s, std::static_pointer_cast<OpenUrlAction>(card->GetActions()[0])->GetUrl());
+        }
+
+        TEST_METHOD(MemoRewritesRepeatedUrlsOnce)
+        {
+            int calls = 0;
+            ParseContext context;
+            context.SetUrlRewriter(
+                [&calls](UrlKind, std::string& url) {
+                    ++calls;
+                    url += "?proxied";
+                },
+                2);
+
+            const auto card = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2", context)->GetAdaptiveCard();
+            // the second a.png comes from the memo
+            Assert::AreEqual(7, calls);
+            Assert::AreEqual("a.png?proxied"s, std::static_pointer_cast<Image>(card->GetBody()[1])->GetUrl());
+            Assert::AreEqual("icon.png?proxied"s, card->GetActions()[0]->GetIconUrl());
+
+            // without a rewriter urls are kept as they are
+            ParseContext plain;
+            const auto unchanged = AdaptiveCard::DeserializeFromString(c_cardJson, "1.2", plain)->GetAdaptiveCard();
+            Assert::AreEqual("a.png"s, std::static_pointer_cast<Image>(unchanged->GetBody()[0])->GetUrl());
+        }
+    };
+}
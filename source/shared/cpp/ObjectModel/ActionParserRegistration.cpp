@@ -9,6 +9,11 @@
 #include "ToggleVisibilityAction.h"
 #include "UnknownAction.h"
 
+namespace
+{
+    std::atomic<std::uint64_t> s_lastFingerprint{0};
+}
+
 namespace AdaptiveSharedNamespace
 {
     ActionElementParserWrapper::ActionElementParserWrapper(std::shared_ptr<ActionElementParser> parserToWrap) :
@@ -20,14 +25,21 @@ namespace AdaptiveSharedNamespace
     {
         const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
         const AdaptiveSharedNamespace::InternalId internalId = AdaptiveSharedNamespace::InternalId::Next();
+        const std::size_t ordinal = context.NextElementOrdinal();
+
         context.PushElement(idProperty, internalId);
         std::shared_ptr<BaseActionElement> element = m_parser->Deserialize(context, value);
         context.PopElement();
 
+        if (element != nullptr)
+        {
+            context.AddToElementIndex(element, ordinal);
+        }
+
         return element;
     }
 
-    ActionParserRegistration::ActionParserRegistration()
+    ActionParserRegistration::ActionParserRegistration() : m_fingerprint(0)
     {
         m_knownElements.insert({
             ActionTypeToString(ActionType::OpenUrl),
@@ -43,6 +55,17 @@ namespace AdaptiveSharedNamespace
              {ActionTypeToString(ActionType::Submit), std::make_shared<SubmitActionParser>()},
              {ActionTypeToString(ActionType::ToggleVisibility), std::make_shared<ToggleVisibilityActionParser>()},
              {ActionTypeToString(ActionType::UnknownAction), std::make_shared<UnknownActionParser>()}});
+
+        // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
+        // collision detection. We *could* do this within the implementation of parsers themselves, but that would
+        // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
+        // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
+        // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
+        // The wrappers hold no parsing state, so each parser is wrapped once, when it is registered.
+        for (auto& parser : m_cardElementParsers)
+        {
+            parser.second = std::make_shared<ActionElementParserWrapper>(parser.second);
+        }
     }
 
     void ActionParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<ActionElementParser> parser)
@@ -50,7 +73,8 @@ namespace AdaptiveSharedNamespace
         // make sure caller isn't attempting to overwrite a known element's parser
         if (m_knownElements.find(elementType) == m_knownElements.end())
         {
-            ActionParserRegistration::m_cardElementParsers[elementType] = parser;
+            ActionParserRegistration::m_cardElementParsers[elementType] = std::make_shared<ActionElementParserWrapper>(parser);
+            m_fingerprint = ++s_lastFingerprint;
         }
         else
         {
@@ -64,6 +88,7 @@ namespace AdaptiveSharedNamespace
         if (m_knownElements.find(elementType) == m_knownElements.end())
         {
             ActionParserRegistration::m_cardElementParsers.erase(elementType);
+            m_fingerprint = ++s_lastFingerprint;
         }
         else
         {
@@ -76,17 +101,13 @@ namespace AdaptiveSharedNamespace
         auto parser = m_cardElementParsers.find(elementType);
         if (parser != ActionParserRegistration::m_cardElementParsers.end())
         {
-            // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
-            // collision detection. We *could* do this within the implementation of parsers themselves, but that would
-            // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
-            // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
-            // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-            std::shared_ptr<ActionElementParser> wrappedParser = std::make_shared<ActionElementParserWrapper>(parser->second);
-            return wrappedParser;
+            return parser->second;
         }
         else
         {
             return std::shared_ptr<ActionElementParser>(nullptr);
         }
     }
+
+    std::uint64_t ActionParserRegistration::GetFingerprint() const { return m_fingerprint; }
 }
@@ -8,17 +8,16 @@ using namespace AdaptiveCards;
 
 ActionSet::ActionSet() : BaseCardElement(CardElementType::ActionSet), m_actions{}, m_orientation(ActionsOrientation::Vertical)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ActionSet::ActionSet(std::vector<std::shared_ptr<BaseActionElement>>& actions) :
     BaseCardElement(CardElementType::ActionSet), m_actions(actions), m_orientation(ActionsOrientation::Vertical)
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::vector<std::shared_ptr<BaseActionElement>>& ActionSet::GetActions()
 {
+    ThrowIfFrozen();
     return m_actions;
 }
 
@@ -36,7 +35,7 @@ Json::Value ActionSet::SerializeToJsonValue() const
 
     for (const auto& actionElement : m_actions)
     {
-        root[actionsPropertyName].append(actionElement->SerializeToJsonValue());
+        root[actionsPropertyName].append(SerializeNested(*actionElement));
     }
 
     return root;
@@ -62,5 +61,39 @@ std::shared_ptr<BaseCardElement> ActionSetParser::DeserializeFromString(ParseCon
 
 void ActionSet::PopulateKnownPropertiesSet()
 {
+    BaseCardElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert(AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions));
 }
+
+void ActionSet::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    for (unsigned int i = 0; i < m_actions.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Actions, i, *m_actions[i]);
+    }
+}
+
+void ActionSet::Freeze()
+{
+    for (const auto& action : m_actions)
+    {
+        action->Freeze();
+    }
+    BaseCardElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> ActionSet::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void ActionSet::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    for (auto& action : m_actions)
+    {
+        action = std::static_pointer_cast<BaseActionElement>(action->Clone());
+    }
+}
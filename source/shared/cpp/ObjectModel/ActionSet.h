@@ -16,11 +16,15 @@ namespace AdaptiveCards
         ActionSet(std::vector<std::shared_ptr<BaseActionElement>>& actions);
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         std::vector<std::shared_ptr<BaseActionElement>>& GetActions();
         const std::vector<std::shared_ptr<BaseActionElement>>& GetActions() const;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
         std::vector<std::shared_ptr<AdaptiveCards::BaseActionElement>> m_actions;
         ActionsOrientation m_orientation;
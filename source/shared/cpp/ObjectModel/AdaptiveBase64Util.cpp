@@ -5,7 +5,12 @@
 #endif
 
 #include "AdaptiveBase64Util.h"
-#include <map>
+
+// MSVC never defines __SSSE3__, but any target with AVX has SSSE3
+#if defined(__SSSE3__) || defined(__AVX__)
+#define ADAPTIVE_BASE64_SSSE3
+#include <tmmintrin.h>
+#endif
 
 /*
 * Copyright (C) 2013 Tomas Kislan
@@ -22,217 +27,309 @@ Portions Copyright Microsoft Corporation
 
 using namespace AdaptiveSharedNamespace;
 
-const char c_base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
-                                "abcdefghijklmnopqrstuvwxyz"
-                                "0123456789+/";
-
-void GetBase64Alphabet(std::map<char, int>* base64AlphabetOut)
-{
-    static std::map<char, int> base64Alphabet = {
-        {'A', 0}, {'B', 1}, {'C', 2}, {'D', 3}, {'E', 4}, {'F', 5}, {'G', 6}, {'H', 7}, {'I', 8}, {'J', 9}, {'K', 10}, {'L', 11},
-        {'M', 12}, {'N', 13}, {'O', 14}, {'P', 15}, {'Q', 16}, {'R', 17}, {'S', 18}, {'T', 19}, {'U', 20}, {'V', 21}, {'W', 22},
-        {'X', 23}, {'Y', 24}, {'Z', 25}, {'a', 26}, {'b', 27}, {'c', 28}, {'d', 29}, {'e', 30}, {'f', 31}, {'g', 32}, {'h', 33},
-        {'i', 34}, {'j', 35}, {'k', 36}, {'l', 37}, {'m', 38}, {'n', 39}, {'o', 40}, {'p', 41}, {'q', 42}, {'r', 43}, {'s', 44},
-        {'t', 45}, {'u', 46}, {'v', 47}, {'w', 48}, {'x', 49}, {'y', 50}, {'z', 51}, {'0', 52}, {'1', 53}, {'2', 54}, {'3', 55},
-        {'4', 56}, {'5', 57}, {'6', 58}, {'7', 59}, {'8', 60}, {'9', 61}, {'+', 62}, {'/', 63},
-    };
-
-    *base64AlphabetOut = base64Alphabet;
-}
-
-size_t AdaptiveBase64Util::DecodedLength(const char* in, size_t in_length)
+namespace
 {
-    int numEq{};
-
-    const char *in_end{ in + in_length };
-    while (*--in_end == '=')
+    const char c_base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+                                    "abcdefghijklmnopqrstuvwxyz"
+                                    "0123456789+/";
+
+    const unsigned char c_invalidValue = 255;
+
+    // Each character's value in the alphabet, or c_invalidValue
+    const unsigned char c_base64Values[256] = {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,  62, 255, 255, 255,  63,
+         52,  53,  54,  55,  56,  57,  58,  59,  60,  61, 255, 255, 255, 255, 255, 255,
+        255,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+         15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, 255, 255, 255, 255, 255,
+        255,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+         41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+
+    bool IsWhitespace(char c) { return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v'; }
+
+    void EncodeGroup(const unsigned char* in, char* out)
     {
-        ++numEq;
+        const unsigned int bits = (in[0] << 16) | (in[1] << 8) | in[2];
+        out[0] = c_base64Alphabet[bits >> 18];
+        out[1] = c_base64Alphabet[(bits >> 12) & 0x3F];
+        out[2] = c_base64Alphabet[(bits >> 6) & 0x3F];
+        out[3] = c_base64Alphabet[bits & 0x3F];
     }
 
-    return ((6 * in_length) / 8) - numEq;
-}
-
-size_t AdaptiveBase64Util::DecodedLength(const std::string& in)
-{
-    size_t numEq{};
-    size_t n{ in.size() };
-
-    for (auto it = in.rbegin(); (numEq < n) && (*it == '='); ++it)
+    // Writes the first length bytes held by a group of four 6 bit values
+    void WriteGroup(const unsigned char* values, size_t length, char* out)
     {
-        ++numEq;
+        const unsigned int bits = (values[0] << 18) | (values[1] << 12) | (values[2] << 6) | values[3];
+        for (size_t i = 0; i < length; ++i)
+        {
+            out[i] = static_cast<char>(bits >> (16 - 8 * i));
+        }
     }
 
-    return ((6 * n) / 8) - numEq;
-}
+#ifdef ADAPTIVE_BASE64_SSSE3
+    // Encodes the first 12 bytes of in into 16 characters (after Muła and Lemire, "Faster Base64 Encoding and Decoding
+    // Using AVX2 Instructions")
+    __m128i EncodeBlock(__m128i in)
+    {
+        // spreads each 3 bytes over a 32 bit lane, then moves each of their 6 bit indices into a byte of its own
+        in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+        const __m128i high = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+        const __m128i low = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(high, low);
+
+        // the offset from an index to its character is the same throughout each of A-Z, a-z, 0-9, '+' and '/'; reduce
+        // the indices to one slot of the offset table per range
+        __m128i ranges = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i isUpper = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        ranges = _mm_or_si128(ranges, _mm_and_si128(isUpper, _mm_set1_epi8(13)));
+        const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                              '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+        return _mm_add_epi8(indices, _mm_shuffle_epi8(offsets, ranges));
+    }
 
-size_t AdaptiveBase64Util::EncodedLength(size_t length)
-{
-    return ((length + 2 - ((length + 2) % 3)) / 3) * 4;
-}
+    // Decodes 16 characters into the first 12 bytes of out; returns false if any of them is outside the alphabet
+    bool DecodeBlock(__m128i in, __m128i& out)
+    {
+        const __m128i isUpper = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('Z' + 1)));
+        const __m128i isLower = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('z' + 1)));
+        const __m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(in, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(in, _mm_set1_epi8('9' + 1)));
+        const __m128i isPlus = _mm_cmpeq_epi8(in, _mm_set1_epi8('+'));
+        const __m128i isSlash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+        const __m128i isValid = _mm_or_si128(_mm_or_si128(_mm_or_si128(isUpper, isLower), _mm_or_si128(isDigit, isPlus)), isSlash);
+        if (_mm_movemask_epi8(isValid) != 0xFFFF)
+        {
+            return false;
+        }
 
-size_t AdaptiveBase64Util::EncodedLength(const std::vector<char>& in)
-{
-    return EncodedLength(in.size());
-}
+        __m128i shift = _mm_and_si128(isUpper, _mm_set1_epi8(-'A'));
+        shift = _mm_or_si128(shift, _mm_and_si128(isLower, _mm_set1_epi8(26 - 'a')));
+        shift = _mm_or_si128(shift, _mm_and_si128(isDigit, _mm_set1_epi8(52 - '0')));
+        shift = _mm_or_si128(shift, _mm_and_si128(isPlus, _mm_set1_epi8(62 - '+')));
+        shift = _mm_or_si128(shift, _mm_and_si128(isSlash, _mm_set1_epi8(63 - '/')));
+        const __m128i values = _mm_add_epi8(in, shift);
+
+        // each 32 bit lane holds the values a, b, c and d: combine them into (a << 18) | (b << 12) | (c << 6) | d,
+        // then gather the three low bytes of each lane, most significant first
+        const __m128i pairs = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        const __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+        out = _mm_shuffle_epi8(groups, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+        return true;
+    }
+#endif
 
-void AdaptiveBase64Util::StripPadding(std::string* in)
-{
-    while (!in->empty() && *(in->rbegin()) == '=')
+    // Decodes the leading run of whole 4-character groups that hold only alphabet characters, writing 3 bytes per group
+    // to out, which must have room for MaxDecodedLength(length) bytes. Returns the number of characters decoded.
+    size_t DecodeGroups(const char* in, size_t length, char* out)
     {
-        in->resize(in->size() - 1);
+        size_t position = 0;
+#ifdef ADAPTIVE_BASE64_SSSE3
+        // a block stores 16 bytes for the 12 it decodes, which out has room for while 24 characters remain
+        while (length - position >= 24)
+        {
+            __m128i decoded;
+            if (!DecodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + position)), decoded))
+            {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out), decoded);
+            position += 16;
+            out += 12;
+        }
+#endif
+
+        const unsigned char* characters = reinterpret_cast<const unsigned char*>(in);
+        for (; length - position >= 4; position += 4, out += 3)
+        {
+            const unsigned char values[4] = {c_base64Values[characters[position]],
+                                             c_base64Values[characters[position + 1]],
+                                             c_base64Values[characters[position + 2]],
+                                             c_base64Values[characters[position + 3]]};
+            // valid values fit in 6 bits
+            if ((values[0] | values[1] | values[2] | values[3]) & 0xC0)
+            {
+                break;
+            }
+            WriteGroup(values, 3, out);
+        }
+        return position;
     }
 }
 
-void AdaptiveBase64Util::a3_to_a4(unsigned char* a4, unsigned char* a3)
+size_t AdaptiveBase64Util::EncodedLength(size_t length)
 {
-    a4[0] = (a3[0] & 0xfc) >> 2;
-    a4[1] = ((a3[0] & 0x03) << 4) + ((a3[1] & 0xf0) >> 4);
-    a4[2] = ((a3[1] & 0x0f) << 2) + ((a3[2] & 0xc0) >> 6);
-    a4[3] = (a3[2] & 0x3f);
+    return (length + 2) / 3 * 4;
 }
 
-void AdaptiveBase64Util::a4_to_a3(unsigned char* a3, unsigned char* a4)
+size_t AdaptiveBase64Util::MaxDecodedLength(size_t length)
 {
-    a3[0] = (a4[0] << 2) + ((a4[1] & 0x30) >> 4);
-    a3[1] = ((a4[1] & 0xf) << 4) + ((a4[2] & 0x3c) >> 2);
-    a3[2] = ((a4[2] & 0x3) << 6) + a4[3];
+    return (length + 3) / 4 * 3;
 }
 
-unsigned char AdaptiveBase64Util::b64_lookup(unsigned char c)
+void AdaptiveBase64Util::Encode(const char* in, size_t length, char* out)
 {
-    std::map<char, int> base64Alphabet;
-    GetBase64Alphabet(&base64Alphabet);
-
-    if (base64Alphabet.find(c) == base64Alphabet.end())
+    size_t position = 0;
+#ifdef ADAPTIVE_BASE64_SSSE3
+    // a block reads 16 bytes for the 12 it encodes
+    while (length - position >= 16)
     {
-        return 255;
+        const __m128i encoded = EncodeBlock(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + position)));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), encoded);
+        position += 12;
+        out += 16;
     }
-    return static_cast<unsigned char>(base64Alphabet[c]);
-}
-
-bool AdaptiveBase64Util::Encode(const std::vector<char>& in, std::string* out)
-{
-    out->resize(EncodedLength(in));
-
-    size_t input_len{ in.size() };
-    auto input = in.begin();
+#endif
 
-    int i{};
-    size_t enc_len{};
-    unsigned char a3[3];
-    unsigned char a4[4];
-    while (input_len--)
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(in);
+    for (; length - position >= 3; position += 3, out += 4)
     {
-        a3[i++] = *(input++);
-        if (i == 3)
-        {
-            a3_to_a4(a4, a3);
-
-            for (i = 0; i < 4; ++i)
-            {
-                (*out)[enc_len++] = c_base64Alphabet[a4[i]];
-            }
-
-            i = 0;
-        }
+        EncodeGroup(bytes + position, out);
     }
 
-    if (i)
+    // the last 1 or 2 bytes, padded to a whole group
+    const size_t remaining = length - position;
+    if (remaining != 0)
     {
-        for (int j{ i }; j < 3; ++j)
-        {
-            a3[j] = '\0';
-        }
-
-        a3_to_a4(a4, a3);
-
-        for (int j{}; j < i + 1; ++j)
-        {
-            (*out)[enc_len++] = c_base64Alphabet[a4[j]];
-        }
-
-        while ((i++ < 3))
+        unsigned char last[3] = {};
+        std::copy(bytes + position, bytes + length, last);
+        EncodeGroup(last, out);
+        out[3] = '=';
+        if (remaining == 1)
         {
-            (*out)[enc_len++] = '=';
+            out[2] = '=';
         }
     }
-
-    return (enc_len == out->size());
 }
 
-bool AdaptiveBase64Util::Decode(const std::string& in, std::vector<char>* out)
+bool AdaptiveBase64Util::Decode(const char* in, size_t length, char* out, size_t& decodedLength, Validation validation)
 {
-    size_t input_len{ in.size() };
-    auto input = in.begin();
-
-    out->resize(DecodedLength(in));
-
-    int i{};
-    size_t dec_len = 0;
-    unsigned char a3[3];
-    unsigned char a4[4];
-    while (input_len--)
+    decodedLength = 0;
+    size_t position = 0;
+    while (true)
     {
-        if (*input == '=')
+        const size_t decoded = DecodeGroups(in + position, length - position, out + decodedLength);
+        position += decoded;
+        decodedLength += decoded / 4 * 3;
+        if (position == length)
         {
-            break;
+            return true;
         }
 
-        a4[i++] = *(input++);
-        if (i == 4)
+        // the next group has padding, whitespace or an invalid character, or is cut short; read it a character at a time
+        unsigned char values[4] = {};
+        size_t count = 0;
+        while (count < 4 && position < length)
         {
-            for (i = 0; i < 4; ++i)
+            const unsigned char value = c_base64Values[static_cast<unsigned char>(in[position])];
+            if (value != c_invalidValue)
             {
-                a4[i] = b64_lookup(a4[i]);
+                values[count++] = value;
             }
-
-            a4_to_a3(a3, a4);
-
-            for (i = 0; i < 3; ++i)
+            else if (validation != Validation::Lenient || !IsWhitespace(in[position]))
             {
-                (*out)[dec_len++] = a3[i];
+                break;
             }
-
-            i = 0;
+            ++position;
         }
-    }
 
-    if (i)
-    {
-        for (int j{ i }; j < 4; ++j)
+        if (count == 4)
         {
-            a4[j] = '\0';
+            WriteGroup(values, 3, out + decodedLength);
+            decodedLength += 3;
+            continue;
         }
 
-        for (int j{}; j < 4; j++)
+        // otherwise the data ends here, with a last group of 2 or 3 characters holding 1 or 2 bytes, and its padding
+        size_t padding = 0;
+        for (; position < length; ++position)
         {
-            a4[j] = b64_lookup(a4[j]);
+            if (in[position] == '=')
+            {
+                ++padding;
+            }
+            else if (validation != Validation::Lenient || !IsWhitespace(in[position]))
+            {
+                return false;
+            }
         }
 
-        a4_to_a3(a3, a4);
-
-        for (int j{}; j < i - 1; ++j)
+        if (count == 0)
+        {
+            return padding == 0;
+        }
+        if (count == 1 || padding > 4 - count || (validation == Validation::Strict && padding != 4 - count))
         {
-            (*out)[dec_len++] = a3[j];
+            return false;
         }
+        WriteGroup(values, count - 1, out + decodedLength);
+        decodedLength += count - 1;
+        return true;
     }
-
-    return (dec_len == out->size());
 }
 
 std::vector<char> AdaptiveBase64Util::Decode(const std::string& encodedBase64)
 {
-    std::vector<char> decodedString;
-    Decode(encodedBase64, &decodedString);
-    return decodedString;
+    std::vector<char> decoded(MaxDecodedLength(encodedBase64.size()));
+    size_t decodedLength;
+    Decode(encodedBase64.data(), encodedBase64.size(), decoded.data(), decodedLength, Validation::Lenient);
+    decoded.resize(decodedLength);
+    return decoded;
 }
 
 std::string AdaptiveBase64Util::Encode(const std::vector<char>& decodedBase64)
 {
-    std::string encodedString;
-    Encode(decodedBase64, &encodedString);
-    return encodedString;
+    std::string encoded(EncodedLength(decodedBase64.size()), '\0');
+    Encode(decodedBase64.data(), decodedBase64.size(), &encoded[0]);
+    return encoded;
+}
+
+size_t AdaptiveBase64Util::DecodeChunk(const std::string& encodedBase64, size_t position, size_t maxDecodedLength, std::vector<char>& out)
+{
+    if (position >= encodedBase64.size())
+    {
+        return encodedBase64.size();
+    }
+
+    const size_t available = encodedBase64.size() - position;
+    const size_t length = std::min(available, (maxDecodedLength + 2) / 3 * 4);
+    const size_t start = out.size();
+    out.resize(start + MaxDecodedLength(length));
+
+    const size_t decoded = DecodeGroups(encodedBase64.data() + position, length, out.data() + start);
+    size_t decodedLength = decoded / 4 * 3;
+    if (decoded == length && length < available)
+    {
+        out.resize(start + decodedLength);
+        return position + decoded;
+    }
+
+    // the data ends within this chunk; a last group of 2 or 3 characters holds 1 or 2 bytes
+    unsigned char values[4] = {};
+    size_t count = 0;
+    for (size_t i = position + decoded; count < 3 && i < encodedBase64.size(); ++i, ++count)
+    {
+        values[count] = c_base64Values[static_cast<unsigned char>(encodedBase64[i])];
+        if (values[count] == c_invalidValue)
+        {
+            values[count] = 0;
+            break;
+        }
+    }
+    if (count >= 2)
+    {
+        WriteGroup(values, count - 1, out.data() + start + decodedLength);
+        decodedLength += count - 1;
+    }
+    out.resize(start + decodedLength);
+    return encodedBase64.size();
 }
 
 // Format for DataURI is data:[<MediaType>][;base64],data with MediaType and base64 being optional and data is composed of [A-Z a-z 0-9 + /] characters
@@ -10,22 +10,38 @@ namespace AdaptiveSharedNamespace
 {
     class AdaptiveBase64Util
     {
-    private:
-        static size_t DecodedLength(const char* in, size_t in_length);
-        static size_t DecodedLength(const std::string& in);
-        static inline size_t EncodedLength(size_t length);
-        static inline size_t EncodedLength(const std::vector<char>& in);
-        static inline void StripPadding(std::string* in);
-        static inline void a3_to_a4(unsigned char* a4, unsigned char* a3);
-        static inline void a4_to_a3(unsigned char* a3, unsigned char* a4);
-        static inline unsigned char b64_lookup(unsigned char c);
-        static bool Encode(const std::vector<char>& in, std::string* out);
-        static bool Decode(const std::string& in, std::vector<char>* out);
-
     public:
+        // How the buffer Decode treats input that isn't canonical base64
+        enum class Validation
+        {
+            // Whole 4-character groups of the alphabet only, with at most two '=' of padding at the very end
+            Strict,
+            // Also allows the padding to be left out, and skips ASCII whitespace, as in line-wrapped data
+            Lenient
+        };
+
+        // Decodes leniently, returning the bytes decoded before the first invalid character, if any
         static std::vector<char> Decode(const std::string& encodedBase64);
         static std::string Encode(const std::vector<char>& decodedBase64);
 
+        // The number of characters Encode writes for length bytes, and an upper bound on the number of bytes Decode
+        // writes for length characters
+        static size_t EncodedLength(size_t length);
+        static size_t MaxDecodedLength(size_t length);
+
+        // Encodes length bytes into out, which must have room for EncodedLength(length) characters
+        static void Encode(const char* in, size_t length, char* out);
+
+        // Decodes length characters into out, which must have room for MaxDecodedLength(length) bytes, and sets
+        // decodedLength to the number of bytes written. Returns false if in isn't valid base64 under validation, in which
+        // case decodedLength covers the groups decoded before the error.
+        static bool Decode(const char* in, size_t length, char* out, size_t& decodedLength, Validation validation = Validation::Strict);
+
         static std::string ExtractDataFromUri(const std::string& dataUri);
+
+        // Decodes whole 4-character groups of encodedBase64 from position on, appending to out, until at least
+        // maxDecodedLength bytes have been appended or the data ends at padding, an invalid character or the end of the
+        // string. Returns the position to continue from, which is encodedBase64.size() once the data has ended.
+        static size_t DecodeChunk(const std::string& encodedBase64, size_t position, size_t maxDecodedLength, std::vector<char>& out);
     };
 }
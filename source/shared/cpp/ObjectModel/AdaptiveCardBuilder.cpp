@@ -0,0 +1,202 @@
+#include "pch.h"
+#include "AdaptiveCardBuilder.h"
+#include "BackgroundImage.h"
+#include "ChoiceInput.h"
+#include "Fact.h"
+#include "ToggleVisibilityTarget.h"
+
+namespace AdaptiveSharedNamespace
+{
+    SubmitAction& ActionListBuilder::AddSubmit(std::string title, Json::Value data)
+    {
+        SubmitAction& action = Emplace<SubmitAction>();
+        action.SetTitle(title);
+        action.SetDataJson(std::move(data));
+        return action;
+    }
+
+    OpenUrlAction& ActionListBuilder::AddOpenUrl(std::string title, std::string url)
+    {
+        OpenUrlAction& action = Emplace<OpenUrlAction>();
+        action.SetTitle(title);
+        action.SetUrl(std::move(url));
+        return action;
+    }
+
+    ShowCardAction& ActionListBuilder::AddShowCard(std::string title, std::shared_ptr<AdaptiveCard> card)
+    {
+        ShowCardAction& action = Emplace<ShowCardAction>();
+        action.SetTitle(title);
+        action.SetCard(std::move(card));
+        return action;
+    }
+
+    ToggleVisibilityAction& ActionListBuilder::AddToggleVisibility(std::string title, std::vector<std::string> targetElementIds)
+    {
+        ToggleVisibilityAction& action = Emplace<ToggleVisibilityAction>();
+        action.SetTitle(title);
+
+        auto& targets = action.GetTargetElements();
+        targets.reserve(targetElementIds.size());
+        for (auto& elementId : targetElementIds)
+        {
+            auto target = std::make_shared<ToggleVisibilityTarget>();
+            target->SetElementId(std::move(elementId));
+            targets.push_back(std::move(target));
+        }
+        return action;
+    }
+
+    TextBlock& ElementListBuilder::AddTextBlock(std::string text)
+    {
+        TextBlock& textBlock = Emplace<TextBlock>();
+        textBlock.SetText(std::move(text));
+        return textBlock;
+    }
+
+    Image& ElementListBuilder::AddImage(std::string url)
+    {
+        Image& image = Emplace<Image>();
+        image.SetUrl(std::move(url));
+        return image;
+    }
+
+    FactSet& ElementListBuilder::AddFactSet(std::vector<std::pair<std::string, std::string>> facts)
+    {
+        FactSet& factSet = Emplace<FactSet>();
+        auto& factList = factSet.GetFacts();
+        factList.reserve(facts.size());
+        for (auto& fact : facts)
+        {
+            factList.push_back(std::make_shared<Fact>(std::move(fact.first), std::move(fact.second)));
+        }
+        return factSet;
+    }
+
+    TextInput& ElementListBuilder::AddTextInput(std::string id)
+    {
+        TextInput& input = Emplace<TextInput>();
+        input.SetId(id);
+        return input;
+    }
+
+    NumberInput& ElementListBuilder::AddNumberInput(std::string id)
+    {
+        NumberInput& input = Emplace<NumberInput>();
+        input.SetId(id);
+        return input;
+    }
+
+    DateInput& ElementListBuilder::AddDateInput(std::string id)
+    {
+        DateInput& input = Emplace<DateInput>();
+        input.SetId(id);
+        return input;
+    }
+
+    TimeInput& ElementListBuilder::AddTimeInput(std::string id)
+    {
+        TimeInput& input = Emplace<TimeInput>();
+        input.SetId(id);
+        return input;
+    }
+
+    ToggleInput& ElementListBuilder::AddToggleInput(std::string id, std::string title)
+    {
+        ToggleInput& input = Emplace<ToggleInput>();
+        input.SetId(id);
+        input.SetTitle(title);
+        return input;
+    }
+
+    ChoiceSetInput& ElementListBuilder::AddChoiceSetInput(std::string id, std::vector<std::pair<std::string, std::string>> choices)
+    {
+        ChoiceSetInput& input = Emplace<ChoiceSetInput>();
+        input.SetId(id);
+
+        auto& choiceList = input.GetChoices();
+        choiceList.reserve(choices.size());
+        for (auto& choice : choices)
+        {
+            auto choiceInput = std::make_shared<ChoiceInput>();
+            choiceInput->SetTitle(std::move(choice.first));
+            choiceInput->SetValue(std::move(choice.second));
+            choiceList.push_back(std::move(choiceInput));
+        }
+        return input;
+    }
+
+    AdaptiveCardBuilder::AdaptiveCardBuilder(std::string version) :
+        m_version(std::move(version)), m_style(ContainerStyle::None), m_verticalContentAlignment(VerticalContentAlignment::Top),
+        m_height(HeightType::Auto), m_bodyBuilder(m_body), m_actionsBuilder(m_actions)
+    {
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetFallbackText(std::string fallbackText)
+    {
+        m_fallbackText = std::move(fallbackText);
+        return *this;
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetSpeak(std::string speak)
+    {
+        m_speak = std::move(speak);
+        return *this;
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetLanguage(std::string language)
+    {
+        m_language = std::move(language);
+        return *this;
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetStyle(ContainerStyle style)
+    {
+        m_style = style;
+        return *this;
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetVerticalContentAlignment(VerticalContentAlignment verticalContentAlignment)
+    {
+        m_verticalContentAlignment = verticalContentAlignment;
+        return *this;
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetHeight(HeightType height)
+    {
+        m_height = height;
+        return *this;
+    }
+
+    AdaptiveCardBuilder& AdaptiveCardBuilder::SetBackgroundImage(std::string url)
+    {
+        m_backgroundImage = std::make_shared<BackgroundImage>(url);
+        return *this;
+    }
+
+    std::shared_ptr<AdaptiveCard> AdaptiveCardBuilder::Build()
+    {
+        // the version is kept (and is short enough not to allocate); everything else is moved into the card
+        auto card = std::make_shared<AdaptiveCard>(std::string(m_version),
+                                                   std::move(m_fallbackText),
+                                                   std::move(m_backgroundImage),
+                                                   m_style,
+                                                   std::move(m_speak),
+                                                   std::move(m_language),
+                                                   m_verticalContentAlignment,
+                                                   m_height,
+                                                   std::move(m_body),
+                                                   std::move(m_actions));
+
+        // moved-from strings and vectors are valid but unspecified, so reset them for reuse
+        m_fallbackText.clear();
+        m_speak.clear();
+        m_language.clear();
+        m_body.clear();
+        m_actions.clear();
+        m_style = ContainerStyle::None;
+        m_verticalContentAlignment = VerticalContentAlignment::Top;
+        m_height = HeightType::Auto;
+        return card;
+    }
+}
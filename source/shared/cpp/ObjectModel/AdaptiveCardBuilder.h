@@ -0,0 +1,185 @@
+#pragma once
+
+#include "pch.h"
+#include "ActionSet.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateInput.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "NumberInput.h"
+#include "OpenUrlAction.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "ToggleVisibilityAction.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // Appends actions to an action list (a card's actions or an ActionSet's). Every Add method constructs the action
+    // in place and returns it for further configuration. Content arguments (text, urls, data, cards, target ids, facts
+    // and choices) are moved into it, so pass rvalues to avoid copying them; titles, input ids and column widths go
+    // through setters that take const references, and are copied. The builder refers to the list, so it must not
+    // outlive it, nor be kept across serializing the card (see BaseElement::GetChangeStamp).
+    class ActionListBuilder
+    {
+    public:
+        explicit ActionListBuilder(std::vector<std::shared_ptr<BaseActionElement>>& actions) : m_actions(actions) {}
+
+        template<typename T, typename... Args> T& Emplace(Args&&... args);
+
+        SubmitAction& AddSubmit(std::string title, Json::Value data = Json::Value());
+        OpenUrlAction& AddOpenUrl(std::string title, std::string url);
+        ShowCardAction& AddShowCard(std::string title, std::shared_ptr<AdaptiveCard> card);
+        ToggleVisibilityAction& AddToggleVisibility(std::string title, std::vector<std::string> targetElementIds);
+
+    private:
+        std::vector<std::shared_ptr<BaseActionElement>>& m_actions;
+    };
+
+    // Appends elements to an element list (a card's body or a Container's or Column's items), as ActionListBuilder
+    // does for actions. Nested lists are filled by a callable that receives a builder for the new element's children:
+    //
+    //     body.AddContainer([](ElementListBuilder& items) { items.AddTextBlock("Hello").SetWrap(true); });
+    class ElementListBuilder
+    {
+    public:
+        explicit ElementListBuilder(std::vector<std::shared_ptr<BaseCardElement>>& elements) : m_elements(elements) {}
+
+        template<typename T, typename... Args> T& Emplace(Args&&... args);
+
+        TextBlock& AddTextBlock(std::string text);
+        Image& AddImage(std::string url);
+
+        // facts and choices are (title, value) pairs
+        FactSet& AddFactSet(std::vector<std::pair<std::string, std::string>> facts);
+
+        // buildItems(ElementListBuilder&), buildColumns(ColumnListBuilder&) and buildActions(ActionListBuilder&)
+        template<typename BuildItems> Container& AddContainer(BuildItems&& buildItems);
+        template<typename BuildColumns> ColumnSet& AddColumnSet(BuildColumns&& buildColumns);
+        template<typename BuildActions> ActionSet& AddActionSet(BuildActions&& buildActions);
+
+        TextInput& AddTextInput(std::string id);
+        NumberInput& AddNumberInput(std::string id);
+        DateInput& AddDateInput(std::string id);
+        TimeInput& AddTimeInput(std::string id);
+        ToggleInput& AddToggleInput(std::string id, std::string title);
+        ChoiceSetInput& AddChoiceSetInput(std::string id, std::vector<std::pair<std::string, std::string>> choices);
+
+    private:
+        std::vector<std::shared_ptr<BaseCardElement>>& m_elements;
+    };
+
+    class ColumnListBuilder
+    {
+    public:
+        explicit ColumnListBuilder(std::vector<std::shared_ptr<Column>>& columns) : m_columns(columns) {}
+
+        template<typename BuildItems> Column& AddColumn(std::string width, BuildItems&& buildItems);
+
+    private:
+        std::vector<std::shared_ptr<Column>>& m_columns;
+    };
+
+    // Builds cards in code without the copies the AdaptiveCard constructors and setters make. Body and actions are
+    // accumulated in place and moved into the card by Build(), which leaves the builder as newly constructed (with the same
+    // version) for the next card:
+    //
+    //     AdaptiveCardBuilder builder("1.2");
+    //     builder.SetSpeak("Weather").Body().AddTextBlock("Sunny").SetTextSize(TextSize::Large);
+    //     builder.Actions().AddOpenUrl("Forecast", "https://example.com/forecast");
+    //     std::shared_ptr<AdaptiveCard> card = builder.Build();
+    class AdaptiveCardBuilder
+    {
+    public:
+        explicit AdaptiveCardBuilder(std::string version);
+
+        AdaptiveCardBuilder(const AdaptiveCardBuilder&) = delete;
+        AdaptiveCardBuilder& operator=(const AdaptiveCardBuilder&) = delete;
+
+        AdaptiveCardBuilder& SetFallbackText(std::string fallbackText);
+        AdaptiveCardBuilder& SetSpeak(std::string speak);
+        AdaptiveCardBuilder& SetLanguage(std::string language);
+        AdaptiveCardBuilder& SetStyle(ContainerStyle style);
+        AdaptiveCardBuilder& SetVerticalContentAlignment(VerticalContentAlignment verticalContentAlignment);
+        AdaptiveCardBuilder& SetHeight(HeightType height);
+        AdaptiveCardBuilder& SetBackgroundImage(std::string url);
+
+        ElementListBuilder& Body() { return m_bodyBuilder; }
+        ActionListBuilder& Actions() { return m_actionsBuilder; }
+
+        std::shared_ptr<AdaptiveCard> Build();
+
+    private:
+        std::string m_version;
+        std::string m_fallbackText;
+        std::string m_speak;
+        std::string m_language;
+        std::shared_ptr<BackgroundImage> m_backgroundImage;
+        ContainerStyle m_style;
+        VerticalContentAlignment m_verticalContentAlignment;
+        HeightType m_height;
+        std::vector<std::shared_ptr<BaseCardElement>> m_body;
+        std::vector<std::shared_ptr<BaseActionElement>> m_actions;
+        ElementListBuilder m_bodyBuilder;
+        ActionListBuilder m_actionsBuilder;
+    };
+
+    template<typename T, typename... Args> T& ActionListBuilder::Emplace(Args&&... args)
+    {
+        auto action = std::make_shared<T>(std::forward<Args>(args)...);
+        T& result = *action;
+        m_actions.push_back(std::move(action));
+        return result;
+    }
+
+    template<typename T, typename... Args> T& ElementListBuilder::Emplace(Args&&... args)
+    {
+        auto element = std::make_shared<T>(std::forward<Args>(args)...);
+        T& result = *element;
+        m_elements.push_back(std::move(element));
+        return result;
+    }
+
+    template<typename BuildItems> Container& ElementListBuilder::AddContainer(BuildItems&& buildItems)
+    {
+        Container& container = Emplace<Container>();
+        ElementListBuilder itemsBuilder(container.GetItems());
+        buildItems(itemsBuilder);
+        return container;
+    }
+
+    template<typename BuildColumns> ColumnSet& ElementListBuilder::AddColumnSet(BuildColumns&& buildColumns)
+    {
+        ColumnSet& columnSet = Emplace<ColumnSet>();
+        ColumnListBuilder columnsBuilder(columnSet.GetColumns());
+        buildColumns(columnsBuilder);
+        return columnSet;
+    }
+
+    template<typename BuildActions> ActionSet& ElementListBuilder::AddActionSet(BuildActions&& buildActions)
+    {
+        ActionSet& actionSet = Emplace<ActionSet>();
+        ActionListBuilder actionsBuilder(actionSet.GetActions());
+        buildActions(actionsBuilder);
+        return actionSet;
+    }
+
+    template<typename BuildItems> Column& ColumnListBuilder::AddColumn(std::string width, BuildItems&& buildItems)
+    {
+        auto column = std::make_shared<Column>();
+        Column& result = *column;
+        m_columns.push_back(std::move(column));
+
+        result.SetWidth(width);
+        ElementListBuilder itemsBuilder(result.GetItems());
+        buildItems(itemsBuilder);
+        return result;
+    }
+}
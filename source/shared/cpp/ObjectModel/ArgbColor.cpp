@@ -0,0 +1,67 @@
+#include "pch.h"
+#include "ArgbColor.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        int HexDigitValue(char c)
+        {
+            if (c >= '0' && c <= '9')
+            {
+                return c - '0';
+            }
+            if (c >= 'a' && c <= 'f')
+            {
+                return c - 'a' + 10;
+            }
+            if (c >= 'A' && c <= 'F')
+            {
+                return c - 'A' + 10;
+            }
+            return -1;
+        }
+    }
+
+    bool ArgbColor::TryParse(const std::string& value, ArgbColor& color)
+    {
+        const std::size_t length = value.length();
+        if ((length != 7 && length != 9) || value[0] != '#')
+        {
+            return false;
+        }
+
+        // #RRGGBB is opaque
+        std::uint32_t parsed = (length == 7) ? 0xFFu : 0u;
+        for (std::size_t i = 1; i < length; ++i)
+        {
+            const int digit = HexDigitValue(value[i]);
+            if (digit < 0)
+            {
+                return false;
+            }
+            parsed = (parsed << 4) | static_cast<std::uint32_t>(digit);
+        }
+
+        color.argb = parsed;
+        return true;
+    }
+
+    ArgbColor ArgbColor::Parse(const std::string& value)
+    {
+        ArgbColor color;
+        TryParse(value, color);
+        return color;
+    }
+
+    std::string ArgbColor::ToString() const
+    {
+        static const char hexDigits[] = "0123456789ABCDEF";
+        std::string result(9, '#');
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            result[8 - i] = hexDigits[(argb >> (4 * i)) & 0xF];
+        }
+        return result;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // A color packed as 0xAARRGGBB. Card and HostConfig colors are parsed into this form once, at load time, so that
+    // renderers need not parse the hex strings again for every element.
+    struct ArgbColor
+    {
+        std::uint32_t argb;
+
+        ArgbColor() : argb(0) {}
+        explicit ArgbColor(std::uint32_t value) : argb(value) {}
+
+        std::uint8_t GetAlpha() const { return static_cast<std::uint8_t>(argb >> 24); }
+        std::uint8_t GetRed() const { return static_cast<std::uint8_t>(argb >> 16); }
+        std::uint8_t GetGreen() const { return static_cast<std::uint8_t>(argb >> 8); }
+        std::uint8_t GetBlue() const { return static_cast<std::uint8_t>(argb); }
+
+        // Parses "#RRGGBB" (fully opaque) or "#AARRGGBB". Returns false, leaving color alone, for anything else.
+        static bool TryParse(const std::string& value, ArgbColor& color);
+
+        // Parses as TryParse does, giving transparent black for strings that are not colors
+        static ArgbColor Parse(const std::string& value);
+
+        // Returns the color as "#AARRGGBB" with uppercase hex digits
+        std::string ToString() const;
+
+        bool operator==(const ArgbColor& other) const { return argb == other.argb; }
+        bool operator!=(const ArgbColor& other) const { return argb != other.argb; }
+    };
+}
@@ -5,20 +5,37 @@
 namespace AdaptiveSharedNamespace
 {
     std::string BackgroundImage::GetUrl() const { return m_url; }
+    const std::string& BackgroundImage::GetUrlRef() const { return m_url; }
 
-    void BackgroundImage::SetUrl(const std::string& value) { m_url = value; }
+    void BackgroundImage::SetUrl(const std::string& value)
+    {
+        MarkChanged();
+        m_url = value;
+    }
 
     BackgroundImageMode BackgroundImage::GetMode() const { return m_mode; }
 
-    void BackgroundImage::SetMode(const BackgroundImageMode& value) { m_mode = value; }
+    void BackgroundImage::SetMode(const BackgroundImageMode& value)
+    {
+        MarkChanged();
+        m_mode = value;
+    }
 
     HorizontalAlignment BackgroundImage::GetHorizontalAlignment() const { return m_hAlignment; }
 
-    void BackgroundImage::SetHorizontalAlignment(const HorizontalAlignment& value) { m_hAlignment = value; }
+    void BackgroundImage::SetHorizontalAlignment(const HorizontalAlignment& value)
+    {
+        MarkChanged();
+        m_hAlignment = value;
+    }
 
     VerticalAlignment BackgroundImage::GetVerticalAlignment() const { return m_vAlignment; }
 
-    void BackgroundImage::SetVerticalAlignment(const VerticalAlignment& value) { m_vAlignment = value; }
+    void BackgroundImage::SetVerticalAlignment(const VerticalAlignment& value)
+    {
+        MarkChanged();
+        m_vAlignment = value;
+    }
 
     Json::Value BackgroundImage::SerializeToJsonValue() const
     {
@@ -77,4 +94,11 @@ namespace AdaptiveSharedNamespace
 
         return image;
     }
+
+    std::shared_ptr<BackgroundImage> BackgroundImage::Deserialize(ParseContext& context, const Json::Value& json)
+    {
+        std::shared_ptr<BackgroundImage> image = Deserialize(json);
+        context.ReadUrl(UrlKind::BackgroundImage, image->m_url);
+        return image;
+    }
 }
@@ -6,7 +6,7 @@
 
 namespace AdaptiveSharedNamespace
 {
-    class BackgroundImage
+    class BackgroundImage : public ElementPart
     {
     public:
         BackgroundImage() :
@@ -20,6 +20,7 @@ namespace AdaptiveSharedNamespace
         }
 
         std::string GetUrl() const;
+        const std::string& GetUrlRef() const;
         void SetUrl(const std::string& value);
         BackgroundImageMode GetMode() const;
         void SetMode(const BackgroundImageMode& value);
@@ -31,6 +32,8 @@ namespace AdaptiveSharedNamespace
         Json::Value SerializeToJsonValue() const;
 
         static std::shared_ptr<BackgroundImage> Deserialize(const Json::Value& json);
+        // As above, passing the url through the context's url rewriter
+        static std::shared_ptr<BackgroundImage> Deserialize(ParseContext& context, const Json::Value& json);
 
     private:
         std::string m_url;
@@ -10,7 +10,6 @@ constexpr const char* const BaseActionElement::defaultSentiment;
 BaseActionElement::BaseActionElement(ActionType type) : m_sentiment(BaseActionElement::defaultSentiment), m_type(type)
 {
     SetTypeString(ActionTypeToString(type));
-    PopulateKnownPropertiesSet();
 }
 
 std::string BaseActionElement::GetTitle() const
@@ -18,8 +17,14 @@ std::string BaseActionElement::GetTitle() const
     return m_title;
 }
 
+const std::string& BaseActionElement::GetTitleRef() const
+{
+    return m_title;
+}
+
 void BaseActionElement::SetTitle(const std::string& value)
 {
+    MarkChanged();
     m_title = value;
 }
 
@@ -28,8 +33,14 @@ std::string BaseActionElement::GetIconUrl() const
     return m_iconUrl;
 }
 
+const std::string& BaseActionElement::GetIconUrlRef() const
+{
+    return m_iconUrl;
+}
+
 void BaseActionElement::SetIconUrl(const std::string& value)
 {
+    MarkChanged();
     m_iconUrl = value;
 }
 
@@ -38,8 +49,14 @@ std::string BaseActionElement::GetSentiment() const
     return m_sentiment;
 }
 
+const std::string& BaseActionElement::GetSentimentRef() const
+{
+    return m_sentiment;
+}
+
 void BaseActionElement::SetSentiment(const std::string& value)
 {
+    MarkChanged();
     m_sentiment = value;
 }
 
@@ -72,6 +89,8 @@ Json::Value BaseActionElement::SerializeToJsonValue() const
 
 void BaseActionElement::PopulateKnownPropertiesSet()
 {
+    BaseElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IconUrl),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sentiment),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)});
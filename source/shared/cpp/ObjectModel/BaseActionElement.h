@@ -22,12 +22,15 @@ namespace AdaptiveSharedNamespace
         ~BaseActionElement() = default;
 
         virtual std::string GetTitle() const;
+        const std::string& GetTitleRef() const;
         virtual void SetTitle(const std::string& value);
 
         virtual std::string GetIconUrl() const;
+        const std::string& GetIconUrlRef() const;
         virtual void SetIconUrl(const std::string& value);
 
         virtual std::string GetSentiment() const;
+        const std::string& GetSentimentRef() const;
         virtual void SetSentiment(const std::string& value);
 
         virtual const ActionType GetElementType() const;
@@ -61,11 +64,13 @@ namespace AdaptiveSharedNamespace
 
         baseActionElement->DeserializeBase<BaseActionElement>(context, json);
         baseActionElement->SetTitle(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title));
-        baseActionElement->SetIconUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl));
+        std::string iconUrl = ParseUtil::GetString(json, AdaptiveCardSchemaKey::IconUrl);
+        context.ReadUrl(UrlKind::ActionIcon, iconUrl);
+        baseActionElement->SetIconUrl(iconUrl);
         baseActionElement->SetSentiment(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Sentiment, defaultSentiment, false));
 
         // Walk all properties and put any unknown ones in the additional properties json
-        HandleUnknownProperties(json, baseActionElement->m_knownProperties, baseActionElement->m_additionalProperties);
+        HandleUnknownProperties(json, GetKnownProperties<T>(), baseActionElement->m_additionalProperties);
 
         return cardElement;
     }
@@ -10,23 +10,23 @@
 using namespace AdaptiveSharedNamespace;
 
 BaseCardElement::BaseCardElement(CardElementType type, Spacing spacing, bool separator, HeightType height) :
-    m_type(type), m_spacing(spacing),
-    m_height(height), m_separator(separator), m_isVisible(true)
+    m_type(static_cast<std::uint8_t>(type)), m_spacing(static_cast<std::uint8_t>(spacing)),
+    m_height(static_cast<std::uint8_t>(height)), m_separator(separator), m_isVisible(true)
 {
     SetTypeString(CardElementTypeToString(type));
-    PopulateKnownPropertiesSet();
 }
 
 BaseCardElement::BaseCardElement(CardElementType type) :
-    m_type(type), m_spacing(Spacing::Default), m_separator(false),
-    m_height(HeightType::Auto), m_isVisible(true)
+    m_type(static_cast<std::uint8_t>(type)), m_spacing(static_cast<std::uint8_t>(Spacing::Default)),
+    m_height(static_cast<std::uint8_t>(HeightType::Auto)), m_separator(false), m_isVisible(true)
 {
     SetTypeString(CardElementTypeToString(type));
-    PopulateKnownPropertiesSet();
 }
 
 void BaseCardElement::PopulateKnownPropertiesSet()
 {
+    BaseElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsVisible),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Separator),
@@ -40,27 +40,30 @@ bool BaseCardElement::GetSeparator() const
 
 void BaseCardElement::SetSeparator(const bool value)
 {
+    MarkChanged();
     m_separator = value;
 }
 
 Spacing BaseCardElement::GetSpacing() const
 {
-    return m_spacing;
+    return static_cast<Spacing>(m_spacing);
 }
 
 void BaseCardElement::SetSpacing(const Spacing value)
 {
-    m_spacing = value;
+    MarkChanged();
+    m_spacing = static_cast<std::uint8_t>(value);
 }
 
 HeightType BaseCardElement::GetHeight() const
 {
-    return m_height;
+    return static_cast<HeightType>(m_height);
 }
 
 void BaseCardElement::SetHeight(const HeightType value)
 {
-    m_height = value;
+    MarkChanged();
+    m_height = static_cast<std::uint8_t>(value);
 }
 
 bool BaseCardElement::GetIsVisible() const
@@ -70,26 +73,28 @@ bool BaseCardElement::GetIsVisible() const
 
 void BaseCardElement::SetIsVisible(const bool value)
 {
+    MarkChanged();
     m_isVisible = value;
 }
 
 const CardElementType BaseCardElement::GetElementType() const
 {
-    return m_type;
+    return static_cast<CardElementType>(m_type);
 }
 
 Json::Value BaseCardElement::SerializeToJsonValue() const
 {
     Json::Value root = BaseElement::SerializeToJsonValue();
 
-    if (m_height != HeightType::Auto)
+    if (GetHeight() != HeightType::Auto)
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
     }
 
-    if (m_spacing != Spacing::Default)
+    const Spacing spacing = static_cast<Spacing>(m_spacing);
+    if (spacing != Spacing::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)] = SpacingToString(m_spacing);
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Spacing)] = SpacingToString(spacing);
     }
 
     if (m_separator)
@@ -109,12 +114,17 @@ Json::Value BaseCardElement::SerializeSelectAction(const std::shared_ptr<BaseAct
 {
     if (selectAction != nullptr)
     {
-        return selectAction->SerializeToJsonValue();
+        return SerializeNested(*selectAction);
     }
     return Json::Value();
 }
 
 void BaseCardElement::ParseJsonObject(AdaptiveSharedNamespace::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element)
+{
+    element = DeserializeElement(context, json);
+}
+
+std::shared_ptr<BaseCardElement> BaseCardElement::DeserializeElement(ParseContext& context, const Json::Value& json)
 {
     const std::string typeString = ParseUtil::GetTypeAsString(json);
     std::shared_ptr<BaseCardElementParser> parser = context.elementParserRegistration->GetParser(typeString);
@@ -127,8 +137,7 @@ void BaseCardElement::ParseJsonObject(AdaptiveSharedNamespace::ParseContext& con
     auto parsedElement = parser->Deserialize(context, json);
     if (parsedElement != nullptr)
     {
-        element = parsedElement;
-        return;
+        return parsedElement;
     }
 
     throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Unable to parse element of type " + typeString);
@@ -43,15 +43,18 @@ namespace AdaptiveSharedNamespace
         template<typename T> static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& json);
 
         static void ParseJsonObject(AdaptiveSharedNamespace::ParseContext& context, const Json::Value& json, std::shared_ptr<BaseElement>& element);
+        // As ParseJsonObject, without converting the result to and from a BaseElement handle
+        static std::shared_ptr<BaseCardElement> DeserializeElement(ParseContext& context, const Json::Value& json);
 
     protected:
         static Json::Value SerializeSelectAction(const std::shared_ptr<BaseActionElement> selectAction);
         void PopulateKnownPropertiesSet() override;
 
     private:
-        CardElementType m_type;
-        Spacing m_spacing;
-        HeightType m_height;
+        // enum values are stored in a byte each, which lets them share the tail of BaseElement's storage
+        std::uint8_t m_type;    // CardElementType
+        std::uint8_t m_spacing; // Spacing
+        std::uint8_t m_height;  // HeightType
         bool m_separator;
         bool m_isVisible;
     };
@@ -73,7 +76,7 @@ namespace AdaptiveSharedNamespace
             ParseUtil::GetEnumValue<Spacing>(json, AdaptiveCardSchemaKey::Spacing, Spacing::Default, SpacingFromString));
 
         // Walk all properties and put any unknown ones in the additional properties json
-        HandleUnknownProperties(json, baseCardElement->m_knownProperties, baseCardElement->m_additionalProperties);
+        HandleUnknownProperties(json, GetKnownProperties<T>(), baseCardElement->m_additionalProperties);
 
         return cardElement;
     }
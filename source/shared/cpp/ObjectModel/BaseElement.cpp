@@ -1,7 +1,11 @@
 #include "pch.h"
 
 #include "BaseElement.h"
+#include "BaseCardElement.h"
+#include "ContentHash.h"
 #include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "ToggleVisibilityTarget.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -28,17 +32,141 @@ namespace AdaptiveSharedNamespace
 
     InternalId::InternalId() : m_internalId{InternalId::Invalid} {}
 
+    std::uint64_t ChangeStamp::Get() const
+    {
+        std::uint64_t value = m_value.load(std::memory_order_relaxed);
+        if (value == 0)
+        {
+            static std::atomic<std::uint64_t> s_lastStamp{0};
+            const std::uint64_t stamp = ++s_lastStamp;
+            // on failure, a concurrent reader has assigned one first, which value now holds
+            if (m_value.compare_exchange_strong(value, stamp, std::memory_order_relaxed))
+            {
+                value = stamp;
+            }
+        }
+        return value;
+    }
+
     InternalId::InternalId(const unsigned int id) : m_internalId{id} {}
 
+    void ElementPart::ThrowIfFrozen() const
+    {
+        if (m_owner == nullptr)
+        {
+            return;
+        }
+        if (m_owner->readOnly)
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::FrozenObjectModification, "Read-only parts can't be modified");
+        }
+        if (m_owner->element != nullptr)
+        {
+            m_owner->element->ThrowIfFrozen();
+        }
+        else if (m_owner->card != nullptr)
+        {
+            m_owner->card->ThrowIfFrozen();
+        }
+    }
+
+    void ElementPart::MarkChanged()
+    {
+        ThrowIfFrozen();
+        if (m_owner != nullptr && m_owner->element != nullptr)
+        {
+            m_owner->element->PartChanged();
+        }
+        m_changeStamp.Renew();
+    }
+
+    ElementPartOwner::~ElementPartOwner()
+    {
+        if (m_owner != nullptr)
+        {
+            m_owner->element = nullptr;
+            m_owner->card = nullptr;
+        }
+    }
+
+    void ElementPartOwner::Link(BaseElement& element, const ElementPart& part) { Link(&element, nullptr, part); }
+
+    void ElementPartOwner::Link(AdaptiveCard& card, const ElementPart& part) { Link(nullptr, &card, part); }
+
+    void ElementPartOwner::Link(BaseElement* element, AdaptiveCard* card, const ElementPart& part)
+    {
+        auto& partOwner = part.m_owner;
+        if (partOwner != nullptr && (partOwner == m_owner || partOwner->readOnly || (partOwner->element != nullptr && partOwner->element->IsFrozen()) ||
+                                     (partOwner->card != nullptr && partOwner->card->IsFrozen())))
+        {
+            return;
+        }
+        if (m_owner == nullptr)
+        {
+            m_owner = std::make_shared<OwnerLink>(OwnerLink{element, card, false});
+        }
+        partOwner = m_owner;
+    }
+
+    void ElementPartOwner::LinkReadOnly(const ElementPart& part)
+    {
+        static const std::shared_ptr<OwnerLink> readOnlyLink = std::make_shared<OwnerLink>(OwnerLink{nullptr, nullptr, true});
+        part.m_owner = readOnlyLink;
+    }
+
+    BaseElement::BaseElement(const BaseElement& other) :
+        m_typeString(other.m_typeString), m_additionalProperties(other.m_additionalProperties),
+        m_fallbackAndRequires(other.m_fallbackAndRequires ? std::make_unique<FallbackAndRequires>(*other.m_fallbackAndRequires) : nullptr),
+        m_id(other.m_id), m_structuralHash(other.m_structuralHash), m_internalId(other.m_internalId),
+        m_frozen(other.m_frozen)
+    {
+    }
+
+    BaseElement& BaseElement::operator=(const BaseElement& other)
+    {
+        if (this != &other)
+        {
+            m_typeString = other.m_typeString;
+            m_additionalProperties = other.m_additionalProperties;
+            m_fallbackAndRequires =
+                other.m_fallbackAndRequires ? std::make_unique<FallbackAndRequires>(*other.m_fallbackAndRequires) : nullptr;
+            m_internalId = other.m_internalId;
+            m_id = other.m_id;
+            m_structuralHash = other.m_structuralHash;
+            m_changeStamp.Renew();
+            m_frozen = other.m_frozen;
+        }
+        return *this;
+    }
+
+    BaseElement::FallbackAndRequires& BaseElement::GetFallbackAndRequires()
+    {
+        if (m_fallbackAndRequires == nullptr)
+        {
+            m_fallbackAndRequires = std::make_unique<FallbackAndRequires>();
+        }
+        return *m_fallbackAndRequires;
+    }
+
     std::string BaseElement::Serialize() const { return ParseUtil::JsonToString(SerializeToJsonValue()); }
 
     std::string BaseElement::GetId() const { return m_id; }
+    const std::string& BaseElement::GetIdRef() const { return m_id; }
 
-    void BaseElement::SetId(const std::string& value) { m_id = value; }
+    void BaseElement::SetId(const std::string& value)
+    {
+        MarkChanged();
+        m_id = value;
+    }
 
     std::string BaseElement::GetElementTypeString() const { return m_typeString; }
+    const std::string& BaseElement::GetElementTypeStringRef() const { return m_typeString; }
 
-    void BaseElement::SetElementTypeString(const std::string& value) { m_typeString = value; }
+    void BaseElement::SetElementTypeString(const std::string& value)
+    {
+        MarkChanged();
+        m_typeString = value;
+    }
 
     void BaseElement::PopulateKnownPropertiesSet()
     {
@@ -50,12 +178,21 @@ namespace AdaptiveSharedNamespace
 
     Json::Value BaseElement::GetAdditionalProperties() const { return m_additionalProperties; }
 
-    void BaseElement::SetAdditionalProperties(Json::Value const& value) { m_additionalProperties = value; }
+    void BaseElement::SetAdditionalProperties(Json::Value const& value)
+    {
+        MarkChanged();
+        m_additionalProperties = value;
+    }
 
     // Given a map of what our host provides, determine if this element's requirements are satisfied.
     bool BaseElement::MeetsRequirements(const std::unordered_map<std::string, std::string>& hostProvides) const
     {
-        for (const auto& requirement : m_requires)
+        if (m_fallbackAndRequires == nullptr)
+        {
+            return true;
+        }
+
+        for (const auto& requirement : m_fallbackAndRequires->requirements)
         {
             // special case for adaptive cards version
             const auto& requirementName = requirement.first;
@@ -104,21 +241,27 @@ namespace AdaptiveSharedNamespace
             root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Id)] = m_id;
         }
 
+        if (m_fallbackAndRequires == nullptr)
+        {
+            return root;
+        }
+
         // Handle fallback
-        if (m_fallbackType == FallbackType::Drop)
+        if (m_fallbackAndRequires->fallbackType == FallbackType::Drop)
         {
             root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = "drop";
         }
-        else if (m_fallbackType == FallbackType::Content)
+        else if (m_fallbackAndRequires->fallbackType == FallbackType::Content)
         {
-            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] = m_fallbackContent->SerializeToJsonValue();
+            root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback)] =
+                SerializeNested(*m_fallbackAndRequires->fallbackContent);
         }
 
         // Handle requires
-        if (!m_requires.empty())
+        if (!m_fallbackAndRequires->requirements.empty())
         {
             Json::Value jsonRequires{};
-            for (const auto& requirement : m_requires)
+            for (const auto& requirement : m_fallbackAndRequires->requirements)
             {
                 jsonRequires[requirement.first] = static_cast<std::string>(requirement.second);
             }
@@ -129,12 +272,412 @@ namespace AdaptiveSharedNamespace
         return root;
     }
 
+    void BaseElement::VisitNested(NestedVisitor& visitor) const
+    {
+        if (m_fallbackAndRequires != nullptr && m_fallbackAndRequires->fallbackType == FallbackType::Content &&
+            m_fallbackAndRequires->fallbackContent != nullptr)
+        {
+            visitor.Slot(AdaptiveCardSchemaKey::Fallback, NestedVisitor::NoIndex, *m_fallbackAndRequires->fallbackContent);
+        }
+    }
+
+    namespace
+    {
+        // The SerializeOmitting() call in progress on this thread, if any
+        thread_local const std::unordered_set<const void*>* s_omitted = nullptr;
+
+        // Sets s_omitted for one serialization, which only leaves out the slots of the element it starts with
+        class OmittedScope
+        {
+        public:
+            explicit OmittedScope(const std::unordered_set<const void*>* omitted) : m_outer(s_omitted) { s_omitted = omitted; }
+            ~OmittedScope() { s_omitted = m_outer; }
+            OmittedScope(const OmittedScope&) = delete;
+            OmittedScope& operator=(const OmittedScope&) = delete;
+
+        private:
+            const std::unordered_set<const void*>* m_outer;
+        };
+    }
+
+    Json::Value BaseElement::SerializeNested(const BaseElement& element)
+    {
+        if (s_omitted != nullptr && s_omitted->count(&element) != 0)
+        {
+            return Json::Value();
+        }
+        OmittedScope scope(nullptr);
+        return element.SerializeToJsonValue();
+    }
+
+    Json::Value BaseElement::SerializeNested(const AdaptiveCard& card)
+    {
+        if (s_omitted != nullptr && s_omitted->count(&card) != 0)
+        {
+            return Json::Value();
+        }
+        OmittedScope scope(nullptr);
+        return card.SerializeToJsonValue();
+    }
+
+    Json::Value BaseElement::SerializeOmitting(const BaseElement& element, const std::unordered_set<const void*>& omitted)
+    {
+        OmittedScope scope(&omitted);
+        return element.SerializeToJsonValue();
+    }
+
+    Json::Value BaseElement::SerializeOmitting(const AdaptiveCard& card, const std::unordered_set<const void*>& omitted)
+    {
+        OmittedScope scope(&omitted);
+        return card.SerializeToJsonValue();
+    }
+
+    namespace
+    {
+        // Separates the entries of a signature, so that different walks can't produce the same stamps
+        enum class SignatureTag : std::uint64_t
+        {
+            Slot = 1,
+            Part,
+            Inline,
+            End
+        };
+
+        // Collects a signature. A slot is left out of its element's json, so only where it is counts; beneath an inline
+        // element, slots are serialized along with it, so they are walked too.
+        class SignatureVisitor : public NestedVisitor
+        {
+        public:
+            SignatureVisitor(NestedSignature& signature, bool isInline) : m_signature(signature), m_isInline(isInline) {}
+
+            void Slot(AdaptiveCardSchemaKey key, unsigned int index, const BaseElement& element) override
+            {
+                AppendSlot(key, index);
+                if (m_isInline)
+                {
+                    m_signature.stamps.push_back(element.GetChangeStamp());
+                    element.VisitNested(*this);
+                    Append(SignatureTag::End);
+                }
+                else
+                {
+                    m_signature.slots.push_back(NestedSignature::SlotEntry{key, index, &element, nullptr});
+                }
+            }
+
+            void Slot(AdaptiveCardSchemaKey key, unsigned int index, const AdaptiveCard& card) override
+            {
+                AppendSlot(key, index);
+                if (m_isInline)
+                {
+                    m_signature.stamps.push_back(card.GetChangeStamp());
+                    card.VisitNested(*this);
+                    Append(SignatureTag::End);
+                }
+                else
+                {
+                    m_signature.slots.push_back(NestedSignature::SlotEntry{key, index, nullptr, &card});
+                }
+            }
+
+            void Part(const ElementPart& part) override
+            {
+                Append(SignatureTag::Part);
+                m_signature.stamps.push_back(part.GetChangeStamp());
+            }
+
+            void Inline(const BaseElement& element) override
+            {
+                Append(SignatureTag::Inline);
+                m_signature.stamps.push_back(element.GetChangeStamp());
+                SignatureVisitor inlineVisitor(m_signature, true);
+                element.VisitNested(inlineVisitor);
+                Append(SignatureTag::End);
+            }
+
+        private:
+            void Append(SignatureTag tag) { m_signature.stamps.push_back(static_cast<std::uint64_t>(tag)); }
+
+            void AppendSlot(AdaptiveCardSchemaKey key, unsigned int index)
+            {
+                Append(SignatureTag::Slot);
+                m_signature.stamps.push_back(static_cast<std::uint64_t>(key));
+                m_signature.stamps.push_back(index);
+            }
+
+            NestedSignature& m_signature;
+            bool m_isInline;
+        };
+
+        // Counts the Get() calls in progress, so that each outermost one starts a new generation
+        class DepthScope
+        {
+        public:
+            explicit DepthScope(unsigned int& depth) : m_depth(depth) { ++m_depth; }
+            ~DepthScope() { --m_depth; }
+            DepthScope(const DepthScope&) = delete;
+            DepthScope& operator=(const DepthScope&) = delete;
+
+        private:
+            unsigned int& m_depth;
+        };
+    }
+
+    NestedSignature NestedSignature::Of(const BaseElement& element)
+    {
+        NestedSignature signature;
+        SignatureVisitor visitor(signature, false);
+        element.VisitNested(visitor);
+        return signature;
+    }
+
+    NestedSignature NestedSignature::Of(const AdaptiveCard& card)
+    {
+        NestedSignature signature;
+        SignatureVisitor visitor(signature, false);
+        card.VisitNested(visitor);
+        return signature;
+    }
+
+    std::unordered_set<const void*> NestedSignature::GetSlotKeys() const
+    {
+        std::unordered_set<const void*> keys;
+        for (const auto& slot : slots)
+        {
+            keys.insert(slot.element ? static_cast<const void*>(slot.element) : static_cast<const void*>(slot.card));
+        }
+        return keys;
+    }
+
+    ContentHash StructuralHashCache::Get(const BaseElement& element)
+    {
+        return element.IsFrozen() ? element.m_structuralHash : Compose(element);
+    }
+
+    ContentHash StructuralHashCache::Get(const AdaptiveCard& card)
+    {
+        return card.IsFrozen() ? card.m_contentHash : Compose(card);
+    }
+
+    void StructuralHashCache::Prune()
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            it = (it->second.generation == m_generation) ? std::next(it) : m_entries.erase(it);
+        }
+    }
+
+    template<typename T> ContentHash StructuralHashCache::Compose(const T& node)
+    {
+        if (m_depth == 0)
+        {
+            ++m_generation;
+        }
+        DepthScope depth(m_depth);
+
+        // entries stay put as others are added
+        Entry& entry = m_entries[node.GetChangeStamp()];
+        if (entry.generation == m_generation && !entry.hash.IsEmpty())
+        {
+            return entry.hash;
+        }
+
+        NestedSignature signature = NestedSignature::Of(node);
+        if (!entry.hasOwn || entry.stamps != signature.stamps)
+        {
+            HashOwn(entry, BaseElement::SerializeOmitting(node, signature.GetSlotKeys()), signature.slots);
+            entry.stamps = std::move(signature.stamps);
+        }
+
+        std::map<std::string, ContentHash> members = entry.members;
+        std::map<std::string, std::vector<ContentHash>> slotArrays = entry.slotArrays;
+        for (std::size_t i = 0; i < signature.slots.size(); ++i)
+        {
+            if (!entry.spliced[i])
+            {
+                continue;
+            }
+            const auto& slot = signature.slots[i];
+            const ContentHash slotHash = slot.element ? Get(*slot.element) : Get(*slot.card);
+            const std::string& name = AdaptiveCardSchemaKeyToString(slot.key);
+            if (slot.index == NestedVisitor::NoIndex)
+            {
+                members[name] = slotHash;
+            }
+            else
+            {
+                slotArrays[name][slot.index] = slotHash;
+            }
+        }
+        for (const auto& slotArray : slotArrays)
+        {
+            members[slotArray.first] = ContentHashUtil::HashArray(slotArray.second);
+        }
+
+        entry.hash = ContentHashUtil::HashObject(members);
+        entry.generation = m_generation;
+        return entry.hash;
+    }
+
+    void StructuralHashCache::HashOwn(Entry& entry, const Json::Value& own, const std::vector<NestedSignature::SlotEntry>& slots)
+    {
+        entry.members.clear();
+        entry.slotArrays.clear();
+        entry.spliced.assign(slots.size(), false);
+        entry.hasOwn = true;
+
+        // elements and cards serialize to objects
+        for (auto it = own.begin(); it != own.end(); ++it)
+        {
+            entry.members[it.name()] = ContentHashUtil::HashJson(*it);
+        }
+        for (std::size_t i = 0; i < slots.size(); ++i)
+        {
+            const auto& slot = slots[i];
+            const std::string& name = AdaptiveCardSchemaKeyToString(slot.key);
+            const Json::Value* member = own.find(name.data(), name.data() + name.size());
+            if (member == nullptr)
+            {
+                continue;
+            }
+            if (slot.index == NestedVisitor::NoIndex)
+            {
+                entry.spliced[i] = member->isNull();
+            }
+            else if (member->isArray() && slot.index < member->size() && (*member)[slot.index].isNull())
+            {
+                auto found = entry.slotArrays.find(name);
+                if (found == entry.slotArrays.end())
+                {
+                    std::vector<ContentHash> items;
+                    items.reserve(member->size());
+                    for (const auto& item : *member)
+                    {
+                        items.push_back(ContentHashUtil::HashJson(item));
+                    }
+                    found = entry.slotArrays.emplace(name, std::move(items)).first;
+                }
+                entry.spliced[i] = true;
+            }
+        }
+    }
+
+    ContentHash BaseElement::GetStructuralHash() const
+    {
+        if (m_frozen)
+        {
+            return m_structuralHash;
+        }
+        StructuralHashCache cache;
+        return cache.Get(*this);
+    }
+
+    void BaseElement::Freeze()
+    {
+        if (m_frozen)
+        {
+            return;
+        }
+
+        if (m_fallbackAndRequires != nullptr && m_fallbackAndRequires->fallbackContent != nullptr)
+        {
+            m_fallbackAndRequires->fallbackContent->Freeze();
+        }
+
+        // composed from the hashes the elements nested in this one stored as they froze
+        m_structuralHash = GetStructuralHash();
+        m_changeStamp.Get();
+        m_frozen = true;
+    }
+
+    std::shared_ptr<BaseElement> BaseElement::Clone() const
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::CloneNotSupported, "Element type doesn't support cloning: " + m_typeString);
+    }
+
+    namespace
+    {
+        // The deep copy in progress on this thread
+        struct CloneSession
+        {
+            unsigned int depth = 0;
+            std::vector<std::pair<const BaseElement*, std::shared_ptr<BaseElement>>> clones;
+            std::vector<std::shared_ptr<ToggleVisibilityTarget>> targets;
+        };
+
+        thread_local CloneSession s_cloneSession;
+    }
+
+    BaseElement::CloneScope::CloneScope()
+    {
+        ++s_cloneSession.depth;
+    }
+
+    BaseElement::CloneScope::~CloneScope()
+    {
+        if (--s_cloneSession.depth == 0)
+        {
+            s_cloneSession.clones.clear();
+            s_cloneSession.targets.clear();
+        }
+    }
+
+    void BaseElement::CloneScope::Complete()
+    {
+        if (s_cloneSession.depth != 1 || s_cloneSession.targets.empty())
+        {
+            return;
+        }
+
+        std::unordered_map<const BaseElement*, std::shared_ptr<BaseElement>> clonesByOriginal(s_cloneSession.clones.begin(),
+                                                                                               s_cloneSession.clones.end());
+        for (const auto& target : s_cloneSession.targets)
+        {
+            const BaseElement* original = target->GetElement().get();
+            const auto found = original == nullptr ? clonesByOriginal.end() : clonesByOriginal.find(original);
+            target->SetElement(found == clonesByOriginal.end() ? nullptr : std::static_pointer_cast<BaseCardElement>(found->second));
+        }
+    }
+
+    void BaseElement::RecordClone(const BaseElement& original, const std::shared_ptr<BaseElement>& clone)
+    {
+        s_cloneSession.clones.emplace_back(&original, clone);
+    }
+
+    void BaseElement::RecordClonedTarget(const std::shared_ptr<ToggleVisibilityTarget>& target)
+    {
+        s_cloneSession.targets.push_back(target);
+    }
+
+    void BaseElement::DeepCopyMembers()
+    {
+        m_frozen = false;
+        if (m_fallbackAndRequires != nullptr && m_fallbackAndRequires->fallbackContent != nullptr)
+        {
+            m_fallbackAndRequires->fallbackContent = m_fallbackAndRequires->fallbackContent->Clone();
+        }
+    }
+
+    void BaseElement::ThrowIfFrozen() const
+    {
+        if (m_frozen)
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::FrozenObjectModification, "Frozen elements can't be modified");
+        }
+    }
+
+    void BaseElement::MarkChanged()
+    {
+        ThrowIfFrozen();
+        m_changeStamp.Renew();
+    }
+
     // Base implementation for elements that have no resource information
     void BaseElement::GetResourceInformation(std::vector<RemoteResourceInformation>& /*resourceInfo*/) { return; }
 
     void BaseElement::ParseRequires(ParseContext& /*context*/, const Json::Value& json)
     {
-        const auto requiresValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Requires, false);
+        const auto& requiresValue = ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Requires, false);
         if (!requiresValue.isNull())
         {
             if (requiresValue.isObject())
@@ -148,7 +691,7 @@ namespace AdaptiveSharedNamespace
                     try
                     {
                         SemanticVersion memberVersion(memberValue);
-                        m_requires.emplace(memberName, memberVersion);
+                        GetFallbackAndRequires().requirements.emplace(memberName, memberVersion);
                     }
                     catch (const AdaptiveCardParseException&)
                     {
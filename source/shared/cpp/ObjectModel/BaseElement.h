@@ -6,9 +6,14 @@
 #include "ParseUtil.h"
 #include "SemanticVersion.h"
 #include "RemoteResourceInformation.h"
+#include "ContentHash.h"
 
 namespace AdaptiveSharedNamespace
 {
+    class AdaptiveCard;
+    class BaseElement;
+    class ToggleVisibilityTarget;
+
     // Used to uniquely identify a single BaseElement-derived object through the course of deserializing. For more
     // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
     class InternalId
@@ -38,26 +43,169 @@ namespace AdaptiveSharedNamespace
         std::size_t operator()(const InternalId& internalId) const { return internalId.Hash(); }
     };
 
+    // Holds the names of the properties an element type knows how to parse. Instances only fill it while the per-type
+    // set is being built (see BaseElement::GetKnownProperties), so an element carries a single null pointer, and copies
+    // start out empty.
+    class KnownPropertiesSet
+    {
+    public:
+        KnownPropertiesSet() = default;
+        KnownPropertiesSet(const KnownPropertiesSet&) {}
+        KnownPropertiesSet& operator=(const KnownPropertiesSet&) { return *this; }
+
+        void insert(std::initializer_list<std::string> names) { Get().insert(names); }
+        void insert(const std::string& name) { Get().insert(name); }
+
+        std::unordered_set<std::string>& Get()
+        {
+            if (m_names == nullptr)
+            {
+                m_names = std::make_unique<std::unordered_set<std::string>>();
+            }
+            return *m_names;
+        }
+
+    private:
+        std::unique_ptr<std::unordered_set<std::string>> m_names;
+    };
+
+    // The change stamp of an element, card or part: a number unique within the process, assigned when it is first read
+    // and renewed by every change. Copies and moved-from objects are new states, so they are renewed as well. Reads may
+    // race with each other, as const access does: the stamp is assigned atomically.
+    class ChangeStamp
+    {
+    public:
+        ChangeStamp() = default;
+        ChangeStamp(const ChangeStamp&) {}
+        ChangeStamp(ChangeStamp&& other) { other.Renew(); }
+        ChangeStamp& operator=(const ChangeStamp&)
+        {
+            Renew();
+            return *this;
+        }
+        ChangeStamp& operator=(ChangeStamp&& other)
+        {
+            Renew();
+            other.Renew();
+            return *this;
+        }
+
+        void Renew() { m_value.store(0, std::memory_order_relaxed); }
+        std::uint64_t Get() const;
+
+    private:
+        // 0 until assigned
+        mutable std::atomic<std::uint64_t> m_value{0};
+    };
+
+    // Link to the element or card owning some parts, shared by it and them, and cleared when it goes away
+    struct OwnerLink
+    {
+        BaseElement* element;
+        AdaptiveCard* card;
+        // set for the link of parts handed out read-only (see ElementPartOwner::LinkReadOnly)
+        bool readOnly;
+    };
+
+    // Base of the objects kept in an element or card without being elements themselves: facts, choices, paragraphs and
+    // inlines, media sources, background images and toggle visibility targets. Each has a change stamp of its own,
+    // which serializations of its element are checked against (see BaseElement::VisitNested). Once linked to its
+    // element, a part's setters throw ErrorStatusCode::FrozenObjectModification when the element is frozen and let
+    // it drop what it derives from its parts (see BaseElement::PartChanged). A copy belongs to no element.
+    class ElementPart
+    {
+    public:
+        ElementPart() = default;
+        ElementPart(const ElementPart&) {}
+        ElementPart& operator=(const ElementPart&)
+        {
+            MarkChanged();
+            return *this;
+        }
+
+        std::uint64_t GetChangeStamp() const { return m_changeStamp.Get(); }
+
+    protected:
+        // Called by the non-const accessors that hand out a part's collections
+        void ThrowIfFrozen() const;
+        // Called by setters before they write: throws if frozen, and renews the change stamp
+        void MarkChanged();
+
+    private:
+        friend class ElementPartOwner;
+
+        // only written through const access by ElementPartOwner::LinkReadOnly, to a part no one else holds yet
+        mutable std::shared_ptr<OwnerLink> m_owner;
+        ChangeStamp m_changeStamp;
+    };
+
+    // Kept by every element and card to link its parts. Parts are linked by Freeze(), and by elements that derive
+    // something from their parts when they derive it; never by reads, so that const access writes to nothing. A copy
+    // starts out with nothing linked, as what it shares with the original still belongs to that.
+    class ElementPartOwner
+    {
+    public:
+        ElementPartOwner() = default;
+        ElementPartOwner(const ElementPartOwner&) {}
+        ElementPartOwner& operator=(const ElementPartOwner&) { return *this; }
+        ~ElementPartOwner();
+
+        // Links part to its owner, unless part is read-only or linked to a frozen element or card it's shared with
+        void Link(BaseElement& element, const ElementPart& part);
+        void Link(AdaptiveCard& card, const ElementPart& part);
+
+        // Makes the setters of a part no one else holds yet throw, without writing to anything but the part. For
+        // parts made on demand by const accessors, under a call_once.
+        static void LinkReadOnly(const ElementPart& part);
+
+    private:
+        void Link(BaseElement* element, AdaptiveCard* card, const ElementPart& part);
+
+        std::shared_ptr<OwnerLink> m_owner;
+    };
+
+    // Receives what an element or card holds besides its own properties (see BaseElement::VisitNested)
+    class NestedVisitor
+    {
+    public:
+        static constexpr unsigned int NoIndex = static_cast<unsigned int>(-1);
+
+        virtual ~NestedVisitor() = default;
+
+        // An element or card serialized through BaseElement::SerializeNested, at json[key] or json[key][index]
+        virtual void Slot(AdaptiveCardSchemaKey key, unsigned int index, const BaseElement& element) = 0;
+        virtual void Slot(AdaptiveCardSchemaKey key, unsigned int index, const AdaptiveCard& card) = 0;
+        // A part (see ElementPart) serialized with the element
+        virtual void Part(const ElementPart& part) = 0;
+        // An element serialized in the json of a part of this one, rather than through SerializeNested, together with
+        // everything beneath it
+        virtual void Inline(const BaseElement& element) = 0;
+    };
+
     class BaseElement
     {
     public:
-        BaseElement() :
-            m_additionalProperties{}, m_typeString{}, m_requires(0), m_fallbackContent(nullptr),
-            m_fallbackType(FallbackType::None), m_id{}, m_internalId{InternalId::Current()}
+        BaseElement() : m_typeString{}, m_additionalProperties{}, m_id{}, m_internalId{InternalId::Current()}, m_frozen(false)
         {
-            PopulateKnownPropertiesSet();
         }
 
-        BaseElement(const BaseElement&) = default;
+        BaseElement(const BaseElement& other);
         BaseElement(BaseElement&&) = default;
-        BaseElement& operator=(const BaseElement&) = default;
+        BaseElement& operator=(const BaseElement& other);
         BaseElement& operator=(BaseElement&&) = default;
         virtual ~BaseElement() = default;
 
         // Element type and identity
+        //
+        // Throughout the object model, Get<Property>Ref() is the non-copying counterpart of a string getter: it returns
+        // a reference to the stored value, valid until the property is next set or the object is destroyed. Ref
+        // accessors are not virtual and always read the stored value, so wrappers that override the virtual getter
+        // (e.g. GetId) must still be read through it.
         std::string GetElementTypeString() const;
+        const std::string& GetElementTypeStringRef() const;
         void SetElementTypeString(const std::string& value);
         virtual std::string GetId() const;
+        const std::string& GetIdRef() const;
         virtual void SetId(const std::string& value);
 
         const InternalId GetInternalId() const { return m_internalId; }
@@ -82,37 +230,233 @@ namespace AdaptiveSharedNamespace
         void SetAdditionalProperties(const Json::Value& additionalProperties);
 
         // Fallback and Requires support
-        FallbackType GetFallbackType() const { return m_fallbackType; }
-        std::shared_ptr<BaseElement> GetFallbackContent() const { return m_fallbackContent; }
-        void SetFallbackType(FallbackType type) { m_fallbackType = type; }
+        FallbackType GetFallbackType() const
+        {
+            return m_fallbackAndRequires ? m_fallbackAndRequires->fallbackType : FallbackType::None;
+        }
+        std::shared_ptr<BaseElement> GetFallbackContent() const
+        {
+            return m_fallbackAndRequires ? m_fallbackAndRequires->fallbackContent : nullptr;
+        }
+        void SetFallbackType(FallbackType type)
+        {
+            MarkChanged();
+            GetFallbackAndRequires().fallbackType = type;
+        }
         void SetFallbackContent(std::shared_ptr<BaseElement> element)
         {
-            m_fallbackContent = element;
+            MarkChanged();
+            GetFallbackAndRequires().fallbackContent = element;
         }
 
         bool MeetsRequirements(const std::unordered_map<std::string, std::string>& hostProvides) const;
 
+        // Structural (Merkle) hash of this element and everything beneath it: child elements, inline and select
+        // actions, ShowCard cards and fallback content. Equal to ContentHashUtil::HashJson(SerializeToJsonValue()), but
+        // composed from the hashes of the element's own json, with the elements and cards in its slots (see
+        // VisitNested) left out, and the structural hashes of those. Freeze() stores the hashes of the frozen tree; an
+        // unfrozen element composes its hash on each call, which StructuralHashCache spreads over many calls.
+        ContentHash GetStructuralHash() const;
+
+        // Freezing makes this element and everything beneath it read-only, parts (see ElementPart) included. Setters
+        // throw, as do the non-const accessors that hand out collections, so a frozen element is read through const
+        // access. Nothing is written to a frozen element again (structural hashes are stored first), so a frozen tree
+        // may be read from any number of threads without locking. Freezing is one-way.
+        virtual void Freeze();
+        bool IsFrozen() const { return m_frozen; }
+
+        // Reports the elements, cards and parts this element holds, always in the same order. Structural hashes,
+        // CardDiff and IncrementalSerializer all walk the tree through this. Overrides must call their base class's
+        // implementation first, and custom element types that serialize elements or parts of their own must override
+        // it to report them.
+        virtual void VisitNested(NestedVisitor& visitor) const;
+
+        // Change tracking. Setters renew an element's change stamp, so an unchanged stamp means its own properties are
+        // unchanged. Its slots and parts (see VisitNested) have stamps of their own, and lists changed through the
+        // non-const accessors show as a change in what VisitNested reports rather than in the stamp.
+        std::uint64_t GetChangeStamp() const { return m_changeStamp.Get(); }
+
+        // SerializeToJsonValue implementations serialize the elements and cards in their slots through these
+        static Json::Value SerializeNested(const BaseElement& element);
+        static Json::Value SerializeNested(const AdaptiveCard& card);
+
+        // Serializes element with the elements and cards in omitted written as null, which reads an element's own
+        // properties without serializing everything beneath it
+        static Json::Value SerializeOmitting(const BaseElement& element, const std::unordered_set<const void*>& omitted);
+        static Json::Value SerializeOmitting(const AdaptiveCard& card, const std::unordered_set<const void*>& omitted);
+
+        // Returns a mutable shallow copy of element. Child elements and parts are shared with the original rather than
+        // copied, so deriving a modified tree from a frozen one only copies the path down to the modified element.
+        // Parts of a frozen original stay read-only; replace them by copies to modify them.
+        template<typename T> static std::shared_ptr<T> Derive(const T& element);
+
+        // Deep copy of this element and everything beneath it, copied directly rather than through json. The copy
+        // keeps the original's InternalIds, fallback content and additional properties, and is never frozen. For a
+        // copy-on-write clone, Freeze() the original and Derive() from it instead. Custom element types must override
+        // Clone() (typically as "return MakeClone(*this);") to be cloneable.
+        virtual std::shared_ptr<BaseElement> Clone() const;
+
+        // Spans one deep copy, which clones elements nested in each other. Toggle visibility targets copied within it
+        // are resolved once the outermost scope completes, to the copy of the element the original target referred to
+        // (or to nothing, when that element wasn't copied). AdaptiveCard::Clone opens one around the whole card.
+        class CloneScope
+        {
+        public:
+            CloneScope();
+            ~CloneScope();
+            CloneScope(const CloneScope&) = delete;
+            CloneScope& operator=(const CloneScope&) = delete;
+
+            void Complete();
+        };
+
         // Misc.
         virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceUris);
 
     protected:
+        // Called by the non-const accessors that hand out an element's collections
+        void ThrowIfFrozen() const;
+        // Called by every setter before it writes: throws if frozen, and renews the change stamp
+        void MarkChanged();
+        // Called after a linked part (see ElementPart) of this element has been marked changed, for elements that keep
+        // something derived from their parts
+        virtual void PartChanged() {}
+
+        // Copy-constructs element, then lets the copy replace whatever it shares with the original by copies of its own
+        template<typename T> static std::shared_ptr<T> MakeClone(const T& element);
+        virtual void DeepCopyMembers();
+        // Within a CloneScope: notes that clone was copied from original, and that target (a copy) still refers to an
+        // element of the original tree
+        static void RecordClone(const BaseElement& original, const std::shared_ptr<BaseElement>& clone);
+        static void RecordClonedTarget(const std::shared_ptr<ToggleVisibilityTarget>& target);
+
+        // Adds the names of the properties this type parses to m_knownProperties. Overrides must call their base
+        // class's implementation first. Deserializers read the result through GetKnownProperties<T>(), which builds it
+        // once per type; HandleUnknownProperties moves every other property into the additional properties.
         virtual void PopulateKnownPropertiesSet();
+        template<typename T> static const std::unordered_set<std::string>& GetKnownProperties();
+
         void SetTypeString(const std::string& type) { m_typeString = type; }
         std::string m_typeString;
-        std::unordered_set<std::string> m_knownProperties;
+        KnownPropertiesSet m_knownProperties;
         Json::Value m_additionalProperties;
+        ElementPartOwner m_partOwner;
 
     private:
+        friend class ElementPart;
+        friend class StructuralHashCache;
+
+        // Most elements have neither fallback nor requirements, so those live outside the element and are only
+        // allocated once set
+        struct FallbackAndRequires
+        {
+            std::unordered_map<std::string, SemanticVersion> requirements;
+            std::shared_ptr<BaseElement> fallbackContent;
+            FallbackType fallbackType = FallbackType::None;
+        };
+
         template<typename T> void ParseFallback(ParseContext& context, const Json::Value& json);
         void ParseRequires(ParseContext& context, const Json::Value& json);
+        FallbackAndRequires& GetFallbackAndRequires();
 
-        std::unordered_map<std::string, SemanticVersion> m_requires;
-        std::shared_ptr<BaseElement> m_fallbackContent;
-        InternalId m_internalId;
-        FallbackType m_fallbackType;
+        std::unique_ptr<FallbackAndRequires> m_fallbackAndRequires;
         std::string m_id;
+        // stored by Freeze()
+        ContentHash m_structuralHash;
+        ChangeStamp m_changeStamp;
+        InternalId m_internalId;
+        bool m_frozen;
     };
 
+    // What the serialization of an element or card depends on besides its own change stamp, as VisitNested reports it:
+    // the stamps of its parts, of the elements and cards in its slots, and of everything beneath its inline elements.
+    // Two equal signatures of one element mean that its json, with its slots left out, is unchanged if its stamp is.
+    struct NestedSignature
+    {
+        struct SlotEntry
+        {
+            AdaptiveCardSchemaKey key;
+            unsigned int index;
+            const BaseElement* element;
+            const AdaptiveCard* card;
+        };
+
+        static NestedSignature Of(const BaseElement& element);
+        static NestedSignature Of(const AdaptiveCard& card);
+
+        // The slots' elements and cards, as BaseElement::SerializeOmitting takes them
+        std::unordered_set<const void*> GetSlotKeys() const;
+
+        std::vector<std::uint64_t> stamps;
+        std::vector<SlotEntry> slots;
+    };
+
+    // Keeps what it composes for BaseElement::GetStructuralHash and AdaptiveCard::ComputeContentHash, so that reading
+    // many hashes of one tree, or of one tree as it changes, serializes only what changed since. An element's own json is
+    // hashed again only when its change stamp or its signature (see NestedSignature) differs from the last time; the
+    // rest is a walk of the stamps, once per Get() call. Frozen elements and cards read their stored hashes instead.
+    // Not for use from several threads at once.
+    class StructuralHashCache
+    {
+    public:
+        ContentHash Get(const BaseElement& element);
+        ContentHash Get(const AdaptiveCard& card);
+
+        // Drops the entries of the elements and cards the latest Get() call didn't reach
+        void Prune();
+
+    private:
+        struct Entry
+        {
+            std::vector<std::uint64_t> stamps;
+            // hashes of the members of the node's own json, and the item hashes of its arrays holding slots
+            std::map<std::string, ContentHash> members;
+            std::map<std::string, std::vector<ContentHash>> slotArrays;
+            // per slot of the signature: whether the own json holds null in its place, which its hash then takes
+            std::vector<bool> spliced;
+            bool hasOwn = false;
+            ContentHash hash;
+            std::uint64_t generation = 0;
+        };
+
+        void HashOwn(Entry& entry, const Json::Value& own, const std::vector<NestedSignature::SlotEntry>& slots);
+
+        template<typename T> ContentHash Compose(const T& node);
+
+        // by change stamp, which no other state of any element or card ever takes
+        std::unordered_map<std::uint64_t, Entry> m_entries;
+        std::uint64_t m_generation = 0;
+        unsigned int m_depth = 0;
+    };
+
+    template<typename T> const std::unordered_set<std::string>& BaseElement::GetKnownProperties()
+    {
+        static const std::unordered_set<std::string> knownProperties = []() {
+            T prototype;
+            BaseElement& element = prototype;
+            element.PopulateKnownPropertiesSet();
+            return std::move(element.m_knownProperties.Get());
+        }();
+        return knownProperties;
+    }
+
+    template<typename T> std::shared_ptr<T> BaseElement::Derive(const T& element)
+    {
+        auto copy = std::make_shared<T>(element);
+        static_cast<BaseElement*>(copy.get())->m_frozen = false;
+        return copy;
+    }
+
+    template<typename T> std::shared_ptr<T> BaseElement::MakeClone(const T& element)
+    {
+        CloneScope scope;
+        auto clone = std::make_shared<T>(element);
+        static_cast<BaseElement*>(clone.get())->DeepCopyMembers();
+        RecordClone(element, clone);
+        scope.Complete();
+        return clone;
+    }
+
     template<typename T> void BaseElement::DeserializeBase(ParseContext& context, const Json::Value& json)
     {
         ParseUtil::ThrowIfNotJsonObject(json);
@@ -126,7 +470,7 @@ namespace AdaptiveSharedNamespace
 
     template<typename T> void BaseElement::ParseFallback(ParseContext& context, const Json::Value& json)
     {
-        const auto fallbackValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::Fallback, false);
+        const auto& fallbackValue = ParseUtil::ExtractJsonValueRef(json, AdaptiveCardSchemaKey::Fallback, false);
         if (!fallbackValue.empty())
         {
             // Two possible valid json values for fallback -- either the string "drop", or a valid Adaptive Card
@@ -136,7 +480,7 @@ namespace AdaptiveSharedNamespace
                 auto fallbackStringValue = ParseUtil::ToLowercase(fallbackValue.asString());
                 if (fallbackStringValue == "drop")
                 {
-                    m_fallbackType = FallbackType::Drop;
+                    GetFallbackAndRequires().fallbackType = FallbackType::Drop;
                     return;
                 }
                 throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
@@ -153,8 +497,9 @@ namespace AdaptiveSharedNamespace
 
                 if (fallbackElement)
                 {
-                    m_fallbackType = FallbackType::Content;
-                    m_fallbackContent = fallbackElement;
+                    auto& fallbackAndRequires = GetFallbackAndRequires();
+                    fallbackAndRequires.fallbackType = FallbackType::Content;
+                    fallbackAndRequires.fallbackContent = fallbackElement;
                     return;
                 }
                 throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Fallback content did not parse correctly.");
@@ -20,6 +20,7 @@ bool BaseInputElement::GetIsRequired() const
 
 void BaseInputElement::SetIsRequired(const bool value)
 {
+    MarkChanged();
     m_isRequired = value;
 }
 
@@ -0,0 +1,431 @@
+#include "pch.h"
+#include "CardDiff.h"
+#include "ActionSet.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "ImageSet.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        // A list of elements nested in an element or card, under the given property
+        struct ElementList
+        {
+            AdaptiveCardSchemaKey key;
+            bool isAction;
+            std::vector<std::shared_ptr<BaseElement>> elements;
+        };
+
+        template<typename T>
+        void AppendList(AdaptiveCardSchemaKey key, bool isAction, const std::vector<std::shared_ptr<T>>& elements, std::vector<ElementList>& lists)
+        {
+            lists.push_back(ElementList{key, isAction, std::vector<std::shared_ptr<BaseElement>>(elements.begin(), elements.end())});
+        }
+
+        void AppendLists(const BaseElement& element, bool isAction, std::vector<ElementList>& lists)
+        {
+            if (isAction)
+            {
+                return;
+            }
+
+            switch (static_cast<const BaseCardElement&>(element).GetElementType())
+            {
+            case CardElementType::Container:
+                AppendList(AdaptiveCardSchemaKey::Items, false, static_cast<const Container&>(element).GetItems(), lists);
+                break;
+            case CardElementType::Column:
+                AppendList(AdaptiveCardSchemaKey::Items, false, static_cast<const Column&>(element).GetItems(), lists);
+                break;
+            case CardElementType::ColumnSet:
+                AppendList(AdaptiveCardSchemaKey::Columns, false, static_cast<const ColumnSet&>(element).GetColumns(), lists);
+                break;
+            case CardElementType::ImageSet:
+                AppendList(AdaptiveCardSchemaKey::Images, false, static_cast<const ImageSet&>(element).GetImages(), lists);
+                break;
+            case CardElementType::ActionSet:
+                AppendList(AdaptiveCardSchemaKey::Actions, true, static_cast<const ActionSet&>(element).GetActions(), lists);
+                break;
+            default:
+                break;
+            }
+        }
+
+        void AppendCardLists(const AdaptiveCard& card, std::vector<ElementList>& lists)
+        {
+            AppendList(AdaptiveCardSchemaKey::Body, false, card.GetBody(), lists);
+            AppendList(AdaptiveCardSchemaKey::Actions, true, card.GetActions(), lists);
+        }
+
+        std::string EscapePathSegment(const std::string& segment)
+        {
+            std::string escaped;
+            escaped.reserve(segment.size());
+            for (const char c : segment)
+            {
+                if (c == '~')
+                {
+                    escaped += "~0";
+                }
+                else if (c == '/')
+                {
+                    escaped += "~1";
+                }
+                else
+                {
+                    escaped.push_back(c);
+                }
+            }
+            return escaped;
+        }
+
+        std::string ChildPath(const std::string& path, const std::string& key) { return path + "/" + EscapePathSegment(key); }
+
+        std::string ChildPath(const std::string& path, std::size_t index) { return path + "/" + std::to_string(index); }
+
+        // Positions in sequence that are not part of one of its longest increasing subsequences
+        std::vector<bool> OutOfOrder(const std::vector<std::size_t>& sequence)
+        {
+            // tails[k]: position in sequence of the smallest tail of an increasing subsequence of length k + 1
+            std::vector<std::size_t> tails;
+            std::vector<std::size_t> previous(sequence.size(), std::numeric_limits<std::size_t>::max());
+            for (std::size_t i = 0; i < sequence.size(); ++i)
+            {
+                const auto it = std::lower_bound(tails.begin(), tails.end(), sequence[i], [&sequence](std::size_t position, std::size_t value) {
+                    return sequence[position] < value;
+                });
+                if (it != tails.begin())
+                {
+                    previous[i] = *(it - 1);
+                }
+                if (it == tails.end())
+                {
+                    tails.push_back(i);
+                }
+                else
+                {
+                    *it = i;
+                }
+            }
+
+            std::vector<bool> outOfOrder(sequence.size(), true);
+            for (std::size_t i = tails.empty() ? previous.size() : tails.back(); i < sequence.size(); i = previous[i])
+            {
+                outOfOrder[i] = false;
+            }
+            return outOfOrder;
+        }
+
+        class CardDiffer
+        {
+        public:
+            explicit CardDiffer(std::vector<CardEdit>& edits) : m_edits(edits) {}
+
+            void DiffCard(const AdaptiveCard& oldCard, const AdaptiveCard& newCard, const std::string& oldPath, const std::string& newPath)
+            {
+                std::vector<ElementList> oldLists;
+                std::vector<ElementList> newLists;
+                AppendCardLists(oldCard, oldLists);
+                AppendCardLists(newCard, newLists);
+
+                std::unordered_set<std::string> skippedProperties;
+                std::unordered_set<const void*> oldOmitted;
+                std::unordered_set<const void*> newOmitted;
+                OmitLists(oldLists, oldOmitted, skippedProperties);
+                OmitLists(newLists, newOmitted, skippedProperties);
+
+                DiffProperties(BaseElement::SerializeOmitting(oldCard, oldOmitted),
+                               BaseElement::SerializeOmitting(newCard, newOmitted),
+                               skippedProperties,
+                               nullptr,
+                               nullptr,
+                               newPath);
+                DiffLists(oldLists, newLists, oldPath, newPath);
+            }
+
+            void DiffElement(const std::shared_ptr<BaseElement>& oldElement,
+                             const std::shared_ptr<BaseElement>& newElement,
+                             bool isAction,
+                             const std::string& oldPath,
+                             const std::string& newPath)
+            {
+                if (oldElement == newElement || oldElement->GetStructuralHash() == newElement->GetStructuralHash())
+                {
+                    return;
+                }
+
+                std::vector<ElementList> oldLists;
+                std::vector<ElementList> newLists;
+                AppendLists(*oldElement, isAction, oldLists);
+                AppendLists(*newElement, isAction, newLists);
+
+                std::unordered_set<std::string> skippedProperties;
+                std::unordered_set<const void*> oldOmitted;
+                std::unordered_set<const void*> newOmitted;
+                OmitLists(oldLists, oldOmitted, skippedProperties);
+                OmitLists(newLists, newOmitted, skippedProperties);
+
+                // fallback content and ShowCard cards on both sides are compared recursively; where only one side has
+                // one, it's a property change
+                const std::string fallbackKey = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback);
+                const auto oldFallback = oldElement->GetFallbackContent();
+                const auto newFallback = newElement->GetFallbackContent();
+                const bool diffFallback = oldElement->GetFallbackType() == FallbackType::Content &&
+                                          newElement->GetFallbackType() == FallbackType::Content && oldFallback && newFallback;
+                if (diffFallback)
+                {
+                    oldOmitted.insert(oldFallback.get());
+                    newOmitted.insert(newFallback.get());
+                    skippedProperties.insert(fallbackKey);
+                }
+
+                const std::string cardKey = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card);
+                std::shared_ptr<AdaptiveCard> oldCard;
+                std::shared_ptr<AdaptiveCard> newCard;
+                if (isAction && static_cast<const BaseActionElement&>(*oldElement).GetElementType() == ActionType::ShowCard)
+                {
+                    oldCard = static_cast<const ShowCardAction&>(*oldElement).GetCard();
+                    newCard = static_cast<const ShowCardAction&>(*newElement).GetCard();
+                    if (oldCard && newCard)
+                    {
+                        oldOmitted.insert(oldCard.get());
+                        newOmitted.insert(newCard.get());
+                        skippedProperties.insert(cardKey);
+                    }
+                }
+
+                DiffProperties(BaseElement::SerializeOmitting(*oldElement, oldOmitted),
+                               BaseElement::SerializeOmitting(*newElement, newOmitted),
+                               skippedProperties,
+                               oldElement,
+                               newElement,
+                               newPath);
+
+                if (diffFallback)
+                {
+                    DiffElement(oldFallback, newFallback, isAction, ChildPath(oldPath, fallbackKey), ChildPath(newPath, fallbackKey));
+                }
+                DiffLists(oldLists, newLists, oldPath, newPath);
+                if (oldCard && newCard)
+                {
+                    DiffCard(*oldCard, *newCard, ChildPath(oldPath, cardKey), ChildPath(newPath, cardKey));
+                }
+            }
+
+        private:
+            static void OmitLists(const std::vector<ElementList>& lists,
+                                  std::unordered_set<const void*>& omitted,
+                                  std::unordered_set<std::string>& skippedProperties)
+            {
+                for (const auto& list : lists)
+                {
+                    skippedProperties.insert(AdaptiveCardSchemaKeyToString(list.key));
+                    for (const auto& element : list.elements)
+                    {
+                        omitted.insert(element.get());
+                    }
+                }
+            }
+
+            void DiffProperties(const Json::Value& oldJson,
+                                const Json::Value& newJson,
+                                const std::unordered_set<std::string>& skippedProperties,
+                                const std::shared_ptr<BaseElement>& oldElement,
+                                const std::shared_ptr<BaseElement>& newElement,
+                                const std::string& newPath)
+            {
+                const auto changeProperty = [&](const std::string& name, const Json::Value& oldValue, const Json::Value& newValue) {
+                    CardEdit edit{CardEditType::ChangeProperty, ChildPath(newPath, name), {}, name, oldValue, newValue, oldElement, newElement};
+                    m_edits.push_back(std::move(edit));
+                };
+
+                for (auto it = oldJson.begin(); it != oldJson.end(); ++it)
+                {
+                    const std::string name = it.name();
+                    if (skippedProperties.count(name) != 0)
+                    {
+                        continue;
+                    }
+                    const Json::Value& newValue = newJson.isMember(name) ? newJson[name] : Json::Value::nullSingleton();
+                    if (*it != newValue)
+                    {
+                        changeProperty(name, *it, newValue);
+                    }
+                }
+                for (auto it = newJson.begin(); it != newJson.end(); ++it)
+                {
+                    const std::string name = it.name();
+                    if (skippedProperties.count(name) == 0 && !oldJson.isMember(name))
+                    {
+                        changeProperty(name, Json::Value(), *it);
+                    }
+                }
+            }
+
+            void DiffLists(const std::vector<ElementList>& oldLists,
+                           const std::vector<ElementList>& newLists,
+                           const std::string& oldPath,
+                           const std::string& newPath)
+            {
+                for (const auto& newList : newLists)
+                {
+                    const auto oldList = std::find_if(oldLists.begin(), oldLists.end(), [&newList](const ElementList& list) {
+                        return list.key == newList.key;
+                    });
+                    if (oldList != oldLists.end())
+                    {
+                        const std::string key = AdaptiveCardSchemaKeyToString(newList.key);
+                        DiffList(oldList->elements, newList.elements, newList.isAction, ChildPath(oldPath, key), ChildPath(newPath, key));
+                    }
+                }
+            }
+
+            void DiffList(const std::vector<std::shared_ptr<BaseElement>>& oldElements,
+                          const std::vector<std::shared_ptr<BaseElement>>& newElements,
+                          bool isAction,
+                          const std::string& oldPath,
+                          const std::string& newPath)
+            {
+                const std::size_t unmatched = std::numeric_limits<std::size_t>::max();
+                std::vector<std::size_t> oldMatch(oldElements.size(), unmatched);
+                std::vector<std::size_t> newMatch(newElements.size(), unmatched);
+                const auto match = [&](std::size_t oldIndex, std::size_t newIndex) {
+                    oldMatch[oldIndex] = newIndex;
+                    newMatch[newIndex] = oldIndex;
+                };
+                const auto sameType = [&](std::size_t oldIndex, std::size_t newIndex) {
+                    return oldElements[oldIndex]->GetElementTypeStringRef() == newElements[newIndex]->GetElementTypeStringRef();
+                };
+
+                // by id
+                std::unordered_map<std::string, std::size_t> oldById;
+                for (std::size_t i = 0; i < oldElements.size(); ++i)
+                {
+                    const std::string& id = oldElements[i]->GetIdRef();
+                    if (!id.empty())
+                    {
+                        oldById.emplace(id, i);
+                    }
+                }
+                for (std::size_t j = 0; j < newElements.size() && !oldById.empty(); ++j)
+                {
+                    const std::string& id = newElements[j]->GetIdRef();
+                    const auto found = id.empty() ? oldById.end() : oldById.find(id);
+                    if (found != oldById.end() && oldMatch[found->second] == unmatched && sameType(found->second, j))
+                    {
+                        match(found->second, j);
+                    }
+                }
+
+                // unchanged elements, by structural hash
+                std::unordered_map<ContentHash, std::vector<std::size_t>, ContentHashKeyHash> oldByHash;
+                for (std::size_t i = oldElements.size(); i-- > 0;)
+                {
+                    if (oldMatch[i] == unmatched)
+                    {
+                        oldByHash[oldElements[i]->GetStructuralHash()].push_back(i);
+                    }
+                }
+                for (std::size_t j = 0; j < newElements.size() && !oldByHash.empty(); ++j)
+                {
+                    if (newMatch[j] != unmatched)
+                    {
+                        continue;
+                    }
+                    const auto found = oldByHash.find(newElements[j]->GetStructuralHash());
+                    if (found != oldByHash.end() && !found->second.empty())
+                    {
+                        // earliest first, as the indices were pushed in reverse
+                        match(found->second.back(), j);
+                        found->second.pop_back();
+                    }
+                }
+
+                // the rest by position among what's left, where the types agree and the ids don't say otherwise
+                std::size_t i = 0;
+                for (std::size_t j = 0; j < newElements.size(); ++j)
+                {
+                    if (newMatch[j] != unmatched)
+                    {
+                        continue;
+                    }
+                    while (i < oldElements.size() && oldMatch[i] != unmatched)
+                    {
+                        ++i;
+                    }
+                    if (i == oldElements.size())
+                    {
+                        break;
+                    }
+                    if (sameType(i, j) && (oldElements[i]->GetIdRef().empty() || newElements[j]->GetIdRef().empty()))
+                    {
+                        match(i, j);
+                    }
+                    ++i;
+                }
+
+                for (std::size_t i = 0; i < oldElements.size(); ++i)
+                {
+                    if (oldMatch[i] == unmatched)
+                    {
+                        m_edits.push_back(CardEdit{CardEditType::Remove, ChildPath(oldPath, i), {}, {}, {}, {}, oldElements[i], nullptr});
+                    }
+                }
+
+                std::vector<std::size_t> matchedOldIndices;
+                std::vector<std::size_t> matchedNewIndices;
+                for (std::size_t j = 0; j < newElements.size(); ++j)
+                {
+                    if (newMatch[j] == unmatched)
+                    {
+                        m_edits.push_back(CardEdit{
+                            CardEditType::Insert, ChildPath(newPath, j), {}, {}, {}, newElements[j]->SerializeToJsonValue(), nullptr, newElements[j]});
+                    }
+                    else
+                    {
+                        matchedOldIndices.push_back(newMatch[j]);
+                        matchedNewIndices.push_back(j);
+                    }
+                }
+
+                const std::vector<bool> moved = OutOfOrder(matchedOldIndices);
+                for (std::size_t k = 0; k < moved.size(); ++k)
+                {
+                    if (moved[k])
+                    {
+                        const std::size_t oldIndex = matchedOldIndices[k];
+                        const std::size_t newIndex = matchedNewIndices[k];
+                        m_edits.push_back(CardEdit{CardEditType::Move,
+                                                   ChildPath(newPath, newIndex),
+                                                   ChildPath(oldPath, oldIndex),
+                                                   {},
+                                                   {},
+                                                   {},
+                                                   oldElements[oldIndex],
+                                                   newElements[newIndex]});
+                    }
+                }
+
+                for (std::size_t k = 0; k < matchedNewIndices.size(); ++k)
+                {
+                    const std::size_t oldIndex = matchedOldIndices[k];
+                    const std::size_t newIndex = matchedNewIndices[k];
+                    DiffElement(oldElements[oldIndex], newElements[newIndex], isAction, ChildPath(oldPath, oldIndex), ChildPath(newPath, newIndex));
+                }
+            }
+
+            std::vector<CardEdit>& m_edits;
+        };
+    }
+
+    std::vector<CardEdit> DiffCards(const AdaptiveCard& oldCard, const AdaptiveCard& newCard)
+    {
+        std::vector<CardEdit> edits;
+        CardDiffer(edits).DiffCard(oldCard, newCard, "", "");
+        return edits;
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseElement;
+
+    enum class CardEditType
+    {
+        ChangeProperty,
+        Insert,
+        Remove,
+        Move
+    };
+
+    // One step of the edit script produced by DiffCards. Paths are JSON Pointers (RFC 6901) into the serialized
+    // cards: Remove's path and Move's fromPath address the old card, every other path the new one.
+    struct CardEdit
+    {
+        CardEditType type;
+        std::string path;
+        std::string fromPath;
+
+        // ChangeProperty: the property, whose old and new values are null where it is absent. path addresses the
+        // property itself, i.e. the element's path followed by the escaped property name.
+        std::string propertyName;
+        Json::Value oldValue;
+        // also the inserted element's json for Insert
+        Json::Value newValue;
+
+        // The element removed, inserted, moved or whose property changed, in the old and the new card. Both are null
+        // for properties of a card.
+        std::shared_ptr<BaseElement> oldElement;
+        std::shared_ptr<BaseElement> newElement;
+    };
+
+    // Structural diff of two cards. In each list of elements (a card's body and actions, a container's items, a column
+    // set's columns and so on), elements are matched by id where they have one, then unchanged elements by structural
+    // hash, then the rest by position among elements of the same type, unless both have (different) ids. Unmatched
+    // elements become Removes and Inserts, and matched elements that changed order become Moves: as few as keep the
+    // others in order. Matched elements, and fallback content and ShowCard cards present on both sides, are then
+    // compared property by property and recursively.
+    //
+    // Subtrees with equal structural hashes (BaseElement::GetStructuralHash) are skipped without being visited. Hashes
+    // stay current as elements are modified, so cards may be edited between diffs.
+    std::vector<CardEdit> DiffCards(const AdaptiveCard& oldCard, const AdaptiveCard& newCard);
+}
@@ -0,0 +1,1326 @@
+#include "pch.h"
+#include "CardPatcher.h"
+#include "ActionSet.h"
+#include "AdaptiveCardParseException.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "Paragraph.h"
+#include "ParseContext.h"
+#include "ParseResult.h"
+#include "ParseUtil.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        enum class PatchOperation
+        {
+            Add,
+            Remove,
+            Replace
+        };
+
+        AdaptiveCardParseException PatchError(const std::string& message)
+        {
+            return AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "JSON Patch: " + message);
+        }
+
+        // Splits a JSON Pointer (RFC 6901) into unescaped reference tokens
+        std::vector<std::string> DecodePointer(const std::string& pointer)
+        {
+            std::vector<std::string> tokens;
+            if (pointer.empty())
+            {
+                return tokens;
+            }
+            if (pointer[0] != '/')
+            {
+                throw PatchError("path must be empty or start with '/': " + pointer);
+            }
+
+            for (std::size_t start = 1;; )
+            {
+                const std::size_t end = std::min(pointer.find('/', start), pointer.size());
+                std::string token;
+                for (std::size_t i = start; i < end; ++i)
+                {
+                    if (pointer[i] != '~')
+                    {
+                        token.push_back(pointer[i]);
+                    }
+                    else if (i + 1 < end && (pointer[i + 1] == '0' || pointer[i + 1] == '1'))
+                    {
+                        token.push_back(pointer[++i] == '0' ? '~' : '/');
+                    }
+                    else
+                    {
+                        throw PatchError("invalid escape in path: " + pointer);
+                    }
+                }
+                tokens.push_back(std::move(token));
+                if (end == pointer.size())
+                {
+                    return tokens;
+                }
+                start = end + 1;
+            }
+        }
+
+        // Index into an array of the given size; "-" (past the end) and size itself are accepted only for add
+        std::size_t ParseIndex(const std::string& token, std::size_t size, bool isAdd)
+        {
+            if (isAdd && token == "-")
+            {
+                return size;
+            }
+
+            const bool isNumber = !token.empty() && token.size() < 10 && (token == "0" || token[0] != '0') &&
+                                  std::all_of(token.begin(), token.end(), [](char c) { return c >= '0' && c <= '9'; });
+            const std::size_t index = isNumber ? static_cast<std::size_t>(std::stoul(token)) : 0;
+            if (!isNumber || index > size || (index == size && !isAdd))
+            {
+                throw PatchError("array index out of range: " + token);
+            }
+            return index;
+        }
+
+        const Json::Value& Navigate(const Json::Value& document, const std::vector<std::string>& path, std::size_t begin)
+        {
+            const Json::Value* value = &document;
+            for (std::size_t i = begin; i < path.size(); ++i)
+            {
+                if (value->isObject() && value->isMember(path[i]))
+                {
+                    value = &(*value)[path[i]];
+                }
+                else if (value->isArray())
+                {
+                    value = &(*value)[static_cast<Json::ArrayIndex>(ParseIndex(path[i], value->size(), false))];
+                }
+                else
+                {
+                    throw PatchError("no value at '" + path[i] + "'");
+                }
+            }
+            return *value;
+        }
+
+        // Applies an operation to the value at path[begin..], which mustn't be the document itself
+        void PatchJson(Json::Value& document, PatchOperation operation, const std::vector<std::string>& path, std::size_t begin, const Json::Value& value)
+        {
+            std::vector<std::string> parentPath(path.begin() + begin, path.end() - 1);
+            auto& parent = const_cast<Json::Value&>(Navigate(document, parentPath, 0));
+            const std::string& last = path.back();
+
+            if (parent.isObject())
+            {
+                if (operation != PatchOperation::Add && !parent.isMember(last))
+                {
+                    throw PatchError("no value at '" + last + "'");
+                }
+                if (operation == PatchOperation::Remove)
+                {
+                    parent.removeMember(last);
+                }
+                else
+                {
+                    parent[last] = value;
+                }
+            }
+            else if (parent.isArray())
+            {
+                const auto index = static_cast<Json::ArrayIndex>(ParseIndex(last, parent.size(), operation == PatchOperation::Add));
+                if (operation == PatchOperation::Add)
+                {
+                    // jsoncpp has no insert: append, then swap the new value down into place
+                    parent.append(value);
+                    for (Json::ArrayIndex i = parent.size() - 1; i > index; --i)
+                    {
+                        parent[i].swap(parent[i - 1]);
+                    }
+                }
+                else if (operation == PatchOperation::Remove)
+                {
+                    Json::Value removed;
+                    parent.removeIndex(index, &removed);
+                }
+                else
+                {
+                    parent[index] = value;
+                }
+            }
+            else
+            {
+                throw PatchError("no container at '" + last + "'");
+            }
+        }
+
+        bool IsNumber(const Json::Value& value)
+        {
+            return value.type() == Json::intValue || value.type() == Json::uintValue || value.type() == Json::realValue;
+        }
+
+        // Equality as the "test" operation defines it: numbers compare by value, whichever way they were stored, and
+        // arrays and objects compare member by member
+        bool JsonEquals(const Json::Value& left, const Json::Value& right)
+        {
+            if (IsNumber(left) && IsNumber(right))
+            {
+                if (left.type() == Json::realValue || right.type() == Json::realValue)
+                {
+                    return left.asDouble() == right.asDouble();
+                }
+                const bool leftNegative = left.type() == Json::intValue && left.asLargestInt() < 0;
+                const bool rightNegative = right.type() == Json::intValue && right.asLargestInt() < 0;
+                if (leftNegative || rightNegative)
+                {
+                    return leftNegative && rightNegative && left.asLargestInt() == right.asLargestInt();
+                }
+                return left.asLargestUInt() == right.asLargestUInt();
+            }
+
+            if (left.type() != right.type() || left.size() != right.size())
+            {
+                return false;
+            }
+            if (left.isArray())
+            {
+                for (Json::ArrayIndex i = 0; i < left.size(); ++i)
+                {
+                    if (!JsonEquals(left[i], right[i]))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            if (left.isObject())
+            {
+                for (auto member = left.begin(); member != left.end(); ++member)
+                {
+                    const std::string name = member.name();
+                    const Json::Value* other = right.find(name.data(), name.data() + name.size());
+                    if (other == nullptr || !JsonEquals(*member, *other))
+                    {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            return left == right;
+        }
+
+        Json::Value FactJson(const TitleValueView& fact)
+        {
+            // as Fact::SerializeToJsonValue
+            Json::Value json;
+            json[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title)] = fact.GetTitle();
+            json[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)] = fact.GetValue();
+            return json;
+        }
+
+        // Title and value of a fact, validated as FactSetParser does
+        std::pair<std::string, std::string> ParseFact(const Json::Value& json)
+        {
+            ParseUtil::ThrowIfNotJsonObject(json);
+            return std::make_pair(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true),
+                                  ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, true));
+        }
+
+        std::shared_ptr<BaseCardElement> ParseCardElement(ParseContext& context, const Json::Value& json)
+        {
+            return BaseCardElement::DeserializeElement(context, json);
+        }
+
+        std::shared_ptr<BaseActionElement> ParseAction(ParseContext& context, const Json::Value& json)
+        {
+            auto action = ParseUtil::GetActionFromJsonValue(context, json);
+            if (action == nullptr)
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                                 "Unable to parse action of type " + ParseUtil::GetTypeAsString(json));
+            }
+            return action;
+        }
+
+        std::shared_ptr<Column> ParseColumn(ParseContext& context, const Json::Value& json)
+        {
+            return Column::Deserialize(context, json);
+        }
+
+        std::shared_ptr<Image> ParseImage(ParseContext& context, const Json::Value& json)
+        {
+            auto element = BaseCardElement::DeserializeElement(context, json);
+            if (element->GetElementType() != CardElementType::Image)
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "An ImageSet may only contain images");
+            }
+            return std::static_pointer_cast<Image>(element);
+        }
+
+        // The places an element can be put: one of the lists of a card or element, or an element's fallback content
+        class ElementSlots
+        {
+        public:
+            explicit ElementSlots(bool isAction) : m_isAction(isAction) {}
+            virtual ~ElementSlots() = default;
+
+            bool IsAction() const { return m_isAction; }
+            // Fallback content stands in for its owner, and may share its id
+            virtual bool IsFallback() const { return false; }
+            virtual std::string GetParentId() const { return std::string(); }
+
+            virtual std::size_t Size() const = 0;
+            virtual std::shared_ptr<BaseElement> Get(std::size_t index) const = 0;
+            virtual void Set(std::size_t index, const std::shared_ptr<BaseElement>& element) = 0;
+            virtual void Insert(std::size_t index, const std::shared_ptr<BaseElement>& element) = 0;
+            virtual void Erase(std::size_t index) = 0;
+
+            // Parses an element for these slots through the registered parsers
+            virtual std::shared_ptr<BaseElement> Parse(ParseContext& context, const Json::Value& json) const = 0;
+
+        private:
+            bool m_isAction;
+        };
+
+        // A list of owner's, read through its const accessor and fetched through the non-const one only to be edited,
+        // so that resolving a path (for "test", or the source of "copy") leaves the owner unchanged
+        template<typename T, typename Owner> class ListSlots final : public ElementSlots
+        {
+        public:
+            using List = std::vector<std::shared_ptr<T>>;
+            using Read = const List& (Owner::*)() const;
+            using Edit = List& (Owner::*)();
+            using Parser = std::shared_ptr<T> (*)(ParseContext&, const Json::Value&);
+
+            ListSlots(std::shared_ptr<Owner> owner, Read read, Edit edit, bool isAction, Parser parser) :
+                ElementSlots(isAction), m_owner(std::move(owner)), m_read(read), m_edit(edit), m_parser(parser)
+            {
+            }
+
+            std::size_t Size() const override { return ReadList().size(); }
+            std::shared_ptr<BaseElement> Get(std::size_t index) const override { return ReadList()[index]; }
+            void Set(std::size_t index, const std::shared_ptr<BaseElement>& element) override
+            {
+                EditList()[index] = std::static_pointer_cast<T>(element);
+            }
+            void Insert(std::size_t index, const std::shared_ptr<BaseElement>& element) override
+            {
+                auto& list = EditList();
+                list.insert(list.begin() + index, std::static_pointer_cast<T>(element));
+            }
+            void Erase(std::size_t index) override
+            {
+                auto& list = EditList();
+                list.erase(list.begin() + index);
+            }
+
+            std::shared_ptr<BaseElement> Parse(ParseContext& context, const Json::Value& json) const override
+            {
+                return m_parser(context, json);
+            }
+
+        private:
+            const List& ReadList() const { return (static_cast<const Owner&>(*m_owner).*m_read)(); }
+            List& EditList() { return ((*m_owner).*m_edit)(); }
+
+            // keeps the list alive for as long as an undo step may refer to it
+            std::shared_ptr<Owner> m_owner;
+            Read m_read;
+            Edit m_edit;
+            Parser m_parser;
+        };
+
+        // Read and edit are named separately, as the accessors are overloaded
+        template<typename T, typename Owner>
+        std::shared_ptr<ElementSlots> MakeListSlots(std::shared_ptr<Owner> owner,
+                                                    typename ListSlots<T, Owner>::Read read,
+                                                    typename ListSlots<T, Owner>::Edit edit,
+                                                    bool isAction,
+                                                    typename ListSlots<T, Owner>::Parser parser)
+        {
+            return std::make_shared<ListSlots<T, Owner>>(std::move(owner), read, edit, isAction, parser);
+        }
+
+        class FallbackSlot final : public ElementSlots
+        {
+        public:
+            FallbackSlot(std::shared_ptr<BaseElement> owner, bool isAction) : ElementSlots(isAction), m_owner(std::move(owner)) {}
+
+            bool IsFallback() const override { return true; }
+            std::string GetParentId() const override { return m_owner->GetId(); }
+
+            std::size_t Size() const override { return 1; }
+            std::shared_ptr<BaseElement> Get(std::size_t) const override { return m_owner->GetFallbackContent(); }
+            void Set(std::size_t, const std::shared_ptr<BaseElement>& element) override { m_owner->SetFallbackContent(element); }
+            void Insert(std::size_t, const std::shared_ptr<BaseElement>&) override { throw PatchError("can't add fallback content"); }
+            void Erase(std::size_t) override { throw PatchError("can't remove fallback content"); }
+
+            std::shared_ptr<BaseElement> Parse(ParseContext& context, const Json::Value& json) const override
+            {
+                return IsAction() ? std::static_pointer_cast<BaseElement>(ParseAction(context, json)) : ParseCardElement(context, json);
+            }
+
+        private:
+            std::shared_ptr<BaseElement> m_owner;
+        };
+
+        std::shared_ptr<ElementSlots> CardSlots(const std::shared_ptr<AdaptiveCard>& card, const std::string& key)
+        {
+            if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body))
+            {
+                return MakeListSlots<BaseCardElement, AdaptiveCard>(card, &AdaptiveCard::GetBody, &AdaptiveCard::GetBody, false, ParseCardElement);
+            }
+            if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions))
+            {
+                return MakeListSlots<BaseActionElement, AdaptiveCard>(card, &AdaptiveCard::GetActions, &AdaptiveCard::GetActions, true, ParseAction);
+            }
+            return nullptr;
+        }
+
+        // The list of elements an element keeps under key, if any
+        std::shared_ptr<ElementSlots> ChildSlots(const std::shared_ptr<BaseElement>& element, CardElementType type, const std::string& key)
+        {
+            switch (type)
+            {
+            case CardElementType::Container:
+                if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items))
+                {
+                    return MakeListSlots<BaseCardElement, Container>(
+                        std::static_pointer_cast<Container>(element), &Container::GetItems, &Container::GetItems, false, ParseCardElement);
+                }
+                break;
+            case CardElementType::Column:
+                if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items))
+                {
+                    return MakeListSlots<BaseCardElement, Column>(
+                        std::static_pointer_cast<Column>(element), &Column::GetItems, &Column::GetItems, false, ParseCardElement);
+                }
+                break;
+            case CardElementType::ColumnSet:
+                if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns))
+                {
+                    return MakeListSlots<Column, ColumnSet>(
+                        std::static_pointer_cast<ColumnSet>(element), &ColumnSet::GetColumns, &ColumnSet::GetColumns, false, ParseColumn);
+                }
+                break;
+            case CardElementType::ImageSet:
+                if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images))
+                {
+                    return MakeListSlots<Image, ImageSet>(
+                        std::static_pointer_cast<ImageSet>(element), &ImageSet::GetImages, &ImageSet::GetImages, false, ParseImage);
+                }
+                break;
+            case CardElementType::ActionSet:
+                if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions))
+                {
+                    return MakeListSlots<BaseActionElement, ActionSet>(
+                        std::static_pointer_cast<ActionSet>(element), &ActionSet::GetActions, &ActionSet::GetActions, true, ParseAction);
+                }
+                break;
+            default:
+                break;
+            }
+            return nullptr;
+        }
+
+        // Calls visit(element, isAction, isFallback, parentId) for element and everything beneath it, covering the same
+        // children as CardNode::AppendChildren
+        template<typename Visit> void WalkCard(const AdaptiveCard& card, Visit& visit);
+
+        template<typename Visit>
+        void Walk(const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId, Visit& visit)
+        {
+            if (element == nullptr)
+            {
+                return;
+            }
+
+            visit(element, isAction, isFallback, parentId);
+
+            const auto fallback = element->GetFallbackContent();
+            if (fallback != nullptr)
+            {
+                Walk(fallback, isAction, true, element->GetId(), visit);
+            }
+
+            if (isAction)
+            {
+                const auto& action = static_cast<const BaseActionElement&>(*element);
+                if (action.GetElementType() == ActionType::ShowCard)
+                {
+                    const auto card = static_cast<const ShowCardAction&>(action).GetCard();
+                    if (card != nullptr)
+                    {
+                        WalkCard(*card, visit);
+                    }
+                }
+                return;
+            }
+
+            const auto walkElements = [&visit](const auto& elements, bool areActions) {
+                for (const auto& child : elements)
+                {
+                    Walk(child, areActions, false, std::string(), visit);
+                }
+            };
+
+            switch (static_cast<const BaseCardElement&>(*element).GetElementType())
+            {
+            case CardElementType::Container:
+                walkElements(static_cast<const Container&>(*element).GetItems(), false);
+                Walk(static_cast<const Container&>(*element).GetSelectAction(), true, false, std::string(), visit);
+                break;
+            case CardElementType::Column:
+                walkElements(static_cast<const Column&>(*element).GetItems(), false);
+                Walk(static_cast<const Column&>(*element).GetSelectAction(), true, false, std::string(), visit);
+                break;
+            case CardElementType::ColumnSet:
+                walkElements(static_cast<const ColumnSet&>(*element).GetColumns(), false);
+                Walk(static_cast<const ColumnSet&>(*element).GetSelectAction(), true, false, std::string(), visit);
+                break;
+            case CardElementType::ImageSet:
+                walkElements(static_cast<const ImageSet&>(*element).GetImages(), false);
+                break;
+            case CardElementType::ActionSet:
+                walkElements(static_cast<const ActionSet&>(*element).GetActions(), true);
+                break;
+            case CardElementType::Image:
+                Walk(static_cast<const Image&>(*element).GetSelectAction(), true, false, std::string(), visit);
+                break;
+            case CardElementType::TextInput:
+                Walk(static_cast<const TextInput&>(*element).GetInlineAction(), true, false, std::string(), visit);
+                break;
+            case CardElementType::RichTextBlock:
+                for (const auto& paragraph : static_cast<const RichTextBlock&>(*element).GetParagraphs())
+                {
+                    for (const auto& inlineElement : static_cast<const Paragraph&>(*paragraph).GetInlines())
+                    {
+                        if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+                        {
+                            Walk(static_cast<const TextRun&>(*inlineElement).GetSelectAction(), true, false, std::string(), visit);
+                        }
+                    }
+                }
+                break;
+            default:
+                break;
+            }
+        }
+
+        template<typename Visit> void WalkCard(const AdaptiveCard& card, Visit& visit)
+        {
+            for (const auto& element : card.GetBody())
+            {
+                Walk(element, false, false, std::string(), visit);
+            }
+            for (const auto& action : card.GetActions())
+            {
+                Walk(action, true, false, std::string(), visit);
+            }
+            Walk(card.GetSelectAction(), true, false, std::string(), visit);
+        }
+
+        struct IndexedSubtreeEntry
+        {
+            std::shared_ptr<BaseElement> element;
+            bool isAction;
+            bool ownsId;
+        };
+
+        // element and everything beneath it, in parse order
+        std::vector<IndexedSubtreeEntry> FlattenForIndex(const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId)
+        {
+            std::vector<IndexedSubtreeEntry> entries;
+            auto visit = [&entries](const std::shared_ptr<BaseElement>& current, bool currentIsAction, bool currentIsFallback, const std::string& currentParentId) {
+                entries.push_back(IndexedSubtreeEntry{current, currentIsAction, !(currentIsFallback && current->GetId() == currentParentId)});
+            };
+            Walk(element, isAction, isFallback, parentId, visit);
+            return entries;
+        }
+
+        // Moves the index entries of previous's subtree to element's, when the two have the same shape: the same types
+        // in the same parse order, so that each new element can take its predecessor's position. Returns false
+        // otherwise, leaving the index partly updated.
+        bool ReplaceIndexedSubtree(ElementIdIndex& index,
+                                   const std::shared_ptr<BaseElement>& previous,
+                                   const std::shared_ptr<BaseElement>& element,
+                                   bool isAction,
+                                   bool isFallback,
+                                   const std::string& parentId)
+        {
+            if (previous == nullptr || element == nullptr)
+            {
+                return previous == element;
+            }
+
+            const auto previousEntries = FlattenForIndex(previous, isAction, isFallback, parentId);
+            const auto entries = FlattenForIndex(element, isAction, isFallback, parentId);
+            if (previousEntries.size() != entries.size())
+            {
+                return false;
+            }
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                if (entries[i].isAction != previousEntries[i].isAction ||
+                    entries[i].element->GetElementTypeStringRef() != previousEntries[i].element->GetElementTypeStringRef())
+                {
+                    return false;
+                }
+            }
+            for (std::size_t i = 0; i < entries.size(); ++i)
+            {
+                if (!index.Replace(previousEntries[i].element, entries[i].element, entries[i].ownsId))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        void CopyCardProperties(const AdaptiveCard& from, AdaptiveCard& to)
+        {
+            to.SetVersion(from.GetVersionRef());
+            to.SetFallbackText(from.GetFallbackTextRef());
+            to.SetBackgroundImage(from.GetBackgroundImage());
+            to.SetSpeak(from.GetSpeakRef());
+            to.SetStyle(from.GetStyle());
+            to.SetLanguage(from.GetLanguageRef());
+            to.SetVerticalContentAlignment(from.GetVerticalContentAlignment());
+            to.SetHeight(from.GetHeight());
+            to.SetSelectAction(from.GetSelectAction());
+        }
+    }
+
+    class CardPatcher::Operation
+    {
+    public:
+        Operation(CardPatcher& patcher, ParseContext& context) : m_patcher(patcher), m_context(context) {}
+
+        void Apply(const Json::Value& operation)
+        {
+            if (!operation.isObject())
+            {
+                throw PatchError("operations must be objects");
+            }
+            const std::string op = GetString(operation, "op");
+            const std::string pathString = GetString(operation, "path");
+            const std::vector<std::string> path = DecodePointer(pathString);
+
+            if (op == "add" || op == "replace")
+            {
+                Patch(op == "add" ? PatchOperation::Add : PatchOperation::Replace, path, GetMember(operation, "value"));
+            }
+            else if (op == "remove")
+            {
+                Patch(PatchOperation::Remove, path, Json::Value());
+            }
+            else if (op == "move" || op == "copy")
+            {
+                const std::vector<std::string> from = DecodePointer(GetString(operation, "from"));
+                const Json::Value value = GetValue(from);
+                if (op == "move")
+                {
+                    if (from == path)
+                    {
+                        return;
+                    }
+                    if (from.size() < path.size() && std::equal(from.begin(), from.end(), path.begin()))
+                    {
+                        throw PatchError("can't move a value into itself: " + pathString);
+                    }
+                    Patch(PatchOperation::Remove, from, Json::Value());
+                }
+                Patch(PatchOperation::Add, path, value);
+            }
+            else if (op == "test")
+            {
+                if (!JsonEquals(GetValue(path), GetMember(operation, "value")))
+                {
+                    throw PatchError("test failed at " + pathString);
+                }
+            }
+            else
+            {
+                throw PatchError("unknown operation: " + op);
+            }
+        }
+
+        // Parses the element edited by the latest operations, if any, and puts it in place
+        void Flush()
+        {
+            if (m_pending == nullptr)
+            {
+                return;
+            }
+            const auto pending = std::move(m_pending);
+            ReplaceElement(pending->target.slots, pending->target.index, ParseElement(pending->target, pending->json));
+        }
+
+    private:
+        // Where an operation's path leads
+        struct Target
+        {
+            enum class Kind
+            {
+                // the card's own properties, or the whole card
+                Card,
+                // an entry of a list of elements, addressed by the last path token
+                ListEntry,
+                // something inside an element, which is parsed again
+                ElementProperty,
+                // a fact or something inside one, addressed from the token at relativeBegin - 1
+                Fact
+            };
+
+            Kind kind = Kind::Card;
+            std::shared_ptr<ElementSlots> slots;
+            // ElementProperty: the element's position in slots
+            std::size_t index = 0;
+            std::shared_ptr<FactSet> factSet;
+            // first token of the path inside the card, element or fact
+            std::size_t relativeBegin = 0;
+            // containers, columns and column sets the target is nested in, whose styles parsing passes down
+            std::vector<std::shared_ptr<CollectionTypeElement>> collections;
+        };
+
+        static const Json::Value& GetMember(const Json::Value& operation, const char* name)
+        {
+            if (!operation.isMember(name))
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
+                                                 "JSON Patch: operation is missing '" + std::string(name) + "'");
+            }
+            return operation[name];
+        }
+
+        static std::string GetString(const Json::Value& operation, const char* name)
+        {
+            const auto& value = GetMember(operation, name);
+            if (!value.isString())
+            {
+                throw PatchError("'" + std::string(name) + "' must be a string");
+            }
+            return value.asString();
+        }
+
+        static bool IsWholeCard(const std::vector<std::string>& path)
+        {
+            return path.empty() || path[0] == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body) ||
+                   path[0] == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+        }
+
+        Json::Value GetValue(const std::vector<std::string>& path)
+        {
+            if (m_pending != nullptr)
+            {
+                if (IsPending(path))
+                {
+                    return Navigate(m_pending->json, path, m_pending->target.relativeBegin);
+                }
+                // reading something that holds the element sees it as edited
+                if (path.size() < m_pending->target.relativeBegin && std::equal(path.begin(), path.end(), m_pending->path.begin()))
+                {
+                    Flush();
+                }
+            }
+
+            const Target target = Resolve(path);
+            switch (target.kind)
+            {
+            case Target::Kind::Card:
+                return Navigate(IsWholeCard(path) ? m_patcher.m_card->SerializeToJsonValue()
+                                                  : m_patcher.m_card->SerializeCardPropertiesToJsonValue(),
+                                path,
+                                0);
+            case Target::Kind::ListEntry:
+                return target.slots->Get(ParseIndex(path.back(), target.slots->Size(), false))->SerializeToJsonValue();
+            case Target::Kind::ElementProperty:
+                return Navigate(target.slots->Get(target.index)->SerializeToJsonValue(), path, target.relativeBegin);
+            case Target::Kind::Fact:
+            default:
+                const std::size_t index = ParseIndex(path[target.relativeBegin - 1], target.factSet->GetFactCount(), false);
+                return Navigate(FactJson(target.factSet->GetFactView(index)), path, target.relativeBegin);
+            }
+        }
+
+        void Patch(PatchOperation operation, const std::vector<std::string>& path, const Json::Value& value)
+        {
+            if (m_pending != nullptr)
+            {
+                if (IsPending(path) && path.size() > m_pending->target.relativeBegin)
+                {
+                    PatchJson(m_pending->json, operation, path, m_pending->target.relativeBegin, value);
+                    return;
+                }
+                if (IsPending(path) && operation != PatchOperation::Add)
+                {
+                    // the element is replaced or removed as a whole, edits and all
+                    m_pending.reset();
+                }
+                Flush();
+            }
+
+            const Target target = Resolve(path);
+            switch (target.kind)
+            {
+            case Target::Kind::Card:
+                PatchCard(operation, path, value);
+                break;
+            case Target::Kind::ListEntry:
+                PatchListEntry(operation, target, path, value);
+                break;
+            case Target::Kind::ElementProperty:
+                PatchElement(operation, target, path, value);
+                break;
+            case Target::Kind::Fact:
+                PatchFact(operation, target, path, value);
+                break;
+            }
+        }
+
+        Target Resolve(const std::vector<std::string>& path)
+        {
+            Target target;
+            if (!ResolveInCard(m_patcher.m_card, path, 0, target))
+            {
+                target.kind = Target::Kind::Card;
+                target.relativeBegin = 0;
+            }
+            return target;
+        }
+
+        // Resolves path[position..] inside an entry of the card's body or actions, if that's where it leads
+        bool ResolveInCard(const std::shared_ptr<AdaptiveCard>& card, const std::vector<std::string>& path, std::size_t position, Target& target)
+        {
+            if (position + 1 >= path.size())
+            {
+                return false;
+            }
+            const auto slots = CardSlots(card, path[position]);
+            if (slots == nullptr)
+            {
+                return false;
+            }
+            ResolveInList(slots, path, position + 1, target);
+            return true;
+        }
+
+        void ResolveInList(const std::shared_ptr<ElementSlots>& slots, const std::vector<std::string>& path, std::size_t position, Target& target)
+        {
+            target.slots = slots;
+            if (position + 1 == path.size())
+            {
+                target.kind = Target::Kind::ListEntry;
+                return;
+            }
+            ResolveInElement(slots, ParseIndex(path[position], slots->Size(), false), path, position + 1, target);
+        }
+
+        void ResolveInElement(const std::shared_ptr<ElementSlots>& slots,
+                              std::size_t index,
+                              const std::vector<std::string>& path,
+                              std::size_t position,
+                              Target& target)
+        {
+            const auto element = slots->Get(index);
+
+            // descend into child elements, fallback content, ShowCard cards and facts as long as the path goes deeper
+            if (position + 1 < path.size())
+            {
+                const std::string& key = path[position];
+                if (!slots->IsAction())
+                {
+                    const CardElementType type = static_cast<const BaseCardElement&>(*element).GetElementType();
+                    const auto children = ChildSlots(element, type, key);
+                    if (children != nullptr)
+                    {
+                        if (type == CardElementType::Container || type == CardElementType::Column || type == CardElementType::ColumnSet)
+                        {
+                            target.collections.push_back(std::static_pointer_cast<CollectionTypeElement>(element));
+                        }
+                        ResolveInList(children, path, position + 1, target);
+                        return;
+                    }
+                    if (type == CardElementType::FactSet && key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts))
+                    {
+                        target.kind = Target::Kind::Fact;
+                        target.factSet = std::static_pointer_cast<FactSet>(element);
+                        target.relativeBegin = position + 2;
+                        return;
+                    }
+                }
+                else if (static_cast<const BaseActionElement&>(*element).GetElementType() == ActionType::ShowCard &&
+                         key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card))
+                {
+                    const auto card = static_cast<const ShowCardAction&>(*element).GetCard();
+                    if (card != nullptr && ResolveInCard(card, path, position + 1, target))
+                    {
+                        return;
+                    }
+                }
+
+                const auto fallback = element->GetFallbackContent();
+                if (key == AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Fallback) &&
+                    element->GetFallbackType() == FallbackType::Content && fallback != nullptr)
+                {
+                    ResolveInElement(std::make_shared<FallbackSlot>(element, slots->IsAction()), 0, path, position + 1, target);
+                    return;
+                }
+            }
+
+            target.kind = Target::Kind::ElementProperty;
+            target.slots = slots;
+            target.index = index;
+            target.relativeBegin = position;
+        }
+
+        void PatchCard(PatchOperation operation, const std::vector<std::string>& path, const Json::Value& value)
+        {
+            AdaptiveCard& card = *m_patcher.m_card;
+            const bool wholeCard = IsWholeCard(path);
+
+            Json::Value json;
+            if (path.empty())
+            {
+                if (operation == PatchOperation::Remove)
+                {
+                    throw PatchError("can't remove the card");
+                }
+                json = value;
+            }
+            else
+            {
+                json = wholeCard ? card.SerializeToJsonValue() : card.SerializeCardPropertiesToJsonValue();
+                PatchJson(json, operation, path, 0, value);
+            }
+
+            ParseContext cardContext(m_context.elementParserRegistration, m_context.actionParserRegistration);
+            PrepareContext(cardContext);
+            // the renderer version was checked when the card was first parsed
+            const auto parsed = AdaptiveCard::Deserialize(json, std::string(), cardContext)->GetAdaptiveCard();
+            AppendWarnings(cardContext);
+            m_patcher.m_statistics.reparsedCard = true;
+
+            auto previous = std::make_shared<AdaptiveCard>();
+            CopyCardProperties(card, *previous);
+            if (wholeCard)
+            {
+                // every id may have changed, and the parse above has validated them and resolved the targets
+                previous->GetBody().swap(card.GetBody());
+                previous->GetActions().swap(card.GetActions());
+                card.GetBody() = parsed->GetBody();
+                card.GetActions() = parsed->GetActions();
+                CopyCardProperties(*parsed, card);
+                m_patcher.m_hasIds = false;
+                m_patcher.m_reindexCard = true;
+                m_patcher.m_undo.push_back([&card, previous]() {
+                    CopyCardProperties(*previous, card);
+                    card.GetBody().swap(previous->GetBody());
+                    card.GetActions().swap(previous->GetActions());
+                });
+                return;
+            }
+
+            m_patcher.RemoveIds(card.GetSelectAction(), true, false, std::string());
+            CopyCardProperties(*parsed, card);
+            m_patcher.m_undo.push_back([&card, previous]() { CopyCardProperties(*previous, card); });
+            m_patcher.m_indexChanges.push_back(CardPatcher::IndexChange{previous->GetSelectAction(), card.GetSelectAction(), true, false, std::string()});
+            m_patcher.AddIds(card.GetSelectAction(), true, false, std::string(), true);
+        }
+
+        void PatchListEntry(PatchOperation operation, const Target& target, const std::vector<std::string>& path, const Json::Value& value)
+        {
+            const auto& slots = target.slots;
+            const std::size_t index = ParseIndex(path.back(), slots->Size(), operation == PatchOperation::Add);
+            switch (operation)
+            {
+            case PatchOperation::Add:
+                InsertElement(slots, index, ParseElement(target, value));
+                break;
+            case PatchOperation::Remove:
+                EraseElement(slots, index);
+                break;
+            case PatchOperation::Replace:
+                ReplaceElement(slots, index, ParseElement(target, value));
+                break;
+            }
+        }
+
+        // The element's json is patched here, and parsed once the operations that follow are done with it (see Flush)
+        void PatchElement(PatchOperation operation, const Target& target, const std::vector<std::string>& path, const Json::Value& value)
+        {
+            auto pending = std::make_unique<PendingElement>();
+            pending->target = target;
+            pending->path = path;
+            pending->json = target.slots->Get(target.index)->SerializeToJsonValue();
+            PatchJson(pending->json, operation, path, target.relativeBegin, value);
+            m_pending = std::move(pending);
+        }
+
+        void PatchFact(PatchOperation operation, const Target& target, const std::vector<std::string>& path, const Json::Value& value)
+        {
+            const auto factSet = target.factSet;
+            const bool isWholeFact = target.relativeBegin == path.size();
+            const bool isInsert = isWholeFact && operation == PatchOperation::Add;
+            const std::size_t index = ParseIndex(path[target.relativeBegin - 1], factSet->GetFactCount(), isInsert);
+
+            if (isInsert)
+            {
+                const auto fact = ParseFact(value);
+                factSet->InsertFact(index, fact.first, fact.second);
+                m_patcher.m_undo.push_back([factSet, index]() { factSet->RemoveFact(index); });
+            }
+            else
+            {
+                const auto view = factSet->GetFactView(index);
+                const std::string oldTitle = view.GetTitle();
+                const std::string oldValue = view.GetValue();
+
+                if (isWholeFact && operation == PatchOperation::Remove)
+                {
+                    factSet->RemoveFact(index);
+                    m_patcher.m_undo.push_back([factSet, index, oldTitle, oldValue]() { factSet->InsertFact(index, oldTitle, oldValue); });
+                }
+                else
+                {
+                    Json::Value json = isWholeFact ? value : FactJson(view);
+                    if (!isWholeFact)
+                    {
+                        PatchJson(json, operation, path, target.relativeBegin, value);
+                    }
+                    const auto fact = ParseFact(json);
+                    factSet->SetFact(index, fact.first, fact.second);
+                    m_patcher.m_undo.push_back([factSet, index, oldTitle, oldValue]() { factSet->SetFact(index, oldTitle, oldValue); });
+                }
+            }
+            ++m_patcher.m_statistics.patchedFacts;
+        }
+
+        std::shared_ptr<BaseElement> ParseElement(const Target& target, const Json::Value& json)
+        {
+            ParseUtil::ThrowIfNotJsonObject(json);
+
+            ParseContext elementContext(m_context.elementParserRegistration, m_context.actionParserRegistration);
+            PrepareContext(elementContext);
+            for (const auto& collection : target.collections)
+            {
+                elementContext.SaveContextForCollectionTypeElement(collection);
+            }
+
+            auto element = target.slots->Parse(elementContext, json);
+            // resolves the toggle targets within the element; the others are resolved against the card's ids later
+            elementContext.TakeElementIndex();
+            AppendWarnings(elementContext);
+            ++m_patcher.m_statistics.reparsedElements;
+            return element;
+        }
+
+        void InsertElement(const std::shared_ptr<ElementSlots>& slots, std::size_t index, const std::shared_ptr<BaseElement>& element)
+        {
+            slots->Insert(index, element);
+            m_patcher.m_undo.push_back([slots, index]() { slots->Erase(index); });
+            m_patcher.m_reindexCard = true;
+            m_patcher.AddIds(element, slots->IsAction(), slots->IsFallback(), slots->GetParentId(), true);
+        }
+
+        void EraseElement(const std::shared_ptr<ElementSlots>& slots, std::size_t index)
+        {
+            const auto previous = slots->Get(index);
+            m_patcher.RemoveIds(previous, slots->IsAction(), slots->IsFallback(), slots->GetParentId());
+            slots->Erase(index);
+            m_patcher.m_undo.push_back([slots, index, previous]() { slots->Insert(index, previous); });
+            m_patcher.m_reindexCard = true;
+        }
+
+        void ReplaceElement(const std::shared_ptr<ElementSlots>& slots, std::size_t index, const std::shared_ptr<BaseElement>& element)
+        {
+            const auto previous = slots->Get(index);
+            m_patcher.RemoveIds(previous, slots->IsAction(), slots->IsFallback(), slots->GetParentId());
+            slots->Set(index, element);
+            m_patcher.m_undo.push_back([slots, index, previous]() { slots->Set(index, previous); });
+            m_patcher.m_indexChanges.push_back(
+                CardPatcher::IndexChange{previous, element, slots->IsAction(), slots->IsFallback(), slots->GetParentId()});
+            m_patcher.AddIds(element, slots->IsAction(), slots->IsFallback(), slots->GetParentId(), true);
+        }
+
+        void PrepareContext(ParseContext& context) const
+        {
+            context.SetChoiceIndexThreshold(m_context.GetChoiceIndexThreshold());
+            context.SetUrlRewriter(m_context.GetUrlRewriter(), m_context.GetUrlMemoCapacity());
+            context.SetResourceCallback(m_context.GetResourceCallback());
+            context.SetDataUriImageSizing(m_context.GetDataUriImageSizing());
+            const std::string& language = m_patcher.m_card->GetLanguageRef();
+            context.SetLanguage(language.empty() ? m_context.GetLanguage() : language);
+        }
+
+        void AppendWarnings(const ParseContext& context)
+        {
+            m_context.warnings.insert(m_context.warnings.end(), context.warnings.begin(), context.warnings.end());
+        }
+
+        // Whether path leads to the pending element or into it
+        bool IsPending(const std::vector<std::string>& path) const
+        {
+            const std::size_t length = m_pending->target.relativeBegin;
+            return path.size() >= length && std::equal(path.begin(), path.begin() + length, m_pending->path.begin());
+        }
+
+        // An element whose json consecutive operations patch, so that it may pass through states that don't parse
+        struct PendingElement
+        {
+            Target target;
+            // the path of the operation that started it, of which the first target.relativeBegin tokens lead to the element
+            std::vector<std::string> path;
+            Json::Value json;
+        };
+
+        CardPatcher& m_patcher;
+        ParseContext& m_context;
+        std::unique_ptr<PendingElement> m_pending;
+    };
+
+    CardPatcher::CardPatcher(std::shared_ptr<AdaptiveCard> card) :
+        m_card(std::move(card)), m_statistics{0, 0, false}, m_hasIds(false), m_reindexCard(false)
+    {
+    }
+
+    CardPatcher::CardPatcher(std::shared_ptr<ParseResult> parseResult) :
+        m_card(parseResult->GetAdaptiveCard()), m_parseResult(std::move(parseResult)), m_statistics{0, 0, false},
+        m_hasIds(false), m_reindexCard(false)
+    {
+    }
+
+    void CardPatcher::Apply(const Json::Value& patch, ParseContext& context)
+    {
+        if (!patch.isArray())
+        {
+            throw PatchError("a patch must be an array of operations");
+        }
+        if (m_card->IsFrozen())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::FrozenObjectModification, "Frozen cards can't be modified");
+        }
+
+        m_statistics = Statistics{0, 0, false};
+        m_undo.clear();
+        m_affectedIds.clear();
+        m_indexChanges.clear();
+        m_reindexCard = false;
+        Operation applier(*this, context);
+        try
+        {
+            for (const auto& operation : patch)
+            {
+                EnsureIds();
+                applier.Apply(operation);
+            }
+            applier.Flush();
+        }
+        catch (...)
+        {
+            for (auto undo = m_undo.rbegin(); undo != m_undo.rend(); ++undo)
+            {
+                (*undo)();
+            }
+            m_undo.clear();
+            m_indexChanges.clear();
+            // the counts may be partly updated; rather than unwind them too, count again next time
+            Reset();
+            throw;
+        }
+
+        m_undo.clear();
+        ResolveTargets();
+        UpdateElementIndex();
+        if (m_parseResult != nullptr && !m_parseResult->m_contentHash.IsEmpty())
+        {
+            // rehashes only the own properties of what the patch changed
+            m_parseResult->m_contentHash = m_hashes.Get(*m_card);
+            m_hashes.Prune();
+        }
+    }
+
+    void CardPatcher::ApplyJson(const std::string& patchJson, ParseContext& context)
+    {
+        Apply(ParseUtil::GetJsonValueFromString(patchJson), context);
+    }
+
+    const CardPatcher::Statistics& CardPatcher::GetLastStatistics() const
+    {
+        return m_statistics;
+    }
+
+    void CardPatcher::Reset()
+    {
+        m_hasIds = false;
+        m_ids.clear();
+        m_targetsById.clear();
+        m_affectedIds.clear();
+    }
+
+    void CardPatcher::EnsureIds()
+    {
+        if (m_hasIds)
+        {
+            return;
+        }
+
+        Reset();
+        const auto add = [this](const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId) {
+            AddIds(element, isAction, isFallback, parentId, false);
+        };
+        // AddIds walks each subtree itself, so only the card's direct entries are passed to it
+        const auto& card = static_cast<const AdaptiveCard&>(*m_card);
+        for (const auto& element : card.GetBody())
+        {
+            add(element, false, false, std::string());
+        }
+        for (const auto& action : card.GetActions())
+        {
+            add(action, true, false, std::string());
+        }
+        add(m_card->GetSelectAction(), true, false, std::string());
+
+        // the card as it stands has its targets resolved already
+        m_affectedIds.clear();
+        m_hasIds = true;
+    }
+
+    void CardPatcher::AddIds(const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId, bool validate)
+    {
+        auto visit = [this, validate](const std::shared_ptr<BaseElement>& current, bool currentIsAction, bool currentIsFallback, const std::string& currentParentId) {
+            const std::string id = current->GetId();
+            if (!id.empty() && !(currentIsFallback && id == currentParentId))
+            {
+                IdEntry& entry = m_ids[id];
+                if (++entry.count > 1 && validate)
+                {
+                    throw AdaptiveCardParseException(ErrorStatusCode::IdCollision, "Collision detected for id '" + id + "'");
+                }
+                if (entry.count == 1 && !currentIsAction)
+                {
+                    entry.element = std::static_pointer_cast<BaseCardElement>(current);
+                }
+                m_affectedIds.insert(id);
+            }
+
+            if (currentIsAction && static_cast<const BaseActionElement&>(*current).GetElementType() == ActionType::ToggleVisibility)
+            {
+                for (const auto& target : static_cast<const ToggleVisibilityAction&>(*current).GetTargetElements())
+                {
+                    m_targetsById[target->GetElementIdRef()].push_back(target);
+                    m_affectedIds.insert(target->GetElementIdRef());
+                }
+            }
+        };
+        Walk(element, isAction, isFallback, parentId, visit);
+    }
+
+    void CardPatcher::RemoveIds(const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId)
+    {
+        // targets in the removed subtree stay listed until they expire
+        auto visit = [this](const std::shared_ptr<BaseElement>& current, bool, bool currentIsFallback, const std::string& currentParentId) {
+            const std::string id = current->GetId();
+            if (id.empty() || (currentIsFallback && id == currentParentId))
+            {
+                return;
+            }
+
+            const auto entry = m_ids.find(id);
+            if (entry != m_ids.end())
+            {
+                if (--entry->second.count == 0)
+                {
+                    m_ids.erase(entry);
+                }
+                else if (entry->second.element.lock() == current)
+                {
+                    entry->second.element.reset();
+                }
+            }
+            m_affectedIds.insert(id);
+        };
+        Walk(element, isAction, isFallback, parentId, visit);
+    }
+
+    void CardPatcher::UpdateElementIndex()
+    {
+        if (m_parseResult == nullptr || !m_parseResult->HasElementIndex())
+        {
+            m_indexChanges.clear();
+            return;
+        }
+
+        ElementIdIndex& index = m_parseResult->m_elementIndex;
+        bool reindex = m_reindexCard;
+        for (const auto& change : m_indexChanges)
+        {
+            if (reindex)
+            {
+                break;
+            }
+            reindex = !ReplaceIndexedSubtree(index, change.previous, change.element, change.isAction, change.isFallback, change.parentId);
+        }
+        m_indexChanges.clear();
+
+        if (reindex)
+        {
+            // positions are numbered as parsing numbers them, which the patched card's elements can't be slotted into
+            index.Clear();
+            std::size_t ordinal = 0;
+            auto visit = [&index, &ordinal](const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId) {
+                const bool ownsId = !(isFallback && element->GetId() == parentId);
+                if (isAction)
+                {
+                    index.Add(std::static_pointer_cast<BaseActionElement>(element), ordinal++, ownsId);
+                }
+                else
+                {
+                    index.Add(std::static_pointer_cast<BaseCardElement>(element), ordinal++, ownsId);
+                }
+            };
+            WalkCard(*m_card, visit);
+        }
+    }
+
+    void CardPatcher::ResolveTargets()
+    {
+        for (const auto& id : m_affectedIds)
+        {
+            const auto targets = m_targetsById.find(id);
+            if (targets == m_targetsById.end())
+            {
+                continue;
+            }
+
+            const auto entry = m_ids.find(id);
+            const auto element = (entry == m_ids.end()) ? nullptr : entry->second.element.lock();
+            auto& list = targets->second;
+            list.erase(std::remove_if(list.begin(), list.end(), [](const std::weak_ptr<ToggleVisibilityTarget>& target) {
+                           return target.expired();
+                       }),
+                       list.end());
+            for (const auto& target : list)
+            {
+                target.lock()->SetElement(element);
+            }
+            if (list.empty())
+            {
+                m_targetsById.erase(targets);
+            }
+        }
+        m_affectedIds.clear();
+    }
+}
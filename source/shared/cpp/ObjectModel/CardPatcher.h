@@ -0,0 +1,109 @@
+#pragma once
+
+#include "pch.h"
+#include "BaseElement.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseCardElement;
+    class BaseElement;
+    class ParseContext;
+    class ParseResult;
+    class ToggleVisibilityTarget;
+
+    // Applies RFC 6902 JSON Patches to a parsed card in place, without parsing the whole card again. Each operation is
+    // resolved to the innermost element whose json it touches: that element alone is serialized, patched and parsed again
+    // through the registered parsers, and put in the place of the old one. Consecutive operations on one element and what
+    // it contains patch its json together, which is parsed once they're done, so a patch may pass through states that
+    // don't parse (say, an element's type changed ahead of the property the new type requires). Adding, removing or
+    // replacing an element in a list (a card's body or actions, a container's items and so on) parses just the new
+    // element, and a fact of a FactSet is edited without parsing the set at all. Only a change to the card's own
+    // properties parses the card itself again, without its body and actions unless the operation replaces those.
+    //
+    // Ids are re-validated only for the elements removed and added: the patcher keeps a count of the ids in the card
+    // (built on first use) and throws ErrorStatusCode::IdCollision as parsing would. Toggle visibility targets of the
+    // affected ids are resolved again. A patch is applied entirely or, if any operation fails, not at all.
+    //
+    // A patcher made from a ParseResult keeps the result's content hash and element index current, hashing again only the
+    // own properties of what each patch changed. An element parsed again takes its predecessor's place in the index when
+    // the two subtrees have the same shape, and any other change to the card's elements indexes the card again (a walk of
+    // the card, without parsing). A patcher assumes that it is the only writer to the card's elements; after changing the
+    // card by other means, call Reset() before the next patch. Operations that only read ("test", and the source of "copy"
+    // and "move") read through const access.
+    class CardPatcher
+    {
+    public:
+        struct Statistics
+        {
+            // Element subtrees parsed from patched json
+            std::size_t reparsedElements;
+            // Facts edited in place
+            std::size_t patchedFacts;
+            // Whether the card's own properties (or the whole card) were parsed again
+            bool reparsedCard;
+        };
+
+        explicit CardPatcher(std::shared_ptr<AdaptiveCard> card);
+        explicit CardPatcher(std::shared_ptr<ParseResult> parseResult);
+
+        // patch is an array of operations. context supplies the parser registrations, choice index threshold, url
+        // rewriter, resource callback and language, and receives any warnings; it isn't otherwise used, so one context
+        // may serve many patches.
+        void Apply(const Json::Value& patch, ParseContext& context);
+        // patchJson is the patch as text; named apart from Apply, which a string literal would convert to either form of
+        void ApplyJson(const std::string& patchJson, ParseContext& context);
+
+        const Statistics& GetLastStatistics() const;
+
+        // Forgets the id counts, which are rebuilt from the card on the next patch
+        void Reset();
+
+    private:
+        // One operation of a patch, resolved against the card and applied (defined in the .cpp)
+        class Operation;
+
+        // An element put in place of previous (either may be null, for an insertion or a removal)
+        struct IndexChange
+        {
+            std::shared_ptr<BaseElement> previous;
+            std::shared_ptr<BaseElement> element;
+            bool isAction;
+            bool isFallback;
+            std::string parentId;
+        };
+
+        struct IdEntry
+        {
+            std::size_t count;
+            // the card element carrying the id, for toggle targets; null for actions
+            std::weak_ptr<BaseCardElement> element;
+        };
+
+        void EnsureIds();
+        // Counts the ids of element and everything beneath it, throwing on a collision if validate is set. parentId is
+        // the id of the element that fallback content stands in for, which the content may share.
+        void AddIds(const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId, bool validate);
+        void RemoveIds(const std::shared_ptr<BaseElement>& element, bool isAction, bool isFallback, const std::string& parentId);
+        void ResolveTargets();
+        void UpdateElementIndex();
+
+        std::shared_ptr<AdaptiveCard> m_card;
+        // null when the patcher was made from a card alone
+        std::shared_ptr<ParseResult> m_parseResult;
+        Statistics m_statistics;
+        // the hashes composed for the parse result's content hash, kept from one patch to the next
+        StructuralHashCache m_hashes;
+
+        bool m_hasIds;
+        std::unordered_map<std::string, IdEntry> m_ids;
+        std::unordered_map<std::string, std::vector<std::weak_ptr<ToggleVisibilityTarget>>> m_targetsById;
+        // ids whose elements were added or removed by the patch in progress, and ids new targets refer to
+        std::unordered_set<std::string> m_affectedIds;
+        // restores what the patch in progress has changed, in reverse order
+        std::vector<std::function<void()>> m_undo;
+        // the patch in progress's changes to the card's elements, applied to the element index once it succeeds
+        std::vector<IndexChange> m_indexChanges;
+        bool m_reindexCard;
+    };
+}
@@ -0,0 +1,463 @@
+#include "pch.h"
+#include "CardQuery.h"
+#include "CardTraversal.h"
+#include "CollectionTypeElement.h"
+#include "Image.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        constexpr std::size_t c_maxCompounds = 64;
+
+        const std::string c_cardType = "AdaptiveCard";
+
+        bool IsNameCharacter(char c)
+        {
+            return std::isalnum(static_cast<unsigned char>(c)) || c == '.' || c == '_' || c == '-';
+        }
+
+        class SelectorReader
+        {
+        public:
+            explicit SelectorReader(const std::string& selector) : m_selector(selector), m_position(0) {}
+
+            bool AtEnd() const { return m_position == m_selector.size(); }
+            char Peek() const { return AtEnd() ? '\0' : m_selector[m_position]; }
+            void Advance() { ++m_position; }
+
+            // Returns true if any whitespace was skipped
+            bool SkipWhitespace()
+            {
+                const std::size_t start = m_position;
+                while (!AtEnd() && std::isspace(static_cast<unsigned char>(Peek())))
+                {
+                    Advance();
+                }
+                return m_position != start;
+            }
+
+            std::string ReadName()
+            {
+                const std::size_t start = m_position;
+                while (!AtEnd() && IsNameCharacter(Peek()))
+                {
+                    Advance();
+                }
+                return m_selector.substr(start, m_position - start);
+            }
+
+            std::string ReadValue()
+            {
+                const char quote = Peek();
+                if (quote == '"' || quote == '\'')
+                {
+                    Advance();
+                    const std::size_t start = m_position;
+                    while (!AtEnd() && Peek() != quote)
+                    {
+                        Advance();
+                    }
+                    if (AtEnd())
+                    {
+                        Fail("unterminated string");
+                    }
+                    Advance();
+                    return m_selector.substr(start, m_position - start - 1);
+                }
+
+                const std::size_t start = m_position;
+                while (!AtEnd() && Peek() != ']' && !std::isspace(static_cast<unsigned char>(Peek())))
+                {
+                    Advance();
+                }
+                if (m_position == start)
+                {
+                    Fail("expected a value");
+                }
+                return m_selector.substr(start, m_position - start);
+            }
+
+            void Expect(char c)
+            {
+                if (Peek() != c)
+                {
+                    Fail(std::string("expected '") + c + "'");
+                }
+                Advance();
+            }
+
+            void Fail(const std::string& message) const
+            {
+                throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue,
+                                                 "Invalid selector '" + m_selector + "' at position " +
+                                                     std::to_string(m_position) + ": " + message);
+            }
+
+        private:
+            const std::string& m_selector;
+            std::size_t m_position;
+        };
+
+        bool EqualsIgnoringCase(const std::string& first, const std::string& second)
+        {
+            return first.size() == second.size() &&
+                std::equal(first.begin(), first.end(), second.begin(), [](char firstChar, char secondChar) {
+                       return std::tolower(static_cast<unsigned char>(firstChar)) == std::tolower(static_cast<unsigned char>(secondChar));
+                   });
+        }
+
+        // Reads the properties that can be answered without serializing the element. Returns false for the others.
+        bool ReadDirectProperty(const CardNode& node, const std::string& property, bool& isPresent, std::string& value)
+        {
+            if (property == "id")
+            {
+                // GetId is virtual so that custom element wrappers report their own id
+                value = (node.GetKind() == CardNodeKind::Card) ? std::string() : node.GetElement()->GetId();
+                isPresent = !value.empty();
+                return true;
+            }
+
+            if (property == "isVisible")
+            {
+                // only card elements have the property, and it's only serialized when false
+                isPresent = (node.GetKind() == CardNodeKind::CardElement) && !node.GetCardElement()->GetIsVisible();
+                value = "false";
+                return true;
+            }
+
+            if (property == "selectAction")
+            {
+                if (node.GetKind() == CardNodeKind::Card)
+                {
+                    isPresent = node.GetCard()->GetSelectAction() != nullptr;
+                    return true;
+                }
+
+                switch (node.GetCardElementType())
+                {
+                case CardElementType::Column:
+                case CardElementType::ColumnSet:
+                case CardElementType::Container:
+                    isPresent = static_cast<const CollectionTypeElement*>(node.GetCardElement())->GetSelectAction() != nullptr;
+                    return true;
+                case CardElementType::Image:
+                    isPresent = static_cast<const Image*>(node.GetCardElement())->GetSelectAction() != nullptr;
+                    return true;
+                default:
+                    break;
+                }
+            }
+
+            return false;
+        }
+    }
+
+    CardQuery CardQuery::Compile(const std::string& selector)
+    {
+        CardQuery query;
+        query.m_selector = selector;
+
+        SelectorReader reader(query.m_selector);
+        reader.SkipWhitespace();
+        while (true)
+        {
+            // one selector: compounds separated by combinators
+            bool isFirst = true;
+            while (true)
+            {
+                Compound compound{};
+                bool isEmpty = true;
+
+                if (reader.Peek() == '*')
+                {
+                    reader.Advance();
+                    isEmpty = false;
+                }
+                else if (IsNameCharacter(reader.Peek()))
+                {
+                    compound.type = reader.ReadName();
+                    if (reader.Peek() == '*')
+                    {
+                        reader.Advance();
+                        compound.typeIsPrefix = true;
+                    }
+                    isEmpty = false;
+                }
+
+                while (reader.Peek() == '#' || reader.Peek() == '[')
+                {
+                    if (reader.Peek() == '#')
+                    {
+                        reader.Advance();
+                        compound.id = reader.ReadName();
+                        if (compound.id.empty())
+                        {
+                            reader.Fail("expected an id");
+                        }
+                    }
+                    else
+                    {
+                        reader.Advance();
+                        reader.SkipWhitespace();
+
+                        Predicate predicate{};
+                        predicate.property = reader.ReadName();
+                        if (predicate.property.empty())
+                        {
+                            reader.Fail("expected a property name");
+                        }
+
+                        reader.SkipWhitespace();
+                        if (reader.Peek() == '=')
+                        {
+                            reader.Advance();
+                            reader.SkipWhitespace();
+                            predicate.value = reader.ReadValue();
+                            predicate.hasValue = true;
+                            reader.SkipWhitespace();
+                        }
+                        reader.Expect(']');
+                        compound.predicates.push_back(std::move(predicate));
+                    }
+                    isEmpty = false;
+                }
+
+                if (isEmpty)
+                {
+                    reader.Fail("expected a type, id or property");
+                }
+
+                compound.isFirst = isFirst;
+                isFirst = false;
+                query.m_compounds.push_back(std::move(compound));
+
+                const bool sawWhitespace = reader.SkipWhitespace();
+                if (reader.AtEnd() || reader.Peek() == ',')
+                {
+                    break;
+                }
+
+                if (reader.Peek() == '>')
+                {
+                    reader.Advance();
+                    reader.SkipWhitespace();
+                    query.m_compounds.back().nextIsChild = true;
+                }
+                else if (!sawWhitespace)
+                {
+                    reader.Fail("unexpected character");
+                }
+            }
+
+            query.m_compounds.back().isLast = true;
+            if (reader.AtEnd())
+            {
+                break;
+            }
+
+            reader.Advance();
+            reader.SkipWhitespace();
+        }
+
+        if (query.m_compounds.size() > c_maxCompounds)
+        {
+            reader.Fail("selectors may have at most " + std::to_string(c_maxCompounds) + " compound parts");
+        }
+
+        for (std::size_t i = 0; i < query.m_compounds.size(); ++i)
+        {
+            const Compound& compound = query.m_compounds[i];
+            const std::uint64_t bit = std::uint64_t{1} << i;
+            if (compound.isLast)
+            {
+                query.m_lastCompounds |= bit;
+            }
+            else if (compound.nextIsChild)
+            {
+                query.m_childCompounds |= bit;
+            }
+            else
+            {
+                query.m_descendantCompounds |= bit;
+            }
+        }
+
+        return query;
+    }
+
+    bool CardQuery::MatchesType(const Compound& compound, const std::string& type)
+    {
+        if (compound.typeIsPrefix)
+        {
+            return type.compare(0, compound.type.size(), compound.type) == 0;
+        }
+        return compound.type.empty() || compound.type == type;
+    }
+
+    bool CardQuery::Matches(const Compound& compound, const CardNode& node, Json::Value& serialized, bool& isSerialized)
+    {
+        const bool isCard = node.GetKind() == CardNodeKind::Card;
+        if (!MatchesType(compound, isCard ? c_cardType : node.GetElement()->GetElementTypeStringRef()))
+        {
+            return false;
+        }
+
+        if (!compound.id.empty() && (isCard || compound.id != node.GetElement()->GetId()))
+        {
+            return false;
+        }
+
+        for (const auto& predicate : compound.predicates)
+        {
+            bool isPresent = false;
+            std::string value;
+            if (!ReadDirectProperty(node, predicate.property, isPresent, value))
+            {
+                if (!isSerialized)
+                {
+                    serialized = isCard ? node.GetCard()->SerializeToJsonValue() : node.GetElement()->SerializeToJsonValue();
+                    isSerialized = true;
+                }
+
+                const Json::Value& property = serialized[predicate.property];
+                isPresent = !property.isNull();
+                if (isPresent && predicate.hasValue)
+                {
+                    // objects and arrays have no value to compare against
+                    if (property.isObject() || property.isArray())
+                    {
+                        return false;
+                    }
+                    value = property.asString();
+                }
+            }
+
+            if (!isPresent || (predicate.hasValue && !EqualsIgnoringCase(value, predicate.value)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool CardQuery::IsIndexable() const
+    {
+        return std::all_of(m_compounds.begin(), m_compounds.end(), [](const Compound& compound) {
+            return compound.isFirst && compound.isLast;
+        });
+    }
+
+    std::vector<BaseElement*> CardQuery::Select(const CardNode& root) const
+    {
+        std::vector<BaseElement*> matches;
+
+        // states[depth] is what the node last visited at depth - 1, i.e. the current node's parent, passed on
+        std::vector<MatchState> states{MatchState{0, 0}};
+        for (const CardNode& node : CardRange<PreOrderCardIterator>(root))
+        {
+            const unsigned int depth = node.GetDepth();
+            const MatchState inherited = states[depth];
+            const std::uint64_t mayMatch = inherited.descendantsMay | inherited.childrenMay;
+
+            std::uint64_t matched = 0;
+            Json::Value serialized;
+            bool isSerialized = false;
+            for (std::size_t i = 0; i < m_compounds.size(); ++i)
+            {
+                const Compound& compound = m_compounds[i];
+                const std::uint64_t bit = std::uint64_t{1} << i;
+                if ((compound.isFirst || (mayMatch & (bit >> 1))) && Matches(compound, node, serialized, isSerialized))
+                {
+                    matched |= bit;
+                }
+            }
+
+            if ((matched & m_lastCompounds) && node.GetKind() != CardNodeKind::Card)
+            {
+                matches.push_back(node.GetElement());
+            }
+
+            if (states.size() < depth + 2)
+            {
+                states.resize(depth + 2);
+            }
+            states[depth + 1] = MatchState{inherited.descendantsMay | (matched & m_descendantCompounds), matched & m_childCompounds};
+        }
+
+        return matches;
+    }
+
+    std::vector<BaseElement*> CardQuery::Select(AdaptiveCard& card) const
+    {
+        return Select(CardNode(card, 0));
+    }
+
+    std::vector<BaseElement*> CardQuery::Select(BaseCardElement& root) const
+    {
+        return Select(CardNode(root, 0, false));
+    }
+
+    std::vector<BaseElement*> CardQuery::Select(BaseActionElement& root) const
+    {
+        return Select(CardNode(root, 0, false));
+    }
+
+    std::vector<BaseElement*> CardQuery::Select(const ParseResult& parseResult) const
+    {
+        const auto& card = parseResult.GetAdaptiveCard();
+        if (card == nullptr)
+        {
+            return {};
+        }
+
+        if (!parseResult.HasElementIndex() || !IsIndexable())
+        {
+            return Select(*card);
+        }
+
+        // gather the lists of every type that some selector accepts, then restore parse order across them
+        std::vector<const IndexedElement*> candidates;
+        for (const auto& elementsOfType : parseResult.GetElementIndex().GetElementsByType())
+        {
+            if (std::any_of(m_compounds.begin(), m_compounds.end(), [&elementsOfType](const Compound& compound) {
+                    return MatchesType(compound, elementsOfType.first);
+                }))
+            {
+                for (const auto& indexedElement : elementsOfType.second)
+                {
+                    candidates.push_back(&indexedElement);
+                }
+            }
+        }
+        std::sort(candidates.begin(), candidates.end(), [](const IndexedElement* first, const IndexedElement* second) {
+            return first->ordinal < second->ordinal;
+        });
+
+        std::vector<BaseElement*> matches;
+        for (const IndexedElement* candidate : candidates)
+        {
+            const auto element = candidate->element.lock();
+            if (element == nullptr)
+            {
+                continue;
+            }
+
+            const CardNode node = candidate->isAction ? CardNode(static_cast<BaseActionElement&>(*element), 0, false) :
+                                                        CardNode(static_cast<BaseCardElement&>(*element), 0, false);
+            Json::Value serialized;
+            bool isSerialized = false;
+            if (std::any_of(m_compounds.begin(), m_compounds.end(), [&](const Compound& compound) {
+                    return Matches(compound, node, serialized, isSerialized);
+                }))
+            {
+                matches.push_back(element.get());
+            }
+        }
+
+        return matches;
+    }
+}
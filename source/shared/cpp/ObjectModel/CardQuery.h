@@ -0,0 +1,91 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseElement;
+    class BaseCardElement;
+    class BaseActionElement;
+    class CardNode;
+    class ParseResult;
+
+    // A compiled selector over the card graph (see CardTraversal.h). The syntax is a subset of CSS selectors:
+    //
+    //   Image                  elements or actions of a type; "Input.*" matches every type starting with "Input."
+    //                          and "*" matches any type. "AdaptiveCard" matches a ShowCard action's card.
+    //   #name                  the element or action with id "name"
+    //   [selectAction]         elements that have a property, i.e. that would serialize it
+    //   [style=emphasis]       elements whose property has a value, compared ignoring case as enum values are when
+    //                          parsed; values may be quoted with ' or "
+    //   Container Input.*      descendant combinator
+    //   ColumnSet > Column     child combinator
+    //   TextBlock, Image       either selector
+    //
+    // Type, id and predicates combine as in "Image#logo[selectAction]". Fallback content is part of the graph and is
+    // matched like any other element. Predicates on id, isVisible and selectAction are read directly; other properties
+    // are read from the element's serialized form.
+    //
+    // A query is compiled once and can then be run any number of times. Each run is a single pre-order traversal, and
+    // matches are returned in that order. Results are non-owning handles that remain valid while the card does.
+    class CardQuery
+    {
+    public:
+        // Throws AdaptiveCardParseException with ErrorStatusCode::InvalidPropertyValue if the selector is malformed
+        static CardQuery Compile(const std::string& selector);
+
+        // Matches within the whole card, or within the subtree rooted at (and including) the given element or action
+        std::vector<BaseElement*> Select(AdaptiveCard& card) const;
+        std::vector<BaseElement*> Select(BaseCardElement& root) const;
+        std::vector<BaseElement*> Select(BaseActionElement& root) const;
+
+        // As Select(*parseResult.GetAdaptiveCard()), except that selectors without combinators are answered from the
+        // per-type lists recorded while parsing, without a traversal. Those lists reflect the card as parsed, so use
+        // the card overload once the card has been modified.
+        std::vector<BaseElement*> Select(const ParseResult& parseResult) const;
+
+        const std::string& GetSelector() const { return m_selector; }
+
+    private:
+        struct Predicate
+        {
+            std::string property;
+            std::string value;
+            bool hasValue;
+        };
+
+        // One compound selector ("Image#logo[selectAction]") and how it relates to the next one in its selector
+        struct Compound
+        {
+            std::string type;
+            bool typeIsPrefix;
+            std::string id;
+            std::vector<Predicate> predicates;
+            bool isFirst;
+            bool isLast;
+            bool nextIsChild;
+        };
+
+        // The state a node passes on to its children: bit i is set when compounds up to i of a selector have matched
+        // along the path to the node and compound i + 1 may match any descendant, or only a child, respectively.
+        struct MatchState
+        {
+            std::uint64_t descendantsMay;
+            std::uint64_t childrenMay;
+        };
+
+        CardQuery() = default;
+
+        static bool MatchesType(const Compound& compound, const std::string& type);
+        static bool Matches(const Compound& compound, const CardNode& node, Json::Value& serialized, bool& isSerialized);
+        bool IsIndexable() const;
+        std::vector<BaseElement*> Select(const CardNode& root) const;
+
+        std::string m_selector;
+        std::vector<Compound> m_compounds;
+        std::uint64_t m_lastCompounds = 0;
+        std::uint64_t m_descendantCompounds = 0;
+        std::uint64_t m_childCompounds = 0;
+    };
+}
@@ -0,0 +1,192 @@
+#include "pch.h"
+#include "CardState.h"
+#include "ChoiceSetInput.h"
+#include "DateInput.h"
+#include "NumberInput.h"
+#include "ParseResult.h"
+#include "SharedAdaptiveCard.h"
+#include "TextInput.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "ToggleVisibilityAction.h"
+#include "ToggleVisibilityTarget.h"
+
+namespace AdaptiveSharedNamespace
+{
+    VisibleElementIterator::VisibleElementIterator(const CardNode& root, const CardState& state) :
+        m_nodes(root), m_state(&state)
+    {
+        SkipHidden();
+    }
+
+    VisibleElementIterator& VisibleElementIterator::operator++()
+    {
+        ++m_nodes;
+        SkipHidden();
+        return *this;
+    }
+
+    void VisibleElementIterator::SkipHidden()
+    {
+        while (m_nodes != PreOrderCardIterator())
+        {
+            const CardNode& node = *m_nodes;
+            if (node.GetKind() == CardNodeKind::CardElement && !node.IsFallback() && m_state->IsVisible(*node.GetCardElement()))
+            {
+                return;
+            }
+
+            // the root card is passed through; anything else that isn't shown hides its subtree
+            if (node.GetKind() != CardNodeKind::Card || node.GetDepth() != 0)
+            {
+                m_nodes.SkipChildren();
+            }
+            ++m_nodes;
+        }
+    }
+
+    CardState::CardState(std::shared_ptr<const ParseResult> parseResult) :
+        m_parseResult(std::move(parseResult)), m_card(m_parseResult->GetAdaptiveCard())
+    {
+    }
+
+    CardState::CardState(std::shared_ptr<AdaptiveCard> card) : m_card(std::move(card)) {}
+
+    bool CardState::IsVisible(const BaseCardElement& element) const
+    {
+        const auto visibility = m_visibility.find(&element);
+        return (visibility == m_visibility.end()) ? element.GetIsVisible() : visibility->second;
+    }
+
+    void CardState::SetIsVisible(const BaseCardElement& element, bool isVisible)
+    {
+        if (isVisible == element.GetIsVisible())
+        {
+            m_visibility.erase(&element);
+        }
+        else
+        {
+            m_visibility[&element] = isVisible;
+        }
+    }
+
+    bool CardState::IsVisible(const std::string& id) const
+    {
+        const auto element = FindElement(id);
+        return element != nullptr && IsVisible(*element);
+    }
+
+    bool CardState::SetIsVisible(const std::string& id, bool isVisible)
+    {
+        const auto element = FindElement(id);
+        if (element == nullptr)
+        {
+            return false;
+        }
+        SetIsVisible(*element, isVisible);
+        return true;
+    }
+
+    void CardState::ApplyToggle(const ToggleVisibilityAction& action)
+    {
+        for (const auto& target : action.GetTargetElements())
+        {
+            // targets are resolved when the card is parsed; look up the others (e.g. of built cards) by id
+            const auto resolved = target->GetElement();
+            const BaseCardElement* element = (resolved != nullptr) ? resolved.get() : FindElement(target->GetElementIdRef());
+            if (element == nullptr)
+            {
+                continue;
+            }
+
+            switch (target->GetIsVisible())
+            {
+            case IsVisibleTrue:
+                SetIsVisible(*element, true);
+                break;
+            case IsVisibleFalse:
+                SetIsVisible(*element, false);
+                break;
+            case IsVisibleToggle:
+                SetIsVisible(*element, !IsVisible(*element));
+                break;
+            }
+        }
+    }
+
+    std::string CardState::GetInputValue(const BaseInputElement& input) const
+    {
+        const auto value = FindInputValue(input.GetIdRef());
+        if (value != nullptr)
+        {
+            return *value;
+        }
+
+        switch (input.GetElementType())
+        {
+        case CardElementType::ChoiceSetInput:
+            return static_cast<const ChoiceSetInput&>(input).GetValueRef();
+        case CardElementType::DateInput:
+            return static_cast<const DateInput&>(input).GetValueRef();
+        case CardElementType::NumberInput:
+        {
+            // as when serialized, 0 stands for no value
+            const int number = static_cast<const NumberInput&>(input).GetValue();
+            return (number == 0) ? std::string() : std::to_string(number);
+        }
+        case CardElementType::TextInput:
+            return static_cast<const TextInput&>(input).GetValueRef();
+        case CardElementType::TimeInput:
+            return static_cast<const TimeInput&>(input).GetValueRef();
+        case CardElementType::ToggleInput:
+            return static_cast<const ToggleInput&>(input).GetValueRef();
+        default:
+            return std::string();
+        }
+    }
+
+    const std::string* CardState::FindInputValue(const std::string& id) const
+    {
+        const auto value = m_inputValues.find(id);
+        return (value == m_inputValues.end()) ? nullptr : &value->second;
+    }
+
+    void CardState::SetInputValue(const BaseInputElement& input, const std::string& value)
+    {
+        SetInputValue(input.GetIdRef(), value);
+    }
+
+    void CardState::SetInputValue(const std::string& id, const std::string& value) { m_inputValues[id] = value; }
+
+    void CardState::ClearInputValue(const std::string& id) { m_inputValues.erase(id); }
+
+    void CardState::Clear()
+    {
+        m_visibility.clear();
+        m_inputValues.clear();
+    }
+
+    VisibleElementRange CardState::VisibleElements() const { return VisibleElementRange(CardNode(*m_card, 0), *this); }
+
+    BaseCardElement* CardState::FindElement(const std::string& id) const
+    {
+        if (id.empty())
+        {
+            return nullptr;
+        }
+        if (m_parseResult != nullptr && m_parseResult->HasElementIndex())
+        {
+            return m_parseResult->GetElementIndex().FindCardElement(id).get();
+        }
+
+        // pre-order meets an element ahead of fallback content sharing its id
+        for (const CardNode& node : PreOrder(*m_card))
+        {
+            if (node.GetKind() == CardNodeKind::CardElement && node.GetElement()->GetIdRef() == id)
+            {
+                return node.GetCardElement();
+            }
+        }
+        return nullptr;
+    }
+}
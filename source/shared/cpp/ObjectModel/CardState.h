@@ -0,0 +1,111 @@
+#pragma once
+
+#include "pch.h"
+#include "CardTraversal.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseCardElement;
+    class BaseInputElement;
+    class CardState;
+    class ParseResult;
+    class ToggleVisibilityAction;
+
+    // Iterates over the card elements a renderer would show (see CardState::VisibleElements): pre-order over the card's
+    // body, skipping elements hidden in the state together with everything beneath them. Fallback content and actions
+    // (including the cards of ShowCard actions) aren't part of it.
+    class VisibleElementIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = CardNode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const CardNode*;
+        using reference = const CardNode&;
+
+        VisibleElementIterator() : m_state(nullptr) {}
+        VisibleElementIterator(const CardNode& root, const CardState& state);
+
+        reference operator*() const { return *m_nodes; }
+        pointer operator->() const { return &*m_nodes; }
+        VisibleElementIterator& operator++();
+
+        bool operator==(const VisibleElementIterator& other) const { return m_nodes == other.m_nodes; }
+        bool operator!=(const VisibleElementIterator& other) const { return !(*this == other); }
+
+    private:
+        // Advances m_nodes from its current node to the next visible card element
+        void SkipHidden();
+
+        PreOrderCardIterator m_nodes;
+        const CardState* m_state;
+    };
+
+    class VisibleElementRange
+    {
+    public:
+        VisibleElementRange(const CardNode& root, const CardState& state) : m_root(root), m_state(state) {}
+
+        VisibleElementIterator begin() const { return VisibleElementIterator(m_root, m_state); }
+        VisibleElementIterator end() const { return VisibleElementIterator(); }
+
+    private:
+        CardNode m_root;
+        const CardState& m_state;
+    };
+
+    // Runtime state of a card kept apart from the card: which elements are visible and the current values of its
+    // inputs. The card is only read, so one parsed (and typically frozen) card can be shared by any number of sessions,
+    // each with its own state. A state holds just what differs from the card: visibility overrides keyed by element,
+    // and input values keyed by input id, so a fresh state is empty and copying one copies only those.
+    //
+    // Elements are addressed by handle (a reference to the element in the card) or by id. Ids are looked up in the
+    // ParseResult's element index when the state was made from one, and by walking the card otherwise.
+    class CardState
+    {
+    public:
+        explicit CardState(std::shared_ptr<const ParseResult> parseResult);
+        explicit CardState(std::shared_ptr<AdaptiveCard> card);
+
+        const std::shared_ptr<AdaptiveCard>& GetCard() const { return m_card; }
+
+        // Visibility in this state, which is the element's own isVisible unless it has been set here
+        bool IsVisible(const BaseCardElement& element) const;
+        void SetIsVisible(const BaseCardElement& element, bool isVisible);
+        // By id: both return false if the card has no card element with the id (SetIsVisible then changes nothing)
+        bool IsVisible(const std::string& id) const;
+        bool SetIsVisible(const std::string& id, bool isVisible);
+
+        // Applies the action's targets to this state as a renderer would, in O(targets): each target's element is
+        // shown, hidden or toggled. Targets that don't refer to an element of the card are skipped.
+        void ApplyToggle(const ToggleVisibilityAction& action);
+
+        // The input's value in this state, which is the input's own value (as it would be submitted) unless one has been
+        // set here. Inputs are keyed by id, which every input has.
+        std::string GetInputValue(const BaseInputElement& input) const;
+        // Null if no value has been set for the id
+        const std::string* FindInputValue(const std::string& id) const;
+        void SetInputValue(const BaseInputElement& input, const std::string& value);
+        void SetInputValue(const std::string& id, const std::string& value);
+        void ClearInputValue(const std::string& id);
+        // The values set in this state, by input id
+        const std::unordered_map<std::string, std::string>& GetInputValues() const { return m_inputValues; }
+
+        // Forgets all visibility changes and input values
+        void Clear();
+
+        // for (const CardNode& node : state.VisibleElements()) { ... }
+        // The elements the card shows in this state, without copying them or the card: see VisibleElementIterator.
+        VisibleElementRange VisibleElements() const;
+
+    private:
+        BaseCardElement* FindElement(const std::string& id) const;
+
+        std::shared_ptr<const ParseResult> m_parseResult;
+        std::shared_ptr<AdaptiveCard> m_card;
+        // only elements whose visibility differs from the card's
+        std::unordered_map<const BaseCardElement*, bool> m_visibility;
+        std::unordered_map<std::string, std::string> m_inputValues;
+    };
+}
@@ -0,0 +1,376 @@
+#include "pch.h"
+#include "CardTraversal.h"
+#include "ActionSet.h"
+#include "ChoiceSetInput.h"
+#include "Column.h"
+#include "ColumnSet.h"
+#include "Container.h"
+#include "DateInput.h"
+#include "FactSet.h"
+#include "Image.h"
+#include "ImageSet.h"
+#include "Media.h"
+#include "NumberInput.h"
+#include "OpenUrlAction.h"
+#include "Paragraph.h"
+#include "RichTextBlock.h"
+#include "SharedAdaptiveCard.h"
+#include "ShowCardAction.h"
+#include "SubmitAction.h"
+#include "TextBlock.h"
+#include "TextInput.h"
+#include "TextRun.h"
+#include "TimeInput.h"
+#include "ToggleInput.h"
+#include "ToggleVisibilityAction.h"
+#include "UnknownAction.h"
+#include "UnknownElement.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        template<typename T>
+        void AppendElements(const std::vector<std::shared_ptr<T>>& elements, unsigned int depth, std::vector<CardNode>& children)
+        {
+            for (const auto& element : elements)
+            {
+                children.emplace_back(static_cast<BaseCardElement&>(*element), depth, false);
+            }
+        }
+
+        void AppendActions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, unsigned int depth, std::vector<CardNode>& children)
+        {
+            for (const auto& action : actions)
+            {
+                children.emplace_back(*action, depth, false);
+            }
+        }
+
+        void AppendAction(const std::shared_ptr<BaseActionElement>& action, unsigned int depth, std::vector<CardNode>& children)
+        {
+            if (action != nullptr)
+            {
+                children.emplace_back(*action, depth, false);
+            }
+        }
+
+        void AppendInlineActions(const RichTextBlock& richTextBlock, unsigned int depth, std::vector<CardNode>& children)
+        {
+            for (const auto& paragraph : richTextBlock.GetParagraphs())
+            {
+                for (const auto& inlineElement : static_cast<const Paragraph&>(*paragraph).GetInlines())
+                {
+                    if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+                    {
+                        AppendAction(static_cast<const TextRun&>(*inlineElement).GetSelectAction(), depth, children);
+                    }
+                }
+            }
+        }
+    }
+
+    CardNode::CardNode(AdaptiveCard& card, unsigned int depth) :
+        m_card(&card), m_element(nullptr), m_kind(CardNodeKind::Card), m_cardElementType(CardElementType::AdaptiveCard),
+        m_actionType(ActionType::Unsupported), m_depth(depth), m_isFallback(false)
+    {
+    }
+
+    CardNode::CardNode(BaseCardElement& element, unsigned int depth, bool isFallback) :
+        m_card(nullptr), m_element(&element), m_kind(CardNodeKind::CardElement), m_cardElementType(element.GetElementType()),
+        m_actionType(ActionType::Unsupported), m_depth(depth), m_isFallback(isFallback)
+    {
+    }
+
+    CardNode::CardNode(BaseActionElement& action, unsigned int depth, bool isFallback) :
+        m_card(nullptr), m_element(&action), m_kind(CardNodeKind::Action), m_cardElementType(CardElementType::Unknown),
+        m_actionType(action.GetElementType()), m_depth(depth), m_isFallback(isFallback)
+    {
+    }
+
+    BaseCardElement* CardNode::GetCardElement() const
+    {
+        return (m_kind == CardNodeKind::CardElement) ? static_cast<BaseCardElement*>(m_element) : nullptr;
+    }
+
+    BaseActionElement* CardNode::GetAction() const
+    {
+        return (m_kind == CardNodeKind::Action) ? static_cast<BaseActionElement*>(m_element) : nullptr;
+    }
+
+    void CardNode::AppendChildren(std::vector<CardNode>& children) const
+    {
+        const unsigned int childDepth = m_depth + 1;
+
+        if (m_kind == CardNodeKind::Card)
+        {
+            const auto& card = static_cast<const AdaptiveCard&>(*m_card);
+            AppendElements(card.GetBody(), childDepth, children);
+            AppendActions(card.GetActions(), childDepth, children);
+            AppendAction(m_card->GetSelectAction(), childDepth, children);
+            return;
+        }
+
+        // fallback content comes first, as that's where the parser meets it (see BaseElement::DeserializeBase), and is
+        // the same kind of node as the element it stands in for
+        const auto& fallback = m_element->GetFallbackContent();
+        if (fallback != nullptr)
+        {
+            if (m_kind == CardNodeKind::CardElement)
+            {
+                children.emplace_back(static_cast<BaseCardElement&>(*fallback), childDepth, true);
+            }
+            else
+            {
+                children.emplace_back(static_cast<BaseActionElement&>(*fallback), childDepth, true);
+            }
+        }
+
+        if (m_kind == CardNodeKind::CardElement)
+        {
+            switch (m_cardElementType)
+            {
+            case CardElementType::Container:
+            {
+                const auto& container = static_cast<const Container&>(*m_element);
+                AppendElements(container.GetItems(), childDepth, children);
+                AppendAction(container.GetSelectAction(), childDepth, children);
+                break;
+            }
+            case CardElementType::Column:
+            {
+                const auto& column = static_cast<const Column&>(*m_element);
+                AppendElements(column.GetItems(), childDepth, children);
+                AppendAction(column.GetSelectAction(), childDepth, children);
+                break;
+            }
+            case CardElementType::ColumnSet:
+            {
+                const auto& columnSet = static_cast<const ColumnSet&>(*m_element);
+                AppendElements(columnSet.GetColumns(), childDepth, children);
+                AppendAction(columnSet.GetSelectAction(), childDepth, children);
+                break;
+            }
+            case CardElementType::ImageSet:
+                AppendElements(static_cast<const ImageSet&>(*m_element).GetImages(), childDepth, children);
+                break;
+            case CardElementType::ActionSet:
+                AppendActions(static_cast<const ActionSet&>(*m_element).GetActions(), childDepth, children);
+                break;
+            case CardElementType::Image:
+                AppendAction(static_cast<const Image&>(*m_element).GetSelectAction(), childDepth, children);
+                break;
+            case CardElementType::TextInput:
+                AppendAction(static_cast<const TextInput&>(*m_element).GetInlineAction(), childDepth, children);
+                break;
+            case CardElementType::RichTextBlock:
+                AppendInlineActions(static_cast<const RichTextBlock&>(*m_element), childDepth, children);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_actionType == ActionType::ShowCard)
+        {
+            const auto& card = static_cast<const ShowCardAction&>(*m_element).GetCard();
+            if (card != nullptr)
+            {
+                children.emplace_back(*card, childDepth);
+            }
+        }
+    }
+
+    PreOrderCardIterator::PreOrderCardIterator(const CardNode& root) : m_pending{root} {}
+
+    PreOrderCardIterator& PreOrderCardIterator::operator++()
+    {
+        const CardNode current = m_pending.back();
+        m_pending.pop_back();
+
+        if (!m_skipChildren)
+        {
+            m_children.clear();
+            current.AppendChildren(m_children);
+            m_pending.insert(m_pending.end(), m_children.rbegin(), m_children.rend());
+        }
+        m_skipChildren = false;
+        return *this;
+    }
+
+    PostOrderCardIterator::PostOrderCardIterator(const CardNode& root) : m_stack{Frame{root, false}}
+    {
+        Descend();
+    }
+
+    PostOrderCardIterator& PostOrderCardIterator::operator++()
+    {
+        m_stack.pop_back();
+        Descend();
+        return *this;
+    }
+
+    void PostOrderCardIterator::Descend()
+    {
+        while (!m_stack.empty() && !m_stack.back().childrenPushed)
+        {
+            m_stack.back().childrenPushed = true;
+
+            m_children.clear();
+            m_stack.back().node.AppendChildren(m_children);
+            for (auto child = m_children.rbegin(); child != m_children.rend(); ++child)
+            {
+                m_stack.push_back(Frame{*child, false});
+            }
+        }
+    }
+
+    CardRange<PreOrderCardIterator> PreOrder(AdaptiveCard& card)
+    {
+        return CardRange<PreOrderCardIterator>(CardNode(card, 0));
+    }
+
+    CardRange<PreOrderCardIterator> PreOrder(BaseCardElement& element)
+    {
+        return CardRange<PreOrderCardIterator>(CardNode(element, 0, false));
+    }
+
+    CardRange<PreOrderCardIterator> PreOrder(BaseActionElement& action)
+    {
+        return CardRange<PreOrderCardIterator>(CardNode(action, 0, false));
+    }
+
+    CardRange<PostOrderCardIterator> PostOrder(AdaptiveCard& card)
+    {
+        return CardRange<PostOrderCardIterator>(CardNode(card, 0));
+    }
+
+    CardRange<PostOrderCardIterator> PostOrder(BaseCardElement& element)
+    {
+        return CardRange<PostOrderCardIterator>(CardNode(element, 0, false));
+    }
+
+    CardRange<PostOrderCardIterator> PostOrder(BaseActionElement& action)
+    {
+        return CardRange<PostOrderCardIterator>(CardNode(action, 0, false));
+    }
+
+    bool CardVisitor::Visit(AdaptiveCard&) { return true; }
+    bool CardVisitor::Visit(BaseCardElement&) { return true; }
+    bool CardVisitor::Visit(BaseActionElement&) { return true; }
+
+    bool CardVisitor::Visit(ActionSet& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(ChoiceSetInput& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(Column& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(ColumnSet& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(Container& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(DateInput& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(FactSet& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(Image& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(ImageSet& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(Media& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(NumberInput& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(RichTextBlock& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(TextBlock& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(TextInput& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(TimeInput& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(ToggleInput& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+    bool CardVisitor::Visit(UnknownElement& element) { return Visit(static_cast<BaseCardElement&>(element)); }
+
+    bool CardVisitor::Visit(ShowCardAction& action) { return Visit(static_cast<BaseActionElement&>(action)); }
+    bool CardVisitor::Visit(SubmitAction& action) { return Visit(static_cast<BaseActionElement&>(action)); }
+    bool CardVisitor::Visit(OpenUrlAction& action) { return Visit(static_cast<BaseActionElement&>(action)); }
+    bool CardVisitor::Visit(ToggleVisibilityAction& action) { return Visit(static_cast<BaseActionElement&>(action)); }
+    bool CardVisitor::Visit(UnknownAction& action) { return Visit(static_cast<BaseActionElement&>(action)); }
+
+    bool CardVisitor::Dispatch(const CardNode& node)
+    {
+        switch (node.GetKind())
+        {
+        case CardNodeKind::Card:
+            return Visit(*node.GetCard());
+
+        case CardNodeKind::CardElement:
+        {
+            BaseCardElement& element = *node.GetCardElement();
+            switch (node.GetCardElementType())
+            {
+            case CardElementType::ActionSet:
+                return Visit(static_cast<ActionSet&>(element));
+            case CardElementType::ChoiceSetInput:
+                return Visit(static_cast<ChoiceSetInput&>(element));
+            case CardElementType::Column:
+                return Visit(static_cast<Column&>(element));
+            case CardElementType::ColumnSet:
+                return Visit(static_cast<ColumnSet&>(element));
+            case CardElementType::Container:
+                return Visit(static_cast<Container&>(element));
+            case CardElementType::DateInput:
+                return Visit(static_cast<DateInput&>(element));
+            case CardElementType::FactSet:
+                return Visit(static_cast<FactSet&>(element));
+            case CardElementType::Image:
+                return Visit(static_cast<Image&>(element));
+            case CardElementType::ImageSet:
+                return Visit(static_cast<ImageSet&>(element));
+            case CardElementType::Media:
+                return Visit(static_cast<Media&>(element));
+            case CardElementType::NumberInput:
+                return Visit(static_cast<NumberInput&>(element));
+            case CardElementType::RichTextBlock:
+                return Visit(static_cast<RichTextBlock&>(element));
+            case CardElementType::TextBlock:
+                return Visit(static_cast<TextBlock&>(element));
+            case CardElementType::TextInput:
+                return Visit(static_cast<TextInput&>(element));
+            case CardElementType::TimeInput:
+                return Visit(static_cast<TimeInput&>(element));
+            case CardElementType::ToggleInput:
+                return Visit(static_cast<ToggleInput&>(element));
+            case CardElementType::Unknown:
+                return Visit(static_cast<UnknownElement&>(element));
+            default:
+                return Visit(element);
+            }
+        }
+
+        case CardNodeKind::Action:
+        default:
+        {
+            BaseActionElement& action = *node.GetAction();
+            switch (node.GetActionType())
+            {
+            case ActionType::ShowCard:
+                return Visit(static_cast<ShowCardAction&>(action));
+            case ActionType::Submit:
+                return Visit(static_cast<SubmitAction&>(action));
+            case ActionType::OpenUrl:
+                return Visit(static_cast<OpenUrlAction&>(action));
+            case ActionType::ToggleVisibility:
+                return Visit(static_cast<ToggleVisibilityAction&>(action));
+            case ActionType::UnknownAction:
+                return Visit(static_cast<UnknownAction&>(action));
+            default:
+                return Visit(action);
+            }
+        }
+        }
+    }
+
+    namespace
+    {
+        void Walk(CardRange<PreOrderCardIterator> range, CardVisitor& visitor)
+        {
+            for (auto it = range.begin(); it != range.end(); ++it)
+            {
+                if (!visitor.Dispatch(*it))
+                {
+                    it.SkipChildren();
+                }
+            }
+        }
+    }
+
+    void VisitCard(AdaptiveCard& card, CardVisitor& visitor) { Walk(PreOrder(card), visitor); }
+    void VisitElement(BaseCardElement& element, CardVisitor& visitor) { Walk(PreOrder(element), visitor); }
+    void VisitAction(BaseActionElement& action, CardVisitor& visitor) { Walk(PreOrder(action), visitor); }
+}
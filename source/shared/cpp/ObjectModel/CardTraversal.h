@@ -0,0 +1,215 @@
+#pragma once
+
+#include "pch.h"
+#include "Enums.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseElement;
+    class BaseCardElement;
+    class BaseActionElement;
+    class ActionSet;
+    class ChoiceSetInput;
+    class Column;
+    class ColumnSet;
+    class Container;
+    class DateInput;
+    class FactSet;
+    class Image;
+    class ImageSet;
+    class Media;
+    class NumberInput;
+    class RichTextBlock;
+    class TextBlock;
+    class TextInput;
+    class TimeInput;
+    class ToggleInput;
+    class UnknownElement;
+    class ShowCardAction;
+    class SubmitAction;
+    class OpenUrlAction;
+    class ToggleVisibilityAction;
+    class UnknownAction;
+
+    enum class CardNodeKind
+    {
+        Card,
+        CardElement,
+        Action
+    };
+
+    // A node of the card graph: a card (the root, or the card of an Action.ShowCard), a card element or an action.
+    // The node's element type is read once when the node is reached, so visiting it needs no further virtual calls.
+    class CardNode
+    {
+    public:
+        CardNode(AdaptiveCard& card, unsigned int depth);
+        CardNode(BaseCardElement& element, unsigned int depth, bool isFallback);
+        CardNode(BaseActionElement& action, unsigned int depth, bool isFallback);
+
+        CardNodeKind GetKind() const { return m_kind; }
+
+        // Only one of these is non-null, according to GetKind()
+        AdaptiveCard* GetCard() const { return m_card; }
+        BaseCardElement* GetCardElement() const;
+        BaseActionElement* GetAction() const;
+
+        // The element or action, or null for a card
+        BaseElement* GetElement() const { return m_element; }
+
+        // Only meaningful for CardElement and Action nodes respectively
+        CardElementType GetCardElementType() const { return m_cardElementType; }
+        ActionType GetActionType() const { return m_actionType; }
+
+        // Distance from the traversal root, which has depth 0
+        unsigned int GetDepth() const { return m_depth; }
+
+        // True for an element's fallback content
+        bool IsFallback() const { return m_isFallback; }
+
+        // Appends this node's children in the order the parser meets them: a card's body, actions and select action; an
+        // element's fallback content, then its items, columns, images, inline actions and select action; an action's
+        // fallback content, then a ShowCard action's card.
+        void AppendChildren(std::vector<CardNode>& children) const;
+
+    private:
+        AdaptiveCard* m_card;
+        BaseElement* m_element;
+        CardNodeKind m_kind;
+        CardElementType m_cardElementType;
+        ActionType m_actionType;
+        unsigned int m_depth;
+        bool m_isFallback;
+    };
+
+    // Pre-order iteration over a card graph, using an explicit stack rather than recursion so that arbitrarily deep
+    // cards can be walked. SkipChildren() prunes the subtree below the current node. Modifying the graph below the
+    // current node invalidates the iterator.
+    class PreOrderCardIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = CardNode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const CardNode*;
+        using reference = const CardNode&;
+
+        PreOrderCardIterator() = default;
+        explicit PreOrderCardIterator(const CardNode& root);
+
+        reference operator*() const { return m_pending.back(); }
+        pointer operator->() const { return &m_pending.back(); }
+        PreOrderCardIterator& operator++();
+
+        void SkipChildren() { m_skipChildren = true; }
+
+        bool operator==(const PreOrderCardIterator& other) const { return m_pending.empty() && other.m_pending.empty(); }
+        bool operator!=(const PreOrderCardIterator& other) const { return !(*this == other); }
+
+    private:
+        // the current node is at the back
+        std::vector<CardNode> m_pending;
+        std::vector<CardNode> m_children;
+        bool m_skipChildren = false;
+    };
+
+    // Post-order iteration: every node is reached after all of its children, so a pass can combine results bottom-up.
+    class PostOrderCardIterator
+    {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = CardNode;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const CardNode*;
+        using reference = const CardNode&;
+
+        PostOrderCardIterator() = default;
+        explicit PostOrderCardIterator(const CardNode& root);
+
+        reference operator*() const { return m_stack.back().node; }
+        pointer operator->() const { return &m_stack.back().node; }
+        PostOrderCardIterator& operator++();
+
+        bool operator==(const PostOrderCardIterator& other) const { return m_stack.empty() && other.m_stack.empty(); }
+        bool operator!=(const PostOrderCardIterator& other) const { return !(*this == other); }
+
+    private:
+        struct Frame
+        {
+            CardNode node;
+            bool childrenPushed;
+        };
+
+        // Pushes children until the node on top has had its children pushed, i.e. is next in post-order
+        void Descend();
+
+        std::vector<Frame> m_stack;
+        std::vector<CardNode> m_children;
+    };
+
+    template<typename Iterator> class CardRange
+    {
+    public:
+        explicit CardRange(const CardNode& root) : m_root(root) {}
+
+        Iterator begin() const { return Iterator(m_root); }
+        Iterator end() const { return Iterator(); }
+
+    private:
+        CardNode m_root;
+    };
+
+    // for (const CardNode& node : PreOrder(card)) { ... }
+    CardRange<PreOrderCardIterator> PreOrder(AdaptiveCard& card);
+    CardRange<PreOrderCardIterator> PreOrder(BaseCardElement& element);
+    CardRange<PreOrderCardIterator> PreOrder(BaseActionElement& action);
+    CardRange<PostOrderCardIterator> PostOrder(AdaptiveCard& card);
+    CardRange<PostOrderCardIterator> PostOrder(BaseCardElement& element);
+    CardRange<PostOrderCardIterator> PostOrder(BaseActionElement& action);
+
+    // Typed visitor over the card graph, called in pre-order. Dispatch switches on the type read when the node was
+    // reached, so an overridden overload costs one virtual call; the others forward to the BaseCardElement or
+    // BaseActionElement overload, which is also where custom elements and actions arrive. Returning false skips the
+    // node's children.
+    class CardVisitor
+    {
+    public:
+        virtual ~CardVisitor() = default;
+
+        virtual bool Visit(AdaptiveCard& card);
+        virtual bool Visit(BaseCardElement& element);
+        virtual bool Visit(BaseActionElement& action);
+
+        virtual bool Visit(ActionSet& element);
+        virtual bool Visit(ChoiceSetInput& element);
+        virtual bool Visit(Column& element);
+        virtual bool Visit(ColumnSet& element);
+        virtual bool Visit(Container& element);
+        virtual bool Visit(DateInput& element);
+        virtual bool Visit(FactSet& element);
+        virtual bool Visit(Image& element);
+        virtual bool Visit(ImageSet& element);
+        virtual bool Visit(Media& element);
+        virtual bool Visit(NumberInput& element);
+        virtual bool Visit(RichTextBlock& element);
+        virtual bool Visit(TextBlock& element);
+        virtual bool Visit(TextInput& element);
+        virtual bool Visit(TimeInput& element);
+        virtual bool Visit(ToggleInput& element);
+        virtual bool Visit(UnknownElement& element);
+
+        virtual bool Visit(ShowCardAction& action);
+        virtual bool Visit(SubmitAction& action);
+        virtual bool Visit(OpenUrlAction& action);
+        virtual bool Visit(ToggleVisibilityAction& action);
+        virtual bool Visit(UnknownAction& action);
+
+        // Calls the Visit overload for node's type
+        bool Dispatch(const CardNode& node);
+    };
+
+    void VisitCard(AdaptiveCard& card, CardVisitor& visitor);
+    void VisitElement(BaseCardElement& element, CardVisitor& visitor);
+    void VisitAction(BaseActionElement& action, CardVisitor& visitor);
+}
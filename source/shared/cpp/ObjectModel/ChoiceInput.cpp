@@ -44,17 +44,41 @@ std::string ChoiceInput::GetTitle() const
     return m_title;
 }
 
+const std::string& ChoiceInput::GetTitleRef() const
+{
+    return m_title;
+}
+
 void ChoiceInput::SetTitle(const std::string& title)
 {
+    MarkChanged();
     m_title = title;
 }
 
+void ChoiceInput::SetTitle(std::string&& title)
+{
+    MarkChanged();
+    m_title = std::move(title);
+}
+
 std::string ChoiceInput::GetValue() const
 {
     return m_value;
 }
 
+const std::string& ChoiceInput::GetValueRef() const
+{
+    return m_value;
+}
+
 void ChoiceInput::SetValue(const std::string& value)
 {
+    MarkChanged();
     m_value = value;
 }
+
+void ChoiceInput::SetValue(std::string&& value)
+{
+    MarkChanged();
+    m_value = std::move(value);
+}
@@ -1,11 +1,12 @@
 #pragma once
 
 #include "pch.h"
+#include "BaseElement.h"
 #include "ParseContext.h"
 
 namespace AdaptiveSharedNamespace
 {
-    class ChoiceInput
+    class ChoiceInput : public ElementPart
     {
     public:
         ChoiceInput();
@@ -14,10 +15,14 @@ namespace AdaptiveSharedNamespace
         Json::Value SerializeToJsonValue();
 
         std::string GetTitle() const;
+        const std::string& GetTitleRef() const;
         void SetTitle(const std::string& value);
+        void SetTitle(std::string&& value);
 
         std::string GetValue() const;
+        const std::string& GetValueRef() const;
         void SetValue(const std::string& value);
+        void SetValue(std::string&& value);
 
         static std::shared_ptr<ChoiceInput> Deserialize(ParseContext&, const Json::Value& root);
         static std::shared_ptr<ChoiceInput> DeserializeFromString(ParseContext&, const std::string& jsonString);
@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "ChoiceSetIndex.h"
+#include "AdaptiveCardParseException.h"
+#include "ChoiceSetInput.h"
+
+namespace AdaptiveSharedNamespace
+{
+    const std::size_t ChoiceSetIndex::NoChoice = std::numeric_limits<std::size_t>::max();
+
+    ChoiceSetIndex::ChoiceSetIndex(const ChoiceSetInput& choiceSet)
+    {
+        const std::size_t count = choiceSet.GetChoiceCount();
+        if (count > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Choice set is too large to index");
+        }
+
+        m_choiceByValue.reserve(count);
+        m_foldedTitles.reserve(count);
+        m_titleOrder.reserve(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const auto view = choiceSet.GetChoiceView(i);
+            // the first of several choices with the same value wins, as it would in a linear search
+            m_choiceByValue.emplace(view.GetValue(), i);
+            m_foldedTitles.push_back(FoldCase(view.GetTitleData(), view.GetTitleLength()));
+            m_titleOrder.push_back(static_cast<std::uint32_t>(i));
+        }
+
+        std::stable_sort(m_titleOrder.begin(), m_titleOrder.end(), [this](std::uint32_t lhs, std::uint32_t rhs) {
+            return m_foldedTitles[lhs] < m_foldedTitles[rhs];
+        });
+    }
+
+    std::size_t ChoiceSetIndex::FindByValue(const std::string& value) const
+    {
+        const auto found = m_choiceByValue.find(value);
+        return (found == m_choiceByValue.end()) ? NoChoice : found->second;
+    }
+
+    std::vector<std::size_t> ChoiceSetIndex::FindByTitlePrefix(const std::string& prefix) const
+    {
+        const std::string foldedPrefix = FoldCase(prefix.data(), prefix.size());
+
+        // titles starting with the prefix form one run in title order, beginning at the first title not less than it
+        auto it = std::lower_bound(m_titleOrder.begin(), m_titleOrder.end(), foldedPrefix, [this](std::uint32_t lhs, const std::string& rhs) {
+            return m_foldedTitles[lhs] < rhs;
+        });
+
+        std::vector<std::size_t> matches;
+        for (; it != m_titleOrder.end() && m_foldedTitles[*it].compare(0, foldedPrefix.size(), foldedPrefix) == 0; ++it)
+        {
+            matches.push_back(*it);
+        }
+        std::sort(matches.begin(), matches.end());
+        return matches;
+    }
+
+    std::string ChoiceSetIndex::FoldCase(const char* data, std::size_t length)
+    {
+        std::string folded(data, length);
+        for (auto& c : folded)
+        {
+            if (c >= 'A' && c <= 'Z')
+            {
+                c = static_cast<char>(c - 'A' + 'a');
+            }
+        }
+        return folded;
+    }
+}
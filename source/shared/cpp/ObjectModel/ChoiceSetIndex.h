@@ -0,0 +1,33 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class ChoiceSetInput;
+
+    // Lookup structures over the choices of one ChoiceSetInput: value to choice, and choices ordered by case-folded
+    // title for prefix (typeahead) filtering. Results are indices into the choice set, valid for as long as its choices
+    // are not modified. Case folding covers ASCII letters only; other bytes are compared as they are.
+    class ChoiceSetIndex
+    {
+    public:
+        static const std::size_t NoChoice;
+
+        explicit ChoiceSetIndex(const ChoiceSetInput& choiceSet);
+
+        // Index of the first choice with the given value, or NoChoice
+        std::size_t FindByValue(const std::string& value) const;
+
+        // Indices of the choices whose title starts with prefix, ignoring case, in choice order
+        std::vector<std::size_t> FindByTitlePrefix(const std::string& prefix) const;
+
+        static std::string FoldCase(const char* data, std::size_t length);
+
+    private:
+        std::unordered_map<std::string, std::size_t> m_choiceByValue;
+        std::vector<std::string> m_foldedTitles;
+        // choice indices sorted by folded title
+        std::vector<std::uint32_t> m_titleOrder;
+    };
+}
@@ -5,23 +5,127 @@
 
 using namespace AdaptiveSharedNamespace;
 
+// ChoiceInput objects made from the columns by the const GetChoices(), as FactSet::FactCache
+struct ChoiceSetInput::ChoiceCache
+{
+    std::once_flag choicesOnce;
+    std::vector<std::shared_ptr<ChoiceInput>> choices;
+};
+
+namespace
+{
+    // Multi-select values are joined with commas and no surrounding whitespace
+    template<typename Callback> void ForEachValueEntry(const std::string& value, Callback callback)
+    {
+        if (value.empty())
+        {
+            return;
+        }
+
+        std::size_t start = 0;
+        while (true)
+        {
+            const std::size_t end = value.find(',', start);
+            callback(value.substr(start, end - start));
+            if (end == std::string::npos)
+            {
+                return;
+            }
+            start = end + 1;
+        }
+    }
+}
+
 ChoiceSetInput::ChoiceSetInput() :
     BaseInputElement(CardElementType::ChoiceSetInput), m_wrap(false), m_isMultiSelect(false),
     m_choiceSetStyle(ChoiceSetStyle::Compact)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<ChoiceInput>>& ChoiceSetInput::GetChoices() const
 {
-    return m_choices;
+    if (m_choiceColumns.IsEmpty())
+    {
+        return m_choices;
+    }
+
+    std::call_once(m_choiceCache->choicesOnce, [this]() {
+        auto& choices = m_choiceCache->choices;
+        choices.reserve(m_choiceColumns.Size());
+        for (std::size_t i = 0; i < m_choiceColumns.Size(); ++i)
+        {
+            const auto view = m_choiceColumns[i];
+            auto choice = std::make_shared<ChoiceInput>();
+            choice->SetTitle(view.GetTitle());
+            choice->SetValue(view.GetValue());
+            ElementPartOwner::LinkReadOnly(*choice);
+            choices.push_back(std::move(choice));
+        }
+    });
+    return m_choiceCache->choices;
 }
 
 std::vector<std::shared_ptr<ChoiceInput>>& ChoiceSetInput::GetChoices()
 {
+    ThrowIfFrozen();
+    if (!m_choiceColumns.IsEmpty())
+    {
+        m_choices.reserve(m_choices.size() + m_choiceColumns.Size());
+        for (std::size_t i = 0; i < m_choiceColumns.Size(); ++i)
+        {
+            const auto view = m_choiceColumns[i];
+            auto choice = std::make_shared<ChoiceInput>();
+            choice->SetTitle(view.GetTitle());
+            choice->SetValue(view.GetValue());
+            m_choices.push_back(std::move(choice));
+        }
+        m_choiceColumns.Clear();
+        m_choiceCache = nullptr;
+    }
+    // the caller may modify the choices through the returned reference
+    m_choiceIndex.reset();
+    m_selectedValues.clear();
     return m_choices;
 }
 
+std::size_t ChoiceSetInput::GetChoiceCount() const
+{
+    return m_choiceColumns.IsEmpty() ? m_choices.size() : m_choiceColumns.Size();
+}
+
+TitleValueView ChoiceSetInput::GetChoiceView(std::size_t index) const
+{
+    if (m_choiceColumns.IsEmpty())
+    {
+        const auto& choice = *m_choices[index];
+        return TitleValueView(choice.GetTitleRef(), choice.GetValueRef());
+    }
+    return m_choiceColumns[index];
+}
+
+void ChoiceSetInput::VisitNested(NestedVisitor& visitor) const
+{
+    BaseInputElement::VisitNested(visitor);
+    for (const auto& choice : m_choices)
+    {
+        visitor.Part(*choice);
+    }
+}
+
+void ChoiceSetInput::Freeze()
+{
+    if (!IsFrozen())
+    {
+        // links the choices, whose setters then throw
+        for (const auto& choice : m_choices)
+        {
+            m_partOwner.Link(*this, *choice);
+        }
+        // columnar choices stay columnar, as in FactSet::Freeze
+    }
+    BaseInputElement::Freeze();
+}
+
 Json::Value ChoiceSetInput::SerializeToJsonValue() const
 {
     Json::Value root = BaseInputElement::SerializeToJsonValue();
@@ -45,9 +149,16 @@ Json::Value ChoiceSetInput::SerializeToJsonValue() const
 
     std::string propertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices);
     root[propertyName] = Json::Value(Json::arrayValue);
-    for (const auto& choice : m_choices)
+    const std::string titlePropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title);
+    const std::string valuePropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value);
+    for (std::size_t i = 0; i < GetChoiceCount(); ++i)
     {
-        root[propertyName].append(choice->SerializeToJsonValue());
+        // same output as ChoiceInput::SerializeToJsonValue, without materializing the choice
+        const auto view = GetChoiceView(i);
+        Json::Value choice;
+        choice[titlePropertyName] = Json::Value(view.GetTitleData(), view.GetTitleData() + view.GetTitleLength());
+        choice[valuePropertyName] = Json::Value(view.GetValueData(), view.GetValueData() + view.GetValueLength());
+        root[propertyName].append(choice);
     }
 
     return root;
@@ -60,6 +171,7 @@ bool ChoiceSetInput::GetIsMultiSelect() const
 
 void ChoiceSetInput::SetIsMultiSelect(const bool isMultiSelect)
 {
+    MarkChanged();
     m_isMultiSelect = isMultiSelect;
 }
 
@@ -70,6 +182,7 @@ ChoiceSetStyle ChoiceSetInput::GetChoiceSetStyle() const
 
 void ChoiceSetInput::SetChoiceSetStyle(const ChoiceSetStyle choiceSetStyle)
 {
+    MarkChanged();
     m_choiceSetStyle = choiceSetStyle;
 }
 
@@ -78,9 +191,108 @@ std::string ChoiceSetInput::GetValue() const
     return m_value;
 }
 
+const std::string& ChoiceSetInput::GetValueRef() const
+{
+    return m_value;
+}
+
 void ChoiceSetInput::SetValue(std::string const& value)
 {
+    MarkChanged();
     m_value = value;
+
+    if (m_choiceIndex)
+    {
+        m_selectedValues.clear();
+        ForEachValueEntry(m_value, [this](std::string&& entry) { m_selectedValues.insert(std::move(entry)); });
+    }
+}
+
+void ChoiceSetInput::BuildChoiceIndex()
+{
+    ThrowIfFrozen();
+    m_choiceIndex = std::make_shared<const ChoiceSetIndex>(*this);
+    // so that editing a choice drops the index (see PartChanged)
+    for (const auto& choice : m_choices)
+    {
+        m_partOwner.Link(*this, *choice);
+    }
+
+    m_selectedValues.clear();
+    ForEachValueEntry(m_value, [this](std::string&& entry) { m_selectedValues.insert(std::move(entry)); });
+}
+
+void ChoiceSetInput::PartChanged()
+{
+    m_choiceIndex.reset();
+    m_selectedValues.clear();
+}
+
+bool ChoiceSetInput::HasChoiceIndex() const
+{
+    return m_choiceIndex != nullptr;
+}
+
+std::size_t ChoiceSetInput::FindChoiceByValue(const std::string& value) const
+{
+    if (m_choiceIndex)
+    {
+        return m_choiceIndex->FindByValue(value);
+    }
+
+    for (std::size_t i = 0; i < GetChoiceCount(); ++i)
+    {
+        const auto view = GetChoiceView(i);
+        if (view.GetValueLength() == value.size() && value.compare(0, value.size(), view.GetValueData(), view.GetValueLength()) == 0)
+        {
+            return i;
+        }
+    }
+    return ChoiceSetIndex::NoChoice;
+}
+
+std::vector<std::size_t> ChoiceSetInput::FindChoicesByTitlePrefix(const std::string& prefix) const
+{
+    if (m_choiceIndex)
+    {
+        return m_choiceIndex->FindByTitlePrefix(prefix);
+    }
+
+    const std::string foldedPrefix = ChoiceSetIndex::FoldCase(prefix.data(), prefix.size());
+    std::vector<std::size_t> matches;
+    for (std::size_t i = 0; i < GetChoiceCount(); ++i)
+    {
+        const auto view = GetChoiceView(i);
+        if (view.GetTitleLength() >= foldedPrefix.size() &&
+            ChoiceSetIndex::FoldCase(view.GetTitleData(), foldedPrefix.size()) == foldedPrefix)
+        {
+            matches.push_back(i);
+        }
+    }
+    return matches;
+}
+
+bool ChoiceSetInput::IsValueSelected(const std::string& value) const
+{
+    if (m_choiceIndex)
+    {
+        return m_selectedValues.find(value) != m_selectedValues.end();
+    }
+
+    bool selected = false;
+    ForEachValueEntry(m_value, [&selected, &value](std::string&& entry) { selected = selected || (entry == value); });
+    return selected;
+}
+
+bool ChoiceSetInput::IsValidValue(const std::string& value) const
+{
+    std::size_t entries = 0;
+    bool valid = true;
+    ForEachValueEntry(value, [this, &entries, &valid](std::string&& entry) {
+        ++entries;
+        valid = valid && (FindChoiceByValue(entry) != ChoiceSetIndex::NoChoice);
+    });
+    return valid && (m_isMultiSelect || entries <= 1);
 }
 
 bool ChoiceSetInput::GetWrap() const
@@ -90,6 +302,7 @@ bool ChoiceSetInput::GetWrap() const
 
 void ChoiceSetInput::SetWrap(bool value)
 {
+    MarkChanged();
     m_wrap = value;
 }
 
@@ -105,9 +318,24 @@ std::shared_ptr<BaseCardElement> ChoiceSetInputParser::Deserialize(ParseContext&
     choiceSet->SetValue(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Value, false));
     choiceSet->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false, false));
 
-    // Parse Choices
-    auto choices = ParseUtil::GetElementCollectionOfSingleType<ChoiceInput>(context, json, AdaptiveCardSchemaKey::Choices, ChoiceInput::Deserialize, true);
-    choiceSet->m_choices = std::move(choices);
+    // Parse Choices straight into columns, with the same validation as ChoiceInput::Deserialize
+    const auto& choices = ParseUtil::GetArrayRef(json, AdaptiveCardSchemaKey::Choices, true);
+    choiceSet->m_choiceColumns.Reserve(choices.size());
+    for (const auto& choice : choices)
+    {
+        choiceSet->m_choiceColumns.Append(ParseUtil::GetString(choice, AdaptiveCardSchemaKey::Title, true),
+                                          ParseUtil::GetString(choice, AdaptiveCardSchemaKey::Value, true));
+    }
+    if (!choiceSet->m_choiceColumns.IsEmpty())
+    {
+        choiceSet->m_choiceCache = std::make_shared<ChoiceSetInput::ChoiceCache>();
+    }
+
+    const std::size_t indexThreshold = context.GetChoiceIndexThreshold();
+    if (indexThreshold != 0 && choiceSet->GetChoiceCount() >= indexThreshold)
+    {
+        choiceSet->BuildChoiceIndex();
+    }
 
     return choiceSet;
 }
@@ -120,9 +348,33 @@ ChoiceSetInputParser::DeserializeFromString(ParseContext& context, const std::st
 
 void ChoiceSetInput::PopulateKnownPropertiesSet()
 {
+    BaseInputElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Choices),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiSelect),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
 }
+
+std::shared_ptr<BaseElement> ChoiceSetInput::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void ChoiceSetInput::DeepCopyMembers()
+{
+    BaseInputElement::DeepCopyMembers();
+    if (m_choiceCache != nullptr)
+    {
+        m_choiceCache = std::make_shared<ChoiceCache>();
+    }
+    for (auto& choice : m_choices)
+    {
+        choice = std::make_shared<ChoiceInput>(*choice);
+        if (m_choiceIndex != nullptr)
+        {
+            m_partOwner.Link(*this, *choice);
+        }
+    }
+}
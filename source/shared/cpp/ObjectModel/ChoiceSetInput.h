@@ -2,6 +2,8 @@
 
 #include "pch.h"
 #include "BaseInputElement.h"
+#include "ChoiceSetIndex.h"
+#include "TitleValueColumns.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -20,6 +22,9 @@ namespace AdaptiveSharedNamespace
         ~ChoiceSetInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         bool GetIsMultiSelect() const;
         void SetIsMultiSelect(const bool isMultiSelect);
@@ -27,16 +32,43 @@ namespace AdaptiveSharedNamespace
         ChoiceSetStyle GetChoiceSetStyle() const;
         void SetChoiceSetStyle(const ChoiceSetStyle choiceSetStyle);
 
+        // Parsed choices are stored columnar, and turned into ChoiceInput objects by the non-const GetChoices(), as
+        // FactSet's facts are. Const access leaves the columns as they are.
         std::vector<std::shared_ptr<ChoiceInput>>& GetChoices();
         const std::vector<std::shared_ptr<ChoiceInput>>& GetChoices() const;
 
+        std::size_t GetChoiceCount() const;
+        TitleValueView GetChoiceView(std::size_t index) const;
+
         std::string GetValue() const;
+        const std::string& GetValueRef() const;
         void SetValue(const std::string& value);
 
         bool GetWrap() const;
         void SetWrap(bool value);
 
+        // Optional lookup index for large choice sets, built while parsing when the choice count reaches
+        // ParseContext::GetChoiceIndexThreshold() or on demand with BuildChoiceIndex(). The queries below use it when
+        // present and fall back to linear scans otherwise. The non-const GetChoices() drops the index, since the
+        // choices may then be modified; call BuildChoiceIndex() again afterwards if it is still wanted.
+        void BuildChoiceIndex();
+        bool HasChoiceIndex() const;
+
+        // Index of the first choice with the given value, or ChoiceSetIndex::NoChoice
+        std::size_t FindChoiceByValue(const std::string& value) const;
+        // Indices of the choices whose title starts with prefix, ignoring (ASCII) case, in choice order
+        std::vector<std::size_t> FindChoicesByTitlePrefix(const std::string& prefix) const;
+
+        // Whether value is one of the entries of the (comma-separated) current value
+        bool IsValueSelected(const std::string& value) const;
+        // Whether a submitted value names only existing choices, and at most one unless the set is multi-select
+        bool IsValidValue(const std::string& value) const;
+
     private:
+        struct ChoiceCache;
+
+        void DeepCopyMembers() override;
+        void PartChanged() override;
         void PopulateKnownPropertiesSet() override;
 
         bool m_wrap;
@@ -45,6 +77,14 @@ namespace AdaptiveSharedNamespace
         ChoiceSetStyle m_choiceSetStyle;
 
         std::vector<std::shared_ptr<ChoiceInput>> m_choices;
+        TitleValueColumns m_choiceColumns;
+        // read-only ChoiceInput objects of the columns; set while there are any
+        std::shared_ptr<ChoiceCache> m_choiceCache;
+
+        // shared between copies, as the index is never modified once built
+        std::shared_ptr<const ChoiceSetIndex> m_choiceIndex;
+        // entries of m_value, kept only while the set is indexed
+        std::unordered_set<std::string> m_selectedValues;
     };
 
     class ChoiceSetInputParser : public BaseCardElementParser
@@ -17,6 +17,7 @@ ContainerStyle CollectionTypeElement::GetStyle() const
 
 void CollectionTypeElement::SetStyle(const ContainerStyle value)
 {
+    MarkChanged();
     m_style = value;
 }
 
@@ -27,6 +28,7 @@ VerticalContentAlignment CollectionTypeElement::GetVerticalContentAlignment() co
 
 void CollectionTypeElement::SetVerticalContentAlignment(const VerticalContentAlignment value)
 {
+    MarkChanged();
     m_verticalContentAlignment = value;
 }
 
@@ -37,6 +39,7 @@ bool CollectionTypeElement::GetPadding() const
 
 void CollectionTypeElement::SetPadding(const bool value)
 {
+    MarkChanged();
     m_hasPadding = value;
 }
 
@@ -62,6 +65,7 @@ bool CollectionTypeElement::GetBleed() const
 
 void CollectionTypeElement::SetBleed(const bool value)
 {
+    MarkChanged();
     m_hasBleed = value;
 }
 
@@ -80,6 +84,7 @@ void CollectionTypeElement::ConfigBleed(const AdaptiveCards::ParseContext& conte
 
 void CollectionTypeElement::SetCanBleed(const bool value)
 {
+    ThrowIfFrozen();
     m_canBleed = value;
 }
 
@@ -90,6 +95,7 @@ bool CollectionTypeElement::GetCanBleed() const
 
 void CollectionTypeElement::SetParentalId(const AdaptiveSharedNamespace::InternalId &id)
 {
+    ThrowIfFrozen();
     m_parentalId = id;
 }
 
@@ -112,6 +118,7 @@ std::shared_ptr<BackgroundImage> CollectionTypeElement::GetBackgroundImage() con
 
 void CollectionTypeElement::SetBackgroundImage(const std::shared_ptr<BackgroundImage> value)
 {
+    MarkChanged();
     m_backgroundImage = value;
 }
 
@@ -122,6 +129,7 @@ std::shared_ptr<BaseActionElement> CollectionTypeElement::GetSelectAction() cons
 
 void CollectionTypeElement::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 {
+    MarkChanged();
     m_selectAction = action;
 }
 
@@ -135,7 +143,7 @@ Json::Value CollectionTypeElement::SerializeToJsonValue() const
             BaseCardElement::SerializeSelectAction(m_selectAction);
     }
 
-    if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrl().empty())
+    if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrlRef().empty())
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage)] = m_backgroundImage->SerializeToJsonValue();
     }
@@ -158,3 +166,42 @@ Json::Value CollectionTypeElement::SerializeToJsonValue() const
 
     return root;
 }
+
+void CollectionTypeElement::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    if (m_selectAction != nullptr)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::SelectAction, NestedVisitor::NoIndex, *m_selectAction);
+    }
+    if (m_backgroundImage != nullptr)
+    {
+        visitor.Part(*m_backgroundImage);
+    }
+}
+
+void CollectionTypeElement::Freeze()
+{
+    if (m_backgroundImage != nullptr)
+    {
+        m_partOwner.Link(*this, *m_backgroundImage);
+    }
+    if (m_selectAction != nullptr)
+    {
+        m_selectAction->Freeze();
+    }
+    BaseCardElement::Freeze();
+}
+
+void CollectionTypeElement::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    if (m_backgroundImage != nullptr)
+    {
+        m_backgroundImage = std::make_shared<BackgroundImage>(*m_backgroundImage);
+    }
+    if (m_selectAction != nullptr)
+    {
+        m_selectAction = std::static_pointer_cast<BaseActionElement>(m_selectAction->Clone());
+    }
+}
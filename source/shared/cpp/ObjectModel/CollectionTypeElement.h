@@ -54,8 +54,13 @@ namespace AdaptiveSharedNamespace
         virtual void DeserializeChildren(AdaptiveCards::ParseContext& context, const Json::Value& value) = 0;
 
         Json::Value SerializeToJsonValue() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
         template<typename T> static std::shared_ptr<T> Deserialize(ParseContext& context, const Json::Value& value);
 
+    protected:
+        void DeepCopyMembers() override;
+
     private:
         void SetCanBleed(const bool value);
 
@@ -81,7 +86,7 @@ namespace AdaptiveSharedNamespace
     {
         auto collection = BaseCardElement::Deserialize<T>(context, value);
 
-        auto backgroundImage = ParseUtil::GetBackgroundImage(value);
+        auto backgroundImage = ParseUtil::GetBackgroundImage(context, value);
         collection->SetBackgroundImage(backgroundImage);
 
         collection->SetStyle(
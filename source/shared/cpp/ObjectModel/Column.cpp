@@ -8,7 +8,6 @@ using namespace AdaptiveSharedNamespace;
 
 Column::Column() : CollectionTypeElement(CardElementType::Column), m_width("Auto"), m_pixelWidth(0)
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::string Column::GetWidth() const
@@ -16,8 +15,14 @@ std::string Column::GetWidth() const
     return m_width;
 }
 
+const std::string& Column::GetWidthRef() const
+{
+    return m_width;
+}
+
 void Column::SetWidth(const std::string& value)
 {
+    MarkChanged();
     SetWidth(value, nullptr);
 }
 
@@ -37,6 +42,7 @@ int Column::GetPixelWidth() const
 
 void Column::SetPixelWidth(const int value)
 {
+    MarkChanged();
     m_pixelWidth = value;
 }
 
@@ -47,6 +53,7 @@ const std::vector<std::shared_ptr<BaseCardElement>>& Column::GetItems() const
 
 std::vector<std::shared_ptr<BaseCardElement>>& Column::GetItems()
 {
+    ThrowIfFrozen();
     return m_items;
 }
 
@@ -68,7 +75,7 @@ Json::Value Column::SerializeToJsonValue() const
     root[propertyName] = Json::Value(Json::arrayValue);
     for (const auto& cardElement : m_items)
     {
-        root[propertyName].append(cardElement->SerializeToJsonValue());
+        root[propertyName].append(SerializeNested(*cardElement));
     }
 
     return root;
@@ -76,6 +83,7 @@ Json::Value Column::SerializeToJsonValue() const
 
 std::shared_ptr<Column> Column::Deserialize(ParseContext& context, const Json::Value& value)
 {
+    const std::size_t ordinal = context.NextElementOrdinal();
     auto column = CollectionTypeElement::Deserialize<Column>(context, value);
 
     std::string columnWidth = ParseUtil::GetValueAsString(value, AdaptiveCardSchemaKey::Width);
@@ -87,6 +95,9 @@ std::shared_ptr<Column> Column::Deserialize(ParseContext& context, const Json::V
 
     column->SetWidth(columnWidth, &context.warnings);
 
+    // Columns aren't parsed through a registered (wrapped) parser, so index them here
+    context.AddToElementIndex(column, ordinal);
+
     return column;
 }
 
@@ -104,6 +115,8 @@ std::shared_ptr<Column> Column::DeserializeFromString(ParseContext& context, con
 
 void Column::PopulateKnownPropertiesSet()
 {
+    CollectionTypeElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Items),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Width),
@@ -113,7 +126,39 @@ void Column::PopulateKnownPropertiesSet()
 
 void Column::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto columnItems = GetItems();
+    const auto& columnItems = m_items;
     CollectionTypeElement::GetResourceInformation<BaseCardElement>(resourceInfo, columnItems);
     return;
 }
+
+void Column::VisitNested(NestedVisitor& visitor) const
+{
+    CollectionTypeElement::VisitNested(visitor);
+    for (unsigned int i = 0; i < m_items.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Items, i, *m_items[i]);
+    }
+}
+
+void Column::Freeze()
+{
+    for (const auto& item : m_items)
+    {
+        item->Freeze();
+    }
+    CollectionTypeElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> Column::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void Column::DeepCopyMembers()
+{
+    CollectionTypeElement::DeepCopyMembers();
+    for (auto& item : m_items)
+    {
+        item = std::static_pointer_cast<BaseCardElement>(item->Clone());
+    }
+}
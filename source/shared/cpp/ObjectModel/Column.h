@@ -17,6 +17,9 @@ namespace AdaptiveSharedNamespace
 
         std::string Serialize() const override;
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         static std::shared_ptr<Column> Deserialize(ParseContext& context, const Json::Value& root);
 
@@ -25,6 +28,7 @@ namespace AdaptiveSharedNamespace
         void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
         std::string GetWidth() const;
+        const std::string& GetWidthRef() const;
         void SetWidth(const std::string& value);
 
         // explicit width takes precedence over relative width
@@ -37,6 +41,7 @@ namespace AdaptiveSharedNamespace
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
         void SetWidth(const std::string& value,
                       std::vector<std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCardParseWarning>>* warnings);
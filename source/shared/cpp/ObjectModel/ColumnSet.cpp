@@ -10,7 +10,6 @@ using namespace AdaptiveSharedNamespace;
 ColumnSet::ColumnSet() :
     CollectionTypeElement(CardElementType::ColumnSet)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns() const
@@ -20,6 +19,7 @@ const std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns() const
 
 std::vector<std::shared_ptr<Column>>& ColumnSet::GetColumns()
 {
+    ThrowIfFrozen();
     return m_columns;
 }
 
@@ -31,7 +31,7 @@ Json::Value ColumnSet::SerializeToJsonValue() const
     root[propertyName] = Json::Value(Json::arrayValue);
     for (const auto& column : m_columns)
     {
-        root[propertyName].append(column->SerializeToJsonValue());
+        root[propertyName].append(SerializeNested(*column));
     }
 
     return root;
@@ -61,6 +61,8 @@ std::shared_ptr<BaseCardElement> ColumnSetParser::DeserializeFromString(ParseCon
 
 void ColumnSet::PopulateKnownPropertiesSet()
 {
+    CollectionTypeElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Columns),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style)});
@@ -68,7 +70,39 @@ void ColumnSet::PopulateKnownPropertiesSet()
 
 void ColumnSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto columns = GetColumns();
+    const auto& columns = m_columns;
     CollectionTypeElement::GetResourceInformation<Column>(resourceInfo, columns);
     return;
 }
+
+void ColumnSet::VisitNested(NestedVisitor& visitor) const
+{
+    CollectionTypeElement::VisitNested(visitor);
+    for (unsigned int i = 0; i < m_columns.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Columns, i, *m_columns[i]);
+    }
+}
+
+void ColumnSet::Freeze()
+{
+    for (const auto& column : m_columns)
+    {
+        column->Freeze();
+    }
+    CollectionTypeElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> ColumnSet::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void ColumnSet::DeepCopyMembers()
+{
+    CollectionTypeElement::DeepCopyMembers();
+    for (auto& column : m_columns)
+    {
+        column = std::static_pointer_cast<Column>(column->Clone());
+    }
+}
@@ -20,6 +20,9 @@ namespace AdaptiveSharedNamespace
         ~ColumnSet() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
         void DeserializeChildren(ParseContext& context, const Json::Value& value) override;
 
         std::vector<std::shared_ptr<Column>>& GetColumns();
@@ -28,6 +31,7 @@ namespace AdaptiveSharedNamespace
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
 
         std::vector<std::shared_ptr<Column>> m_columns;
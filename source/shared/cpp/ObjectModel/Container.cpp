@@ -9,7 +9,6 @@ using namespace AdaptiveSharedNamespace;
 
 Container::Container() : CollectionTypeElement(CardElementType::Container)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<BaseCardElement>>& Container::GetItems() const
@@ -19,6 +18,7 @@ const std::vector<std::shared_ptr<BaseCardElement>>& Container::GetItems() const
 
 std::vector<std::shared_ptr<BaseCardElement>>& Container::GetItems()
 {
+    ThrowIfFrozen();
     return m_items;
 }
 
@@ -29,7 +29,7 @@ Json::Value Container::SerializeToJsonValue() const
     root[itemsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& cardElement : m_items)
     {
-        root[itemsPropertyName].append(cardElement->SerializeToJsonValue());
+        root[itemsPropertyName].append(SerializeNested(*cardElement));
     }
 
     return root;
@@ -58,6 +58,8 @@ std::shared_ptr<BaseCardElement> ContainerParser::DeserializeFromString(ParseCon
 
 void Container::PopulateKnownPropertiesSet()
 {
+    CollectionTypeElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::VerticalContentAlignment),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::SelectAction),
@@ -66,7 +68,39 @@ void Container::PopulateKnownPropertiesSet()
 
 void Container::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto items = GetItems();
+    const auto& items = m_items;
     CollectionTypeElement::GetResourceInformation<BaseCardElement>(resourceInfo, items);
     return;
 }
+
+void Container::VisitNested(NestedVisitor& visitor) const
+{
+    CollectionTypeElement::VisitNested(visitor);
+    for (unsigned int i = 0; i < m_items.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Items, i, *m_items[i]);
+    }
+}
+
+void Container::Freeze()
+{
+    for (const auto& item : m_items)
+    {
+        item->Freeze();
+    }
+    CollectionTypeElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> Container::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void Container::DeepCopyMembers()
+{
+    CollectionTypeElement::DeepCopyMembers();
+    for (auto& item : m_items)
+    {
+        item = std::static_pointer_cast<BaseCardElement>(item->Clone());
+    }
+}
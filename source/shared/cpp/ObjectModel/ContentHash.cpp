@@ -0,0 +1,292 @@
+#include "pch.h"
+#include <cstring>
+#include "ContentHash.h"
+
+namespace
+{
+    constexpr std::uint64_t c_c1 = 0x87c37b91114253d5ULL;
+    constexpr std::uint64_t c_c2 = 0x4cf5ad432745937fULL;
+
+    // Type tags keep values of different json types from colliding (e.g. "1" and 1)
+    enum class JsonHashTag : unsigned char
+    {
+        Null = 'n',
+        False = 'f',
+        True = 't',
+        Int = 'i',
+        UInt = 'u',
+        Real = 'd',
+        String = 's',
+        Array = 'a',
+        Object = 'o'
+    };
+
+    inline std::uint64_t RotateLeft(std::uint64_t value, int shift) { return (value << shift) | (value >> (64 - shift)); }
+
+    inline std::uint64_t FinalMix(std::uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    // Read little-endian regardless of host byte order so hashes are stable across platforms
+    inline std::uint64_t ReadUInt64(const unsigned char* bytes)
+    {
+        std::uint64_t value = 0;
+        for (int i = 7; i >= 0; --i)
+        {
+            value = (value << 8) | bytes[i];
+        }
+        return value;
+    }
+
+    inline void AppendTag(AdaptiveSharedNamespace::ContentHasher& hasher, JsonHashTag tag)
+    {
+        const unsigned char tagByte = static_cast<unsigned char>(tag);
+        hasher.Append(&tagByte, 1);
+    }
+}
+
+namespace AdaptiveSharedNamespace
+{
+    std::string ContentHash::ToString() const
+    {
+        static const char* const hexDigits = "0123456789abcdef";
+        std::string result(32, '0');
+        for (int i = 0; i < 16; ++i)
+        {
+            result[15 - i] = hexDigits[(high >> (i * 4)) & 0xF];
+            result[31 - i] = hexDigits[(low >> (i * 4)) & 0xF];
+        }
+        return result;
+    }
+
+    ContentHasher::ContentHasher() : m_h1(0), m_h2(0), m_length(0), m_buffer{}, m_bufferLength(0) {}
+
+    void ContentHasher::ProcessBlock(const unsigned char* block)
+    {
+        std::uint64_t k1 = ReadUInt64(block);
+        std::uint64_t k2 = ReadUInt64(block + 8);
+
+        k1 *= c_c1;
+        k1 = RotateLeft(k1, 31);
+        k1 *= c_c2;
+        m_h1 ^= k1;
+
+        m_h1 = RotateLeft(m_h1, 27);
+        m_h1 += m_h2;
+        m_h1 = m_h1 * 5 + 0x52dce729;
+
+        k2 *= c_c2;
+        k2 = RotateLeft(k2, 33);
+        k2 *= c_c1;
+        m_h2 ^= k2;
+
+        m_h2 = RotateLeft(m_h2, 31);
+        m_h2 += m_h1;
+        m_h2 = m_h2 * 5 + 0x38495ab5;
+    }
+
+    ContentHasher& ContentHasher::Append(const void* data, std::size_t length)
+    {
+        const unsigned char* bytes = static_cast<const unsigned char*>(data);
+        m_length += length;
+
+        // top up a partially filled block first
+        if (m_bufferLength != 0)
+        {
+            const std::size_t toCopy = std::min(length, sizeof(m_buffer) - m_bufferLength);
+            std::copy(bytes, bytes + toCopy, m_buffer + m_bufferLength);
+            m_bufferLength += toCopy;
+            bytes += toCopy;
+            length -= toCopy;
+
+            if (m_bufferLength < sizeof(m_buffer))
+            {
+                return *this;
+            }
+
+            ProcessBlock(m_buffer);
+            m_bufferLength = 0;
+        }
+
+        while (length >= sizeof(m_buffer))
+        {
+            ProcessBlock(bytes);
+            bytes += sizeof(m_buffer);
+            length -= sizeof(m_buffer);
+        }
+
+        std::copy(bytes, bytes + length, m_buffer);
+        m_bufferLength = length;
+        return *this;
+    }
+
+    ContentHasher& ContentHasher::Append(const std::string& value)
+    {
+        // length prefix so that ("ab", "c") and ("a", "bc") differ
+        Append(static_cast<std::uint64_t>(value.size()));
+        return Append(value.data(), value.size());
+    }
+
+    ContentHasher& ContentHasher::Append(std::uint64_t value)
+    {
+        unsigned char bytes[8];
+        for (int i = 0; i < 8; ++i)
+        {
+            bytes[i] = static_cast<unsigned char>(value >> (i * 8));
+        }
+        return Append(bytes, sizeof(bytes));
+    }
+
+    ContentHasher& ContentHasher::Append(const ContentHash& value)
+    {
+        Append(value.high);
+        return Append(value.low);
+    }
+
+    ContentHasher& ContentHasher::Append(const Json::Value& value)
+    {
+        switch (value.type())
+        {
+        case Json::nullValue:
+            AppendTag(*this, JsonHashTag::Null);
+            break;
+        case Json::booleanValue:
+            AppendTag(*this, value.asBool() ? JsonHashTag::True : JsonHashTag::False);
+            break;
+        case Json::intValue:
+        case Json::uintValue:
+        case Json::realValue:
+            if (value.isInt64())
+            {
+                AppendTag(*this, JsonHashTag::Int);
+                Append(static_cast<std::uint64_t>(value.asInt64()));
+            }
+            else if (value.isUInt64())
+            {
+                AppendTag(*this, JsonHashTag::UInt);
+                Append(static_cast<std::uint64_t>(value.asUInt64()));
+            }
+            else
+            {
+                const double realValue = value.asDouble();
+                std::uint64_t bits;
+                static_assert(sizeof(bits) == sizeof(realValue), "unexpected double size");
+                std::memcpy(&bits, &realValue, sizeof(bits));
+                AppendTag(*this, JsonHashTag::Real);
+                Append(bits);
+            }
+            break;
+        case Json::stringValue:
+            AppendTag(*this, JsonHashTag::String);
+            Append(value.asString());
+            break;
+        case Json::arrayValue:
+            // Nested values contribute their own hash rather than their bytes. This keeps hashes of subtrees
+            // composable: a parent can be hashed from the already computed hashes of its children.
+            AppendTag(*this, JsonHashTag::Array);
+            Append(static_cast<std::uint64_t>(value.size()));
+            for (const auto& item : value)
+            {
+                Append(ContentHashUtil::HashJson(item));
+            }
+            break;
+        case Json::objectValue:
+            // jsoncpp keeps object members in a sorted map, so iteration order is already canonical
+            AppendTag(*this, JsonHashTag::Object);
+            Append(static_cast<std::uint64_t>(value.size()));
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                Append(it.name());
+                Append(ContentHashUtil::HashJson(*it));
+            }
+            break;
+        }
+        return *this;
+    }
+
+    ContentHash ContentHasher::Finish() const
+    {
+        std::uint64_t h1 = m_h1;
+        std::uint64_t h2 = m_h2;
+        std::uint64_t k1 = 0;
+        std::uint64_t k2 = 0;
+
+        // tail (fewer than 16 bytes left in the buffer)
+        for (std::size_t i = m_bufferLength; i > 8; --i)
+        {
+            k2 = (k2 << 8) | m_buffer[i - 1];
+        }
+        for (std::size_t i = std::min<std::size_t>(m_bufferLength, 8); i > 0; --i)
+        {
+            k1 = (k1 << 8) | m_buffer[i - 1];
+        }
+
+        if (m_bufferLength > 8)
+        {
+            k2 *= c_c2;
+            k2 = RotateLeft(k2, 33);
+            k2 *= c_c1;
+            h2 ^= k2;
+        }
+        if (m_bufferLength > 0)
+        {
+            k1 *= c_c1;
+            k1 = RotateLeft(k1, 31);
+            k1 *= c_c2;
+            h1 ^= k1;
+        }
+
+        h1 ^= m_length;
+        h2 ^= m_length;
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = FinalMix(h1);
+        h2 = FinalMix(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        return ContentHash(h1, h2);
+    }
+
+    ContentHash ContentHashUtil::HashJson(const Json::Value& value)
+    {
+        ContentHasher hasher;
+        hasher.Append(value);
+        return hasher.Finish();
+    }
+
+    ContentHash ContentHashUtil::HashArray(const std::vector<ContentHash>& itemHashes)
+    {
+        ContentHasher hasher;
+        AppendTag(hasher, JsonHashTag::Array);
+        hasher.Append(static_cast<std::uint64_t>(itemHashes.size()));
+        for (const auto& itemHash : itemHashes)
+        {
+            hasher.Append(itemHash);
+        }
+        return hasher.Finish();
+    }
+
+    ContentHash ContentHashUtil::HashObject(const std::map<std::string, ContentHash>& memberHashes)
+    {
+        ContentHasher hasher;
+        AppendTag(hasher, JsonHashTag::Object);
+        hasher.Append(static_cast<std::uint64_t>(memberHashes.size()));
+        // std::map and jsoncpp both order members by name
+        for (const auto& member : memberHashes)
+        {
+            hasher.Append(member.first);
+            hasher.Append(member.second);
+        }
+        return hasher.Finish();
+    }
+}
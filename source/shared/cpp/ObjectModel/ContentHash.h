@@ -0,0 +1,70 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // 128-bit content hash. Two values that are equal according to the canonical form of the object model produce the
+    // same hash; the inverse holds with overwhelming probability.
+    struct ContentHash
+    {
+        std::uint64_t high;
+        std::uint64_t low;
+
+        ContentHash() : high(0), low(0) {}
+        ContentHash(std::uint64_t highBits, std::uint64_t lowBits) : high(highBits), low(lowBits) {}
+
+        bool IsEmpty() const { return high == 0 && low == 0; }
+
+        // Returns the hash as 32 lowercase hex digits (high bits first)
+        std::string ToString() const;
+
+        bool operator==(const ContentHash& other) const { return high == other.high && low == other.low; }
+        bool operator!=(const ContentHash& other) const { return !(*this == other); }
+    };
+
+    struct ContentHashKeyHash
+    {
+        std::size_t operator()(const ContentHash& hash) const { return static_cast<std::size_t>(hash.low ^ hash.high); }
+    };
+
+    // Streaming MurmurHash3 (x64, 128-bit). Bytes may be appended in any chunking; the result only depends on the
+    // concatenated input.
+    class ContentHasher
+    {
+    public:
+        ContentHasher();
+
+        ContentHasher& Append(const void* data, std::size_t length);
+        ContentHasher& Append(const std::string& value);
+        ContentHasher& Append(std::uint64_t value);
+        ContentHasher& Append(const ContentHash& value);
+
+        // Appends the canonical form of a json value. Object members are visited in sorted key order and integral
+        // numbers are hashed by value regardless of how the producer spelled them (1, 1.0 and 1e0 hash alike).
+        ContentHasher& Append(const Json::Value& value);
+
+        ContentHash Finish() const;
+
+    private:
+        void ProcessBlock(const unsigned char* block);
+
+        std::uint64_t m_h1;
+        std::uint64_t m_h2;
+        std::uint64_t m_length;
+        unsigned char m_buffer[16];
+        std::size_t m_bufferLength;
+    };
+
+    namespace ContentHashUtil
+    {
+        // Hash of the canonical form of a json value (see ContentHasher::Append(const Json::Value&))
+        ContentHash HashJson(const Json::Value& value);
+
+        // Hash of a json array whose items hash to itemHashes. Equal to HashJson() of that array.
+        ContentHash HashArray(const std::vector<ContentHash>& itemHashes);
+
+        // Hash of a json object whose members hash to memberHashes. Equal to HashJson() of that object.
+        ContentHash HashObject(const std::map<std::string, ContentHash>& memberHashes);
+    }
+}
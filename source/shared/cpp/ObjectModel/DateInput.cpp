@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 DateInput::DateInput() : BaseInputElement(CardElementType::DateInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value DateInput::SerializeToJsonValue() const
@@ -41,8 +40,14 @@ std::string DateInput::GetMax() const
     return m_max;
 }
 
+const std::string& DateInput::GetMaxRef() const
+{
+    return m_max;
+}
+
 void DateInput::SetMax(const std::string& value)
 {
+    MarkChanged();
     m_max = value;
 }
 
@@ -51,8 +56,14 @@ std::string DateInput::GetMin() const
     return m_min;
 }
 
+const std::string& DateInput::GetMinRef() const
+{
+    return m_min;
+}
+
 void DateInput::SetMin(const std::string& value)
 {
+    MarkChanged();
     m_min = value;
 }
 
@@ -61,8 +72,14 @@ std::string DateInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+const std::string& DateInput::GetPlaceholderRef() const
+{
+    return m_placeholder;
+}
+
 void DateInput::SetPlaceholder(const std::string& value)
 {
+    MarkChanged();
     m_placeholder = value;
 }
 
@@ -71,8 +88,14 @@ std::string DateInput::GetValue() const
     return m_value;
 }
 
+const std::string& DateInput::GetValueRef() const
+{
+    return m_value;
+}
+
 void DateInput::SetValue(const std::string& value)
 {
+    MarkChanged();
     m_value = value;
 }
 
@@ -97,8 +120,15 @@ std::shared_ptr<BaseCardElement> DateInputParser::DeserializeFromString(ParseCon
 
 void DateInput::PopulateKnownPropertiesSet()
 {
+    BaseInputElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder)});
 }
+
+std::shared_ptr<BaseElement> DateInput::Clone() const
+{
+    return MakeClone(*this);
+}
@@ -16,17 +16,22 @@ namespace AdaptiveSharedNamespace
         ~DateInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
 
         std::string GetMax() const;
+        const std::string& GetMaxRef() const;
         void SetMax(const std::string& value);
 
         std::string GetMin() const;
+        const std::string& GetMinRef() const;
         void SetMin(const std::string& value);
 
         std::string GetPlaceholder() const;
+        const std::string& GetPlaceholderRef() const;
         void SetPlaceholder(const std::string& value);
 
         std::string GetValue() const;
+        const std::string& GetValueRef() const;
         void SetValue(const std::string& value);
 
     private:
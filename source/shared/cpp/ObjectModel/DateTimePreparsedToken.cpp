@@ -23,6 +23,11 @@ std::string DateTimePreparsedToken::GetText() const
     return m_text;
 }
 
+const std::string& DateTimePreparsedToken::GetTextRef() const
+{
+    return m_text;
+}
+
 DateTimePreparsedTokenFormat DateTimePreparsedToken::GetFormat() const
 {
     return m_format;
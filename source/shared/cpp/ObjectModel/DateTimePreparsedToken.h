@@ -11,6 +11,7 @@ namespace AdaptiveSharedNamespace
         DateTimePreparsedToken(std::string const& text, struct tm date, DateTimePreparsedTokenFormat format);
 
         std::string GetText() const;
+        const std::string& GetTextRef() const;
         DateTimePreparsedTokenFormat GetFormat() const;
         // returns values 1-31
         int GetDay() const;
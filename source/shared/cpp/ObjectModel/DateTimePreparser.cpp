@@ -53,7 +53,7 @@ std::string DateTimePreparser::Concatenate() const
     std::string formedString;
     for (const auto& piece : m_textTokenCollection)
     {
-        formedString += piece->GetText();
+        formedString += piece->GetTextRef();
     }
     return formedString;
 }
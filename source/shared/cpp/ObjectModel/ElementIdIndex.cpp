@@ -0,0 +1,120 @@
+#include "pch.h"
+#include "ElementIdIndex.h"
+#include "BaseActionElement.h"
+#include "BaseCardElement.h"
+
+namespace AdaptiveSharedNamespace
+{
+    void ElementIdIndex::Add(const std::shared_ptr<BaseCardElement>& element, std::size_t ordinal, bool ownsId)
+    {
+        if (element != nullptr)
+        {
+            // GetId is virtual so that custom element wrappers report their own id
+            Add(element->GetId(), element->GetElementTypeStringRef(), element, false, ordinal, ownsId);
+        }
+    }
+
+    void ElementIdIndex::Add(const std::shared_ptr<BaseActionElement>& action, std::size_t ordinal, bool ownsId)
+    {
+        if (action != nullptr)
+        {
+            Add(action->GetId(), action->GetElementTypeStringRef(), action, true, ordinal, ownsId);
+        }
+    }
+
+    void ElementIdIndex::Add(const std::string& id,
+                             const std::string& type,
+                             const std::shared_ptr<BaseElement>& element,
+                             bool isAction,
+                             std::size_t ordinal,
+                             bool ownsId)
+    {
+        if (!id.empty() && ownsId)
+        {
+            // elements are added as they finish parsing, i.e. after their fallback content, so a parent replaces the
+            // fallback element that shares its id
+            Entry& entry = m_entries[id];
+            entry.element = element;
+            entry.isAction = isAction;
+        }
+
+        // Elements finish parsing after their descendants, so an element can arrive after same-typed elements nested in
+        // it. Those are the only ones it has to move in front of, which keeps insertion cheap.
+        auto& elementsOfType = m_elementsByType[type];
+        auto position = elementsOfType.end();
+        while (position != elementsOfType.begin() && (position - 1)->ordinal > ordinal)
+        {
+            --position;
+        }
+        elementsOfType.insert(position, IndexedElement{ordinal, element, isAction});
+    }
+
+    bool ElementIdIndex::Replace(const std::shared_ptr<BaseElement>& previous, const std::shared_ptr<BaseElement>& element, bool ownsId)
+    {
+        const auto elementsOfType = m_elementsByType.find(previous->GetElementTypeStringRef());
+        if (elementsOfType == m_elementsByType.end())
+        {
+            return false;
+        }
+        const auto isPrevious = [&previous](const IndexedElement& indexedElement) {
+            return !indexedElement.element.owner_before(previous) && !previous.owner_before(indexedElement.element);
+        };
+        const auto indexed = std::find_if(elementsOfType->second.begin(), elementsOfType->second.end(), isPrevious);
+        if (indexed == elementsOfType->second.end())
+        {
+            return false;
+        }
+        indexed->element = element;
+
+        const auto entry = m_entries.find(previous->GetId());
+        if (entry != m_entries.end() && entry->second.element.lock() == previous)
+        {
+            m_entries.erase(entry);
+        }
+        const std::string id = element->GetId();
+        if (!id.empty() && ownsId)
+        {
+            m_entries[id] = Entry{element, indexed->isAction};
+        }
+        return true;
+    }
+
+    std::shared_ptr<BaseElement> ElementIdIndex::Find(const std::string& id) const
+    {
+        const auto entry = m_entries.find(id);
+        return (entry == m_entries.end()) ? nullptr : entry->second.element.lock();
+    }
+
+    std::shared_ptr<BaseCardElement> ElementIdIndex::FindCardElement(const std::string& id) const
+    {
+        const auto entry = m_entries.find(id);
+        if (entry == m_entries.end() || entry->second.isAction)
+        {
+            return nullptr;
+        }
+        return std::static_pointer_cast<BaseCardElement>(entry->second.element.lock());
+    }
+
+    std::shared_ptr<BaseActionElement> ElementIdIndex::FindAction(const std::string& id) const
+    {
+        const auto entry = m_entries.find(id);
+        if (entry == m_entries.end() || !entry->second.isAction)
+        {
+            return nullptr;
+        }
+        return std::static_pointer_cast<BaseActionElement>(entry->second.element.lock());
+    }
+
+    const std::vector<IndexedElement>& ElementIdIndex::FindByType(const std::string& type) const
+    {
+        static const std::vector<IndexedElement> noElements;
+        const auto elementsOfType = m_elementsByType.find(type);
+        return (elementsOfType == m_elementsByType.end()) ? noElements : elementsOfType->second;
+    }
+
+    void ElementIdIndex::Clear()
+    {
+        m_entries.clear();
+        m_elementsByType.clear();
+    }
+}
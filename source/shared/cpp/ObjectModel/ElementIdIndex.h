@@ -0,0 +1,71 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class BaseElement;
+    class BaseCardElement;
+    class BaseActionElement;
+
+    // An indexed element together with its position in parse order, which is the pre-order of the card graph with
+    // fallback content ahead of an element's other children (see CardTraversal.h)
+    struct IndexedElement
+    {
+        std::size_t ordinal;
+        std::weak_ptr<BaseElement> element;
+        bool isAction;
+    };
+
+    // Maps element and action ids to the objects that carry them, and element types to lists of elements in parse
+    // order. The index is filled while a card is parsed (see ParseContext) and holds weak references, so it never keeps
+    // an element alive: lookups for elements that have since been removed from the card and released return null.
+    //
+    // Ids are unique within a card except where fallback content shares its parent's id; the index then refers to the
+    // parent, which is the element rendered by default.
+    class ElementIdIndex
+    {
+    public:
+        // ordinal is the element's position in parse order, taken before its children were parsed. ownsId is false for
+        // fallback content that shares its parent's id, where the parent is indexed under the id instead.
+        void Add(const std::shared_ptr<BaseCardElement>& element, std::size_t ordinal, bool ownsId = true);
+        void Add(const std::shared_ptr<BaseActionElement>& action, std::size_t ordinal, bool ownsId = true);
+
+        // Puts element, which has taken previous's place in the card and is of the same type, in previous's place in
+        // the index. Returns false, changing nothing, if previous isn't indexed.
+        bool Replace(const std::shared_ptr<BaseElement>& previous, const std::shared_ptr<BaseElement>& element, bool ownsId);
+
+        // Returns the element or action with the given id, or null
+        std::shared_ptr<BaseElement> Find(const std::string& id) const;
+
+        // As Find, but only returns card elements or actions respectively
+        std::shared_ptr<BaseCardElement> FindCardElement(const std::string& id) const;
+        std::shared_ptr<BaseActionElement> FindAction(const std::string& id) const;
+
+        // Every element and action of the given type (e.g. "Input.Text" or "Action.Submit"), in parse order
+        const std::vector<IndexedElement>& FindByType(const std::string& type) const;
+        const std::unordered_map<std::string, std::vector<IndexedElement>>& GetElementsByType() const { return m_elementsByType; }
+
+        // Number of distinct ids
+        std::size_t Size() const { return m_entries.size(); }
+        bool IsEmpty() const { return m_entries.empty() && m_elementsByType.empty(); }
+        void Clear();
+
+    private:
+        struct Entry
+        {
+            std::weak_ptr<BaseElement> element;
+            bool isAction;
+        };
+
+        void Add(const std::string& id,
+                 const std::string& type,
+                 const std::shared_ptr<BaseElement>& element,
+                 bool isAction,
+                 std::size_t ordinal,
+                 bool ownsId);
+
+        std::unordered_map<std::string, Entry> m_entries;
+        std::unordered_map<std::string, std::vector<IndexedElement>> m_elementsByType;
+    };
+}
@@ -17,6 +17,11 @@
 #include "ToggleInput.h"
 #include "UnknownElement.h"
 
+namespace
+{
+    std::atomic<std::uint64_t> s_lastFingerprint{0};
+}
+
 namespace AdaptiveSharedNamespace
 {
     BaseCardElementParserWrapper::BaseCardElementParserWrapper(std::shared_ptr<BaseCardElementParser> parserToWrap) :
@@ -28,11 +33,17 @@ namespace AdaptiveSharedNamespace
     {
         const auto& idProperty = ParseUtil::GetString(value, AdaptiveCardSchemaKey::Id);
         const InternalId internalId = InternalId::Next();
+        const std::size_t ordinal = context.NextElementOrdinal();
 
         context.PushElement(idProperty, internalId);
         std::shared_ptr<BaseCardElement> element = m_parser->Deserialize(context, value);
         context.PopElement();
 
+        if (element != nullptr)
+        {
+            context.AddToElementIndex(element, ordinal);
+        }
+
         return element;
     }
 
@@ -41,7 +52,7 @@ namespace AdaptiveSharedNamespace
         return Deserialize(context, ParseUtil::GetJsonValueFromString(value));
     }
 
-    ElementParserRegistration::ElementParserRegistration()
+    ElementParserRegistration::ElementParserRegistration() : m_fingerprint(0)
     {
         m_knownElements.insert({
             CardElementTypeToString(CardElementType::ActionSet),
@@ -79,13 +90,25 @@ namespace AdaptiveSharedNamespace
              {CardElementTypeToString(CardElementType::TimeInput), std::make_shared<TimeInputParser>()},
              {CardElementTypeToString(CardElementType::ToggleInput), std::make_shared<ToggleInputParser>()},
              {CardElementTypeToString(CardElementType::Unknown), std::make_shared<UnknownElementParser>()}});
+
+        // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
+        // collision detection. We *could* do this within the implementation of parsers themselves, but that would
+        // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
+        // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
+        // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
+        // The wrappers hold no parsing state, so each parser is wrapped once, when it is registered.
+        for (auto& parser : m_cardElementParsers)
+        {
+            parser.second = std::make_shared<BaseCardElementParserWrapper>(parser.second);
+        }
     }
 
     void ElementParserRegistration::AddParser(std::string const& elementType, std::shared_ptr<BaseCardElementParser> parser)
     {
         if (m_knownElements.find(elementType) == m_knownElements.end())
         {
-            ElementParserRegistration::m_cardElementParsers[elementType] = parser;
+            ElementParserRegistration::m_cardElementParsers[elementType] = std::make_shared<BaseCardElementParserWrapper>(parser);
+            m_fingerprint = ++s_lastFingerprint;
         }
         else
         {
@@ -99,6 +122,7 @@ namespace AdaptiveSharedNamespace
         if (m_knownElements.find(elementType) == m_knownElements.end())
         {
             ElementParserRegistration::m_cardElementParsers.erase(elementType);
+            m_fingerprint = ++s_lastFingerprint;
         }
         else
         {
@@ -112,17 +136,13 @@ namespace AdaptiveSharedNamespace
         auto parser = m_cardElementParsers.find(elementType);
         if (parser != ElementParserRegistration::m_cardElementParsers.end())
         {
-            // Why do we wrap the parser? As we parse elements, we need to push and pop state from the stack for ID
-            // collision detection. We *could* do this within the implementation of parsers themselves, but that would
-            // mean having to explain all of this to custom element parser implementors. Instead, we wrap every parser
-            // we hand out with a helper class that performs the push/pop on behalf of the element parser. For more
-            // details, refer to the giant comment on ID collision detection in ParseContext.cpp.
-            std::shared_ptr<BaseCardElementParser> wrappedParser = std::make_shared<BaseCardElementParserWrapper>(parser->second);
-            return wrappedParser;
+            return parser->second;
         }
         else
         {
             return std::shared_ptr<BaseCardElementParser>(nullptr);
         }
     }
+
+    std::uint64_t ElementParserRegistration::GetFingerprint() const { return m_fingerprint; }
 }
@@ -43,7 +43,13 @@ namespace AdaptiveSharedNamespace
         void RemoveParser(std::string const& elementType);
         std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser> GetParser(std::string const& elementType) const;
 
+        // Identifies the parsers registered here. Untouched registrations (built-in parsers only) share fingerprint 0;
+        // every AddParser/RemoveParser call moves to a value that is never handed out again, so equal fingerprints
+        // guarantee the same parsers.
+        std::uint64_t GetFingerprint() const;
+
     private:
+        std::uint64_t m_fingerprint;
         std::unordered_set<std::string> m_knownElements;
         std::unordered_map<std::string, std::shared_ptr<AdaptiveSharedNamespace::BaseCardElementParser>, CaseInsensitiveHash, CaseInsensitiveEqualTo> m_cardElementParsers;
     };
@@ -358,7 +358,9 @@ namespace AdaptiveSharedNamespace
         RequiredPropertyMissing,
         InvalidPropertyValue,
         UnsupportedParserOverride,
-        IdCollision
+        IdCollision,
+        FrozenObjectModification,
+        CloneNotSupported
     };
     // No mapping to string needed
 
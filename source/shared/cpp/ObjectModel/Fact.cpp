@@ -13,6 +13,10 @@ Fact::Fact(std::string const& title, std::string const& value) : m_title(title),
 {
 }
 
+Fact::Fact(std::string&& title, std::string&& value) : m_title(std::move(title)), m_value(std::move(value))
+{
+}
+
 std::shared_ptr<Fact> Fact::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::string title = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Title, true);
@@ -48,21 +52,45 @@ std::string Fact::GetTitle() const
     return m_title;
 }
 
+const std::string& Fact::GetTitleRef() const
+{
+    return m_title;
+}
+
 void Fact::SetTitle(const std::string& value)
 {
+    MarkChanged();
     m_title = value;
 }
 
+void Fact::SetTitle(std::string&& value)
+{
+    MarkChanged();
+    m_title = std::move(value);
+}
+
 std::string Fact::GetValue() const
 {
     return m_value;
 }
 
+const std::string& Fact::GetValueRef() const
+{
+    return m_value;
+}
+
 void Fact::SetValue(const std::string& value)
 {
+    MarkChanged();
     m_value = value;
 }
 
+void Fact::SetValue(std::string&& value)
+{
+    MarkChanged();
+    m_value = std::move(value);
+}
+
 DateTimePreparser Fact::GetTitleForDateParsing() const
 {
     return DateTimePreparser(m_title);
@@ -78,7 +106,13 @@ std::string Fact::GetLanguage() const
     return m_language;
 }
 
+const std::string& Fact::GetLanguageRef() const
+{
+    return m_language;
+}
+
 void Fact::SetLanguage(const std::string& value)
 {
+    MarkChanged();
     m_language = value;
 }
@@ -1,30 +1,37 @@
 #pragma once
 
 #include "pch.h"
+#include "BaseElement.h"
 #include "ElementParserRegistration.h"
 #include "DateTimePreparser.h"
 
 namespace AdaptiveSharedNamespace
 {
-    class Fact
+    class Fact : public ElementPart
     {
     public:
         Fact();
         Fact(std::string const& title, std::string const& value);
+        Fact(std::string&& title, std::string&& value);
 
         std::string Serialize();
         Json::Value SerializeToJsonValue();
 
         std::string GetTitle() const;
+        const std::string& GetTitleRef() const;
         void SetTitle(const std::string& value);
+        void SetTitle(std::string&& value);
 
         std::string GetValue() const;
+        const std::string& GetValueRef() const;
         void SetValue(const std::string& value);
+        void SetValue(std::string&& value);
         DateTimePreparser GetTitleForDateParsing() const;
         DateTimePreparser GetValueForDateParsing() const;
 
         void SetLanguage(const std::string& value);
         std::string GetLanguage() const;
+        const std::string& GetLanguageRef() const;
 
         static std::shared_ptr<Fact> Deserialize(ParseContext& context, const Json::Value& root);
         static std::shared_ptr<Fact> DeserializeFromString(ParseContext& context, const std::string& jsonString);
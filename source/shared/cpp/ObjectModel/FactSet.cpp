@@ -6,30 +6,162 @@
 
 using namespace AdaptiveSharedNamespace;
 
+// Fact objects made from the columns by the const GetFacts(). call_once makes the first call safe to race, as const
+// access may.
+struct FactSet::FactCache
+{
+    std::once_flag factsOnce;
+    std::vector<std::shared_ptr<Fact>> facts;
+};
+
 FactSet::FactSet() : BaseCardElement(CardElementType::FactSet)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<Fact>>& FactSet::GetFacts() const
 {
-    return m_facts;
+    if (m_factColumns.IsEmpty())
+    {
+        return m_facts;
+    }
+
+    std::call_once(m_factCache->factsOnce, [this]() {
+        auto& facts = m_factCache->facts;
+        facts.reserve(m_factColumns.Size());
+        for (std::size_t i = 0; i < m_factColumns.Size(); ++i)
+        {
+            const auto view = m_factColumns[i];
+            facts.push_back(MakeFact(view.GetTitle(), view.GetValue()));
+            ElementPartOwner::LinkReadOnly(*facts.back());
+        }
+    });
+    return m_factCache->facts;
 }
 
 std::vector<std::shared_ptr<Fact>>& FactSet::GetFacts()
 {
+    ThrowIfFrozen();
+    if (!m_factColumns.IsEmpty())
+    {
+        m_facts.reserve(m_facts.size() + m_factColumns.Size());
+        for (std::size_t i = 0; i < m_factColumns.Size(); ++i)
+        {
+            const auto view = m_factColumns[i];
+            m_facts.push_back(MakeFact(view.GetTitle(), view.GetValue()));
+        }
+        m_factColumns.Clear();
+        m_factCache = nullptr;
+    }
     return m_facts;
 }
 
+std::size_t FactSet::GetFactCount() const
+{
+    return m_factColumns.IsEmpty() ? m_facts.size() : m_factColumns.Size();
+}
+
+TitleValueView FactSet::GetFactView(std::size_t index) const
+{
+    if (m_factColumns.IsEmpty())
+    {
+        const auto& fact = *m_facts[index];
+        return TitleValueView(fact.GetTitleRef(), fact.GetValueRef());
+    }
+    return m_factColumns[index];
+}
+
+const std::string& FactSet::GetFactLanguageRef(std::size_t index) const
+{
+    return m_factColumns.IsEmpty() ? m_facts[index]->GetLanguageRef() : m_factLanguage;
+}
+
+void FactSet::SetFact(std::size_t index, const std::string& title, const std::string& value)
+{
+    MarkChanged();
+    if (m_factColumns.IsEmpty())
+    {
+        m_facts[index] = MakeFact(title, value);
+    }
+    else
+    {
+        m_factColumns.Replace(index, title, value);
+        m_factCache = std::make_shared<FactCache>();
+    }
+}
+
+void FactSet::InsertFact(std::size_t index, const std::string& title, const std::string& value)
+{
+    MarkChanged();
+    if (m_factColumns.IsEmpty())
+    {
+        m_facts.insert(m_facts.begin() + index, MakeFact(title, value));
+    }
+    else
+    {
+        m_factColumns.Insert(index, title, value);
+        m_factCache = std::make_shared<FactCache>();
+    }
+}
+
+void FactSet::RemoveFact(std::size_t index)
+{
+    MarkChanged();
+    if (m_factColumns.IsEmpty())
+    {
+        m_facts.erase(m_facts.begin() + index);
+    }
+    else
+    {
+        m_factColumns.Erase(index);
+        m_factCache = std::make_shared<FactCache>();
+    }
+}
+
+std::shared_ptr<Fact> FactSet::MakeFact(const std::string& title, const std::string& value) const
+{
+    auto fact = std::make_shared<Fact>(title, value);
+    fact->SetLanguage(m_factLanguage);
+    return fact;
+}
+
+void FactSet::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    for (const auto& fact : m_facts)
+    {
+        visitor.Part(*fact);
+    }
+}
+
+void FactSet::Freeze()
+{
+    if (!IsFrozen())
+    {
+        // links the facts, whose setters then throw; columnar facts stay columnar
+        for (const auto& fact : m_facts)
+        {
+            m_partOwner.Link(*this, *fact);
+        }
+    }
+    BaseCardElement::Freeze();
+}
+
 Json::Value FactSet::SerializeToJsonValue() const
 {
     Json::Value root = BaseCardElement::SerializeToJsonValue();
 
     std::string factsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts);
     root[factsPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& fact : GetFacts())
+    const std::string titlePropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title);
+    const std::string valuePropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value);
+    for (std::size_t i = 0; i < GetFactCount(); ++i)
     {
-        root[factsPropertyName].append(fact->SerializeToJsonValue());
+        // same output as Fact::SerializeToJsonValue, without materializing the fact
+        const auto view = GetFactView(i);
+        Json::Value fact;
+        fact[titlePropertyName] = Json::Value(view.GetTitleData(), view.GetTitleData() + view.GetTitleLength());
+        fact[valuePropertyName] = Json::Value(view.GetValueData(), view.GetValueData() + view.GetValueLength());
+        root[factsPropertyName].append(fact);
     }
 
     return root;
@@ -41,10 +173,19 @@ std::shared_ptr<BaseCardElement> FactSetParser::Deserialize(ParseContext& contex
 
     auto factSet = BaseCardElement::Deserialize<FactSet>(context, value);
 
-    // Parse Facts
-    auto facts =
-        ParseUtil::GetElementCollectionOfSingleType<Fact>(context, value, AdaptiveCardSchemaKey::Facts, Fact::Deserialize, true);
-    factSet->m_facts = std::move(facts);
+    // Parse Facts straight into columns, with the same validation as Fact::Deserialize
+    const auto& facts = ParseUtil::GetArrayRef(value, AdaptiveCardSchemaKey::Facts, true);
+    factSet->m_factColumns.Reserve(facts.size());
+    for (const auto& fact : facts)
+    {
+        factSet->m_factColumns.Append(ParseUtil::GetString(fact, AdaptiveCardSchemaKey::Title, true),
+                                      ParseUtil::GetString(fact, AdaptiveCardSchemaKey::Value, true));
+    }
+    factSet->m_factLanguage = context.GetLanguage();
+    if (!factSet->m_factColumns.IsEmpty())
+    {
+        factSet->m_factCache = std::make_shared<FactSet::FactCache>();
+    }
 
     return factSet;
 }
@@ -56,5 +197,25 @@ std::shared_ptr<BaseCardElement> FactSetParser::DeserializeFromString(ParseConte
 
 void FactSet::PopulateKnownPropertiesSet()
 {
+    BaseCardElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Facts)});
 }
+
+std::shared_ptr<BaseElement> FactSet::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void FactSet::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    if (m_factCache != nullptr)
+    {
+        m_factCache = std::make_shared<FactCache>();
+    }
+    for (auto& fact : m_facts)
+    {
+        fact = std::make_shared<Fact>(*fact);
+    }
+}
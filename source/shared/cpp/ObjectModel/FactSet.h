@@ -3,6 +3,7 @@
 #include "pch.h"
 #include "BaseCardElement.h"
 #include "ElementParserRegistration.h"
+#include "TitleValueColumns.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -21,14 +22,40 @@ namespace AdaptiveSharedNamespace
         ~FactSet() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
+        // Parsed facts are stored columnar (see TitleValueColumns). The non-const GetFacts() turns them into Fact objects,
+        // after which the returned vector holds the facts. Const access leaves the columns as they are: the const
+        // GetFacts() makes read-only Fact objects alongside them, once, valid until the facts are next edited. The count
+        // and view accessors read the columns while there are any, without making anything, which is what renderers of
+        // large sets should use.
         std::vector<std::shared_ptr<Fact>>& GetFacts();
         const std::vector<std::shared_ptr<Fact>>& GetFacts() const;
 
+        std::size_t GetFactCount() const;
+        TitleValueView GetFactView(std::size_t index) const;
+        const std::string& GetFactLanguageRef(std::size_t index) const;
+
+        // Edit one fact in whichever form the facts are stored, without materializing columnar facts. index must be in
+        // range (up to the fact count for InsertFact).
+        void SetFact(std::size_t index, const std::string& title, const std::string& value);
+        void InsertFact(std::size_t index, const std::string& title, const std::string& value);
+        void RemoveFact(std::size_t index);
+
     private:
+        struct FactCache;
+
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
+        std::shared_ptr<Fact> MakeFact(const std::string& title, const std::string& value) const;
 
         std::vector<std::shared_ptr<Fact>> m_facts;
+        TitleValueColumns m_factColumns;
+        std::string m_factLanguage;
+        // read-only Fact objects of the columns, replaced whenever the columns change; set while there are any
+        std::shared_ptr<FactCache> m_factCache;
     };
 
     class FactSetParser : public BaseCardElementParser
@@ -4,6 +4,11 @@
 
 using namespace AdaptiveSharedNamespace;
 
+HostConfig::HostConfig()
+{
+    UpdatePackedColors();
+}
+
 HostConfig HostConfig::DeserializeFromString(const std::string& jsonString)
 {
     return HostConfig::Deserialize(ParseUtil::GetJsonValueFromString(jsonString));
@@ -73,6 +78,7 @@ HostConfig HostConfig::Deserialize(const Json::Value& json)
     result._media =
         ParseUtil::ExtractJsonValueAndMergeWithDefault<MediaConfig>(json, AdaptiveCardSchemaKey::Media, result._media, MediaConfig::Deserialize);
 
+    result.UpdatePackedColors();
     return result;
 }
 
@@ -387,6 +393,11 @@ MediaConfig MediaConfig::Deserialize(const Json::Value& json, const MediaConfig&
 }
 
 FontStyleDefinition HostConfig::GetFontStyle(FontStyle style) const
+{
+    return GetFontStyleRef(style);
+}
+
+const FontStyleDefinition& HostConfig::GetFontStyleRef(FontStyle style) const
 {
     switch (style)
     {
@@ -495,27 +506,20 @@ unsigned int FontWeightsConfig::GetDefaultFontWeight(TextWeight weight)
 }
 
 std::string HostConfig::GetFontFamily(FontStyle style) const
+{
+    return GetFontFamilyRef(style);
+}
+
+const std::string& HostConfig::GetFontFamilyRef(FontStyle style) const
 {
     // desired font family
-    auto fontFamilyValue = GetFontStyle(style).fontFamily;
+    const auto& fontFamilyValue = GetFontStyleRef(style).fontFamily;
 
-    if (fontFamilyValue.empty())
+    // Monospace has no deprecated fallback; an empty value lets the renderer pick its default font family
+    if (fontFamilyValue.empty() && style != FontStyle::Monospace)
     {
-        if (style == FontStyle::Monospace)
-        {
-            // pass empty string for renderer to handle appropriate const default font family for Monospace
-            fontFamilyValue = "";
-        }
-        else
-        {
-            // deprecated font family
-            fontFamilyValue = _fontFamily;
-            if (fontFamilyValue.empty())
-            {
-                // pass empty string for renderer to handle appropriate const default font family
-                fontFamilyValue = "";
-            }
-        }
+        // deprecated font family, or empty for the renderer's default
+        return _fontFamily;
     }
     return fontFamilyValue;
 }
@@ -523,7 +527,7 @@ std::string HostConfig::GetFontFamily(FontStyle style) const
 unsigned int HostConfig::GetFontSize(FontStyle style, TextSize size) const
 {
     // desired font size
-    auto result = GetFontStyle(style).fontSizes.GetFontSize(size);
+    auto result = GetFontStyleRef(style).fontSizes.GetFontSize(size);
 
     // UINT_MAX used to check if value was defined
     if (result == UINT_MAX)
@@ -547,7 +551,7 @@ unsigned int HostConfig::GetFontSize(FontStyle style, TextSize size) const
 unsigned int HostConfig::GetFontWeight(FontStyle style, TextWeight weight) const
 {
     // desired font weight
-    auto result = GetFontStyle(style).fontWeights.GetFontWeight(weight);
+    auto result = GetFontStyleRef(style).fontWeights.GetFontWeight(weight);
 
     // UINT_MAX used to check if value was defined
     if (result == UINT_MAX)
@@ -589,13 +593,23 @@ const ContainerStyleDefinition& HostConfig::GetContainerStyle(ContainerStyle sty
 }
 
 std::string HostConfig::GetBackgroundColor(ContainerStyle style) const
+{
+    return GetBackgroundColorRef(style);
+}
+
+const std::string& HostConfig::GetBackgroundColorRef(ContainerStyle style) const
 {
     return GetContainerStyle(style).backgroundColor;
 }
 
 std::string HostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const
 {
-    auto foregroundColors = GetContainerStyle(style).foregroundColors;
+    return GetForegroundColorRef(style, color, isSubtle);
+}
+
+const std::string& HostConfig::GetForegroundColorRef(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    const auto& foregroundColors = GetContainerStyle(style).foregroundColors;
     switch (color)
     {
     case ForegroundColor::Accent:
@@ -617,6 +631,11 @@ std::string HostConfig::GetForegroundColor(ContainerStyle style, ForegroundColor
 }
 
 std::string HostConfig::GetBorderColor(ContainerStyle style) const
+{
+    return GetBorderColorRef(style);
+}
+
+const std::string& HostConfig::GetBorderColorRef(ContainerStyle style) const
 {
     return GetContainerStyle(style).borderColor;
 }
@@ -626,11 +645,59 @@ unsigned int HostConfig::GetBorderThickness(ContainerStyle style) const
     return GetContainerStyle(style).borderThickness;
 }
 
+ArgbColor HostConfig::GetBackgroundColorArgb(ContainerStyle style) const
+{
+    const auto index = static_cast<std::size_t>(style);
+    return _packedContainerColors[index < c_containerStyleCount ? index : 0].background;
+}
+
+ArgbColor HostConfig::GetForegroundColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const
+{
+    const auto index = static_cast<std::size_t>(style);
+    const auto colorIndex = static_cast<std::size_t>(color);
+    return _packedContainerColors[index < c_containerStyleCount ? index : 0]
+        .foreground[colorIndex < c_foregroundColorCount ? colorIndex : 0][isSubtle ? 1 : 0];
+}
+
+ArgbColor HostConfig::GetBorderColorArgb(ContainerStyle style) const
+{
+    const auto index = static_cast<std::size_t>(style);
+    return _packedContainerColors[index < c_containerStyleCount ? index : 0].border;
+}
+
+ArgbColor HostConfig::GetSeparatorLineColorArgb() const
+{
+    return _packedSeparatorLineColor;
+}
+
+void HostConfig::UpdatePackedColors()
+{
+    // go through the string getters so that the packed colors resolve styles and colors exactly as they do
+    for (std::size_t i = 0; i < c_containerStyleCount; ++i)
+    {
+        const auto style = static_cast<ContainerStyle>(i);
+        auto& packed = _packedContainerColors[i];
+        packed.background = ArgbColor::Parse(GetBackgroundColorRef(style));
+        packed.border = ArgbColor::Parse(GetBorderColorRef(style));
+        for (std::size_t j = 0; j < c_foregroundColorCount; ++j)
+        {
+            packed.foreground[j][0] = ArgbColor::Parse(GetForegroundColorRef(style, static_cast<ForegroundColor>(j), false));
+            packed.foreground[j][1] = ArgbColor::Parse(GetForegroundColorRef(style, static_cast<ForegroundColor>(j), true));
+        }
+    }
+    _packedSeparatorLineColor = ArgbColor::Parse(_separator.lineColor);
+}
+
 std::string HostConfig::GetFontFamily() const
 {
     return _fontFamily;
 }
 
+const std::string& HostConfig::GetFontFamilyRef() const
+{
+    return _fontFamily;
+}
+
 void HostConfig::SetFontFamily(const std::string& value)
 {
     _fontFamily = value;
@@ -681,6 +748,11 @@ std::string HostConfig::GetImageBaseUrl() const
     return _imageBaseUrl;
 }
 
+const std::string& HostConfig::GetImageBaseUrlRef() const
+{
+    return _imageBaseUrl;
+}
+
 void HostConfig::SetImageBaseUrl(const std::string& value)
 {
     _imageBaseUrl = value;
@@ -714,6 +786,7 @@ SeparatorConfig HostConfig::GetSeparator() const
 void HostConfig::SetSeparator(const SeparatorConfig value)
 {
     _separator = value;
+    UpdatePackedColors();
 }
 
 SpacingConfig HostConfig::GetSpacing() const
@@ -774,6 +847,7 @@ ContainerStylesDefinition HostConfig::GetContainerStyles() const
 void HostConfig::SetContainerStyles(const ContainerStylesDefinition value)
 {
     _containerStyles = value;
+    UpdatePackedColors();
 }
 
 MediaConfig HostConfig::GetMedia() const
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pch.h"
+#include "ArgbColor.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -270,21 +271,34 @@ namespace AdaptiveSharedNamespace
     class HostConfig
     {
     public:
-        HostConfig() = default;
+        HostConfig();
         static HostConfig Deserialize(const Json::Value& json);
         static HostConfig DeserializeFromString(const std::string& jsonString);
 
         FontStyleDefinition GetFontStyle(FontStyle style) const;
+        const FontStyleDefinition& GetFontStyleRef(FontStyle style) const;
         std::string GetFontFamily(FontStyle style) const;
+        const std::string& GetFontFamilyRef(FontStyle style) const;
         unsigned int GetFontSize(FontStyle style, TextSize size) const;
         unsigned int GetFontWeight(FontStyle style, TextWeight weight) const;
 
         std::string GetBackgroundColor(ContainerStyle style) const;
+        const std::string& GetBackgroundColorRef(ContainerStyle style) const;
         std::string GetForegroundColor(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+        const std::string& GetForegroundColorRef(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
         std::string GetBorderColor(ContainerStyle style) const;
+        const std::string& GetBorderColorRef(ContainerStyle style) const;
         unsigned int GetBorderThickness(ContainerStyle style) const;
 
+        // The same colors parsed into packed form when the config was loaded or its colors were last set. Strings
+        // that are not #RRGGBB or #AARRGGBB colors come out as transparent black.
+        ArgbColor GetBackgroundColorArgb(ContainerStyle style) const;
+        ArgbColor GetForegroundColorArgb(ContainerStyle style, ForegroundColor color, bool isSubtle) const;
+        ArgbColor GetBorderColorArgb(ContainerStyle style) const;
+        ArgbColor GetSeparatorLineColorArgb() const;
+
         std::string GetFontFamily() const;
+        const std::string& GetFontFamilyRef() const;
         void SetFontFamily(const std::string& value);
 
         FontSizesConfig GetFontSizes() const;
@@ -300,6 +314,7 @@ namespace AdaptiveSharedNamespace
         void SetSupportsInteractivity(const bool value);
 
         std::string GetImageBaseUrl() const;
+        const std::string& GetImageBaseUrlRef() const;
         void SetImageBaseUrl(const std::string& value);
 
         ImageSizesConfig GetImageSizes() const;
@@ -334,6 +349,18 @@ namespace AdaptiveSharedNamespace
 
     private:
         const ContainerStyleDefinition& GetContainerStyle(ContainerStyle style) const;
+        void UpdatePackedColors();
+
+        static constexpr std::size_t c_containerStyleCount = static_cast<std::size_t>(ContainerStyle::Accent) + 1;
+        static constexpr std::size_t c_foregroundColorCount = static_cast<std::size_t>(ForegroundColor::Attention) + 1;
+
+        struct PackedContainerColors
+        {
+            ArgbColor background;
+            ArgbColor border;
+            // indexed by ForegroundColor, then isSubtle
+            ArgbColor foreground[c_foregroundColorCount][2];
+        };
 
         std::string _fontFamily;
         FontSizesConfig _fontSizes;
@@ -351,5 +378,9 @@ namespace AdaptiveSharedNamespace
         ActionsConfig _actions;
         ContainerStylesDefinition _containerStyles;
         MediaConfig _media;
+
+        // indexed by ContainerStyle
+        PackedContainerColors _packedContainerColors[c_containerStyleCount];
+        ArgbColor _packedSeparatorLineColor;
     };
 }
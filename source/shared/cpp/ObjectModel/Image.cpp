@@ -10,7 +10,35 @@ Image::Image() :
     BaseCardElement(CardElementType::Image), m_imageStyle(ImageStyle::Default), m_imageSize(ImageSize::None),
     m_pixelWidth(0), m_pixelHeight(0), m_hAlignment(HorizontalAlignment::Left)
 {
-    PopulateKnownPropertiesSet();
+}
+
+Image::Image(const Image& other) :
+    BaseCardElement(other), m_url(other.m_url), m_backgroundColor(other.m_backgroundColor),
+    m_backgroundColorArgb(other.m_backgroundColorArgb), m_imageStyle(other.m_imageStyle), m_imageSize(other.m_imageSize),
+    m_pixelWidth(other.m_pixelWidth), m_pixelHeight(other.m_pixelHeight), m_hAlignment(other.m_hAlignment),
+    m_intrinsicSize(other.m_intrinsicSize ? std::make_unique<IntrinsicImageSize>(*other.m_intrinsicSize) : nullptr),
+    m_altText(other.m_altText), m_selectAction(other.m_selectAction)
+{
+}
+
+Image& Image::operator=(const Image& other)
+{
+    if (this != &other)
+    {
+        BaseCardElement::operator=(other);
+        m_url = other.m_url;
+        m_backgroundColor = other.m_backgroundColor;
+        m_backgroundColorArgb = other.m_backgroundColorArgb;
+        m_imageStyle = other.m_imageStyle;
+        m_imageSize = other.m_imageSize;
+        m_pixelWidth = other.m_pixelWidth;
+        m_pixelHeight = other.m_pixelHeight;
+        m_hAlignment = other.m_hAlignment;
+        m_intrinsicSize = other.m_intrinsicSize ? std::make_unique<IntrinsicImageSize>(*other.m_intrinsicSize) : nullptr;
+        m_altText = other.m_altText;
+        m_selectAction = other.m_selectAction;
+    }
+    return *this;
 }
 
 Json::Value Image::SerializeToJsonValue() const
@@ -82,9 +110,23 @@ std::string Image::GetUrl() const
     return m_url;
 }
 
+const std::string& Image::GetUrlRef() const
+{
+    return m_url;
+}
+
 void Image::SetUrl(const std::string& value)
 {
+    MarkChanged();
     m_url = value;
+    m_intrinsicSize.reset();
+}
+
+void Image::SetUrl(std::string&& value)
+{
+    MarkChanged();
+    m_url = std::move(value);
+    m_intrinsicSize.reset();
 }
 
 std::string Image::GetBackgroundColor() const
@@ -92,9 +134,21 @@ std::string Image::GetBackgroundColor() const
     return m_backgroundColor;
 }
 
+const std::string& Image::GetBackgroundColorRef() const
+{
+    return m_backgroundColor;
+}
+
 void Image::SetBackgroundColor(const std::string& value)
 {
+    MarkChanged();
     m_backgroundColor = value;
+    m_backgroundColorArgb = ArgbColor::Parse(value);
+}
+
+ArgbColor Image::GetBackgroundColorArgb() const
+{
+    return m_backgroundColorArgb;
 }
 
 ImageStyle Image::GetImageStyle() const
@@ -104,6 +158,7 @@ ImageStyle Image::GetImageStyle() const
 
 void Image::SetImageStyle(const ImageStyle value)
 {
+    MarkChanged();
     m_imageStyle = value;
 }
 
@@ -114,6 +169,7 @@ ImageSize Image::GetImageSize() const
 
 void Image::SetImageSize(const ImageSize value)
 {
+    MarkChanged();
     m_imageSize = value;
 }
 
@@ -122,11 +178,23 @@ std::string Image::GetAltText() const
     return m_altText;
 }
 
+const std::string& Image::GetAltTextRef() const
+{
+    return m_altText;
+}
+
 void Image::SetAltText(const std::string& value)
 {
+    MarkChanged();
     m_altText = value;
 }
 
+void Image::SetAltText(std::string&& value)
+{
+    MarkChanged();
+    m_altText = std::move(value);
+}
+
 HorizontalAlignment Image::GetHorizontalAlignment() const
 {
     return m_hAlignment;
@@ -134,6 +202,7 @@ HorizontalAlignment Image::GetHorizontalAlignment() const
 
 void Image::SetHorizontalAlignment(const HorizontalAlignment value)
 {
+    MarkChanged();
     m_hAlignment = value;
 }
 
@@ -144,6 +213,7 @@ std::shared_ptr<BaseActionElement> Image::GetSelectAction() const
 
 void Image::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 {
+    MarkChanged();
     m_selectAction = action;
 }
 
@@ -154,6 +224,7 @@ unsigned int Image::GetPixelWidth() const
 
 void Image::SetPixelWidth(unsigned int value)
 {
+    MarkChanged();
     m_pixelWidth = value;
 }
 
@@ -164,9 +235,21 @@ unsigned int Image::GetPixelHeight() const
 
 void Image::SetPixelHeight(unsigned int value)
 {
+    MarkChanged();
     m_pixelHeight = value;
 }
 
+IntrinsicImageSize Image::GetIntrinsicSize() const
+{
+    return m_intrinsicSize ? *m_intrinsicSize : IntrinsicImageSize();
+}
+
+void Image::SetIntrinsicSize(const IntrinsicImageSize& value)
+{
+    MarkChanged();
+    m_intrinsicSize = std::make_unique<IntrinsicImageSize>(value);
+}
+
 std::shared_ptr<BaseCardElement> ImageParser::DeserializeFromString(ParseContext& context, const std::string& jsonString)
 {
     return ImageParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
@@ -183,7 +266,15 @@ ImageParser::DeserializeWithoutCheckingType(ParseContext& context, const Json::V
 {
     std::shared_ptr<Image> image = BaseCardElement::Deserialize<Image>(context, json);
 
-    image->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
+    std::string url = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true);
+    context.ReadUrl(UrlKind::Image, url);
+    IntrinsicImageSize intrinsicSize;
+    const bool isSized = context.GetDataUriImageSizing() && ImageHeaderUtil::TryReadDataUri(url, intrinsicSize);
+    image->SetUrl(std::move(url));
+    if (isSized)
+    {
+        image->SetIntrinsicSize(intrinsicSize);
+    }
     image->SetBackgroundColor(ValidateColor(ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundColor), context.warnings));
     image->SetImageStyle(ParseUtil::GetEnumValue<ImageStyle>(json, AdaptiveCardSchemaKey::Style, ImageStyle::Default, ImageStyleFromString));
     image->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText));
@@ -218,6 +309,8 @@ ImageParser::DeserializeWithoutCheckingType(ParseContext& context, const Json::V
 
 void Image::PopulateKnownPropertiesSet()
 {
+    BaseCardElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundColor),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Style),
@@ -234,6 +327,39 @@ void Image::GetResourceInformation(std::vector<RemoteResourceInformation>& resou
     RemoteResourceInformation imageResourceInfo;
     imageResourceInfo.url = GetUrl();
     imageResourceInfo.mimeType = "image";
+    imageResourceInfo.intrinsicSize = GetIntrinsicSize();
     resourceInfo.push_back(imageResourceInfo);
     return;
 }
+
+void Image::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    if (m_selectAction != nullptr)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::SelectAction, NestedVisitor::NoIndex, *m_selectAction);
+    }
+}
+
+void Image::Freeze()
+{
+    if (m_selectAction != nullptr)
+    {
+        m_selectAction->Freeze();
+    }
+    BaseCardElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> Image::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void Image::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    if (m_selectAction != nullptr)
+    {
+        m_selectAction = std::static_pointer_cast<BaseActionElement>(m_selectAction->Clone());
+    }
+}
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "pch.h"
+#include "ArgbColor.h"
 #include "BaseActionElement.h"
 #include "BaseCardElement.h"
 #include "ElementParserRegistration.h"
+#include "ImageHeaderUtil.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -11,19 +13,27 @@ namespace AdaptiveSharedNamespace
     {
     public:
         Image();
-        Image(const Image&) = default;
+        Image(const Image& other);
         Image(Image&&) = default;
-        Image& operator=(const Image&) = default;
+        Image& operator=(const Image& other);
         Image& operator=(Image&&) = default;
         ~Image() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         std::string GetUrl() const;
+        const std::string& GetUrlRef() const;
         void SetUrl(const std::string& value);
+        void SetUrl(std::string&& value);
 
         std::string GetBackgroundColor() const;
+        const std::string& GetBackgroundColorRef() const;
         void SetBackgroundColor(const std::string& value);
+        // The background color parsed when it was set; transparent when there is none or it is not a color
+        ArgbColor GetBackgroundColorArgb() const;
 
         ImageStyle GetImageStyle() const;
         void SetImageStyle(const ImageStyle value);
@@ -32,7 +42,9 @@ namespace AdaptiveSharedNamespace
         void SetImageSize(const ImageSize value);
 
         std::string GetAltText() const;
+        const std::string& GetAltTextRef() const;
         void SetAltText(const std::string& value);
+        void SetAltText(std::string&& value);
 
         HorizontalAlignment GetHorizontalAlignment() const;
         void SetHorizontalAlignment(const HorizontalAlignment value);
@@ -46,19 +58,28 @@ namespace AdaptiveSharedNamespace
         unsigned int GetPixelHeight() const;
         void SetPixelHeight(unsigned int value);
 
+        // The size stored in the image's header, when it was read while parsing (see
+        // ParseContext::SetDataUriImageSizing); setting the url resets it
+        IntrinsicImageSize GetIntrinsicSize() const;
+        void SetIntrinsicSize(const IntrinsicImageSize& value);
+
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
 
         std::string m_url;
         std::string m_backgroundColor;
+        ArgbColor m_backgroundColorArgb;
         ImageStyle m_imageStyle;
         ImageSize m_imageSize;
         unsigned int m_pixelWidth;
         unsigned int m_pixelHeight;
-        std::string m_altText;
         HorizontalAlignment m_hAlignment;
+        // only allocated for the images that were sized, which most never are
+        std::unique_ptr<IntrinsicImageSize> m_intrinsicSize;
+        std::string m_altText;
         std::shared_ptr<BaseActionElement> m_selectAction;
     };
 
@@ -0,0 +1,242 @@
+#include "pch.h"
+#include "ImageHeaderUtil.h"
+#include "AdaptiveBase64Util.h"
+#include <cstdlib>
+
+using namespace AdaptiveSharedNamespace;
+
+namespace
+{
+    enum class HeaderState
+    {
+        Complete,
+        // a prefix of a known format that's too short to hold the size
+        Incomplete,
+        Unrecognized
+    };
+
+    unsigned int ReadBigEndian16(const unsigned char* data) { return (data[0] << 8) | data[1]; }
+
+    unsigned int ReadBigEndian32(const unsigned char* data)
+    {
+        return (static_cast<unsigned int>(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+    }
+
+    unsigned int ReadLittleEndian16(const unsigned char* data) { return data[0] | (data[1] << 8); }
+
+    unsigned int ReadLittleEndian32(const unsigned char* data)
+    {
+        return data[0] | (data[1] << 8) | (data[2] << 16) | (static_cast<unsigned int>(data[3]) << 24);
+    }
+
+    // Whether data, which is length bytes long, starts with the first prefixLength bytes of prefix. A shorter data
+    // matches as far as it goes.
+    bool StartsWith(const unsigned char* data, size_t length, const char* prefix, size_t prefixLength)
+    {
+        return std::equal(data, data + std::min(length, prefixLength), reinterpret_cast<const unsigned char*>(prefix));
+    }
+
+    HeaderState ReadPng(const unsigned char* data, size_t length, IntrinsicImageSize& size)
+    {
+        // the signature, then the IHDR chunk's length and type, then its width and height
+        if (length < 24)
+        {
+            return HeaderState::Incomplete;
+        }
+        if (!StartsWith(data + 12, 4, "IHDR", 4))
+        {
+            return HeaderState::Unrecognized;
+        }
+        size = IntrinsicImageSize{ImageFormat::Png, ReadBigEndian32(data + 16), ReadBigEndian32(data + 20)};
+        return HeaderState::Complete;
+    }
+
+    HeaderState ReadGif(const unsigned char* data, size_t length, IntrinsicImageSize& size)
+    {
+        // "GIF87a" or "GIF89a", then the logical screen's width and height
+        if (length < 10)
+        {
+            return HeaderState::Incomplete;
+        }
+        size = IntrinsicImageSize{ImageFormat::Gif, ReadLittleEndian16(data + 6), ReadLittleEndian16(data + 8)};
+        return HeaderState::Complete;
+    }
+
+    HeaderState ReadBmp(const unsigned char* data, size_t length, IntrinsicImageSize& size)
+    {
+        // the 14 byte file header, then the DIB header, which starts with its own size
+        if (length < 18)
+        {
+            return HeaderState::Incomplete;
+        }
+
+        if (ReadLittleEndian32(data + 14) == 12)
+        {
+            // BITMAPCOREHEADER, with 16 bit dimensions
+            if (length < 22)
+            {
+                return HeaderState::Incomplete;
+            }
+            size = IntrinsicImageSize{ImageFormat::Bmp, ReadLittleEndian16(data + 18), ReadLittleEndian16(data + 20)};
+            return HeaderState::Complete;
+        }
+
+        if (length < 26)
+        {
+            return HeaderState::Incomplete;
+        }
+        // signed 32 bit dimensions; a negative height means the rows are stored top-down
+        const auto width = static_cast<std::int32_t>(ReadLittleEndian32(data + 18));
+        const auto height = static_cast<std::int32_t>(ReadLittleEndian32(data + 22));
+        if (width < 0 || height == INT32_MIN)
+        {
+            return HeaderState::Unrecognized;
+        }
+        size = IntrinsicImageSize{ImageFormat::Bmp, static_cast<unsigned int>(width), static_cast<unsigned int>(std::abs(height))};
+        return HeaderState::Complete;
+    }
+
+    HeaderState ReadJpeg(const unsigned char* data, size_t length, IntrinsicImageSize& size)
+    {
+        // walks the marker segments following SOI up to the first start of frame (SOFn), which holds the size
+        size_t position = 2;
+        while (true)
+        {
+            // a marker is 0xFF followed by its code, possibly after fill bytes of 0xFF
+            while (position < length && data[position] == 0xFF && position + 1 < length && data[position + 1] == 0xFF)
+            {
+                ++position;
+            }
+            if (position + 2 > length)
+            {
+                return HeaderState::Incomplete;
+            }
+            if (data[position] != 0xFF)
+            {
+                return HeaderState::Unrecognized;
+            }
+
+            const unsigned char marker = data[position + 1];
+            if ((marker >= 0xD0 && marker <= 0xD7) || marker == 0x01)
+            {
+                // restart markers and TEM have no segment
+                position += 2;
+                continue;
+            }
+            if (marker == 0xD9 || marker == 0xDA)
+            {
+                // the image or its scan data starts without a frame header
+                return HeaderState::Unrecognized;
+            }
+
+            if (position + 4 > length)
+            {
+                return HeaderState::Incomplete;
+            }
+            const unsigned int segmentLength = ReadBigEndian16(data + position + 2);
+            if (segmentLength < 2)
+            {
+                return HeaderState::Unrecognized;
+            }
+
+            // SOF0 to SOF15, other than DHT (C4), JPG (C8) and DAC (CC)
+            if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+            {
+                // the segment's length, sample precision, height and width
+                if (position + 9 > length)
+                {
+                    return HeaderState::Incomplete;
+                }
+                const unsigned int height = ReadBigEndian16(data + position + 5);
+                const unsigned int width = ReadBigEndian16(data + position + 7);
+                if (height == 0)
+                {
+                    // the height is only given after the first scan (a DNL marker)
+                    return HeaderState::Unrecognized;
+                }
+                size = IntrinsicImageSize{ImageFormat::Jpeg, width, height};
+                return HeaderState::Complete;
+            }
+
+            position += 2 + segmentLength;
+        }
+    }
+
+    HeaderState ReadHeader(const unsigned char* data, size_t length, IntrinsicImageSize& size)
+    {
+        if (length < 2)
+        {
+            return HeaderState::Incomplete;
+        }
+
+        if (StartsWith(data, length, "\x89PNG\r\n\x1A\n", 8))
+        {
+            return ReadPng(data, length, size);
+        }
+        if (data[0] == 0xFF && data[1] == 0xD8)
+        {
+            return ReadJpeg(data, length, size);
+        }
+        if (StartsWith(data, length, "GIF87a", 6) || StartsWith(data, length, "GIF89a", 6))
+        {
+            return ReadGif(data, length, size);
+        }
+        if (data[0] == 'B' && data[1] == 'M')
+        {
+            return ReadBmp(data, length, size);
+        }
+        return HeaderState::Unrecognized;
+    }
+
+    bool EqualsIgnoreCase(std::string::const_iterator begin, std::string::const_iterator end, const char* value)
+    {
+        for (auto c = begin; c != end; ++c, ++value)
+        {
+            if (*value == '\0' || std::tolower(static_cast<unsigned char>(*c)) != *value)
+            {
+                return false;
+            }
+        }
+        return *value == '\0';
+    }
+}
+
+namespace AdaptiveSharedNamespace
+{
+    bool ImageHeaderUtil::TryReadHeader(const char* data, size_t length, IntrinsicImageSize& size)
+    {
+        return ReadHeader(reinterpret_cast<const unsigned char*>(data), length, size) == HeaderState::Complete;
+    }
+
+    bool ImageHeaderUtil::TryReadDataUri(const std::string& url, IntrinsicImageSize& size)
+    {
+        static const std::string base64Suffix = ";base64";
+        const size_t comma = url.find(',');
+        if (url.size() < 5 || comma == std::string::npos || comma < 5 + base64Suffix.size() ||
+            !EqualsIgnoreCase(url.begin(), url.begin() + 5, "data:") ||
+            !EqualsIgnoreCase(url.begin() + comma - base64Suffix.size(), url.begin() + comma, base64Suffix.c_str()))
+        {
+            return false;
+        }
+
+        // most headers fit in the first chunk; a JPEG's frame header may follow large metadata segments, for which the
+        // chunk size doubles so that decoding and rereading stay linear in the length decoded
+        std::vector<char> header;
+        size_t position = comma + 1;
+        size_t chunkLength = 30;
+        while (true)
+        {
+            position = AdaptiveBase64Util::DecodeChunk(url, position, chunkLength, header);
+            const HeaderState state = ReadHeader(reinterpret_cast<const unsigned char*>(header.data()), header.size(), size);
+            if (state != HeaderState::Incomplete)
+            {
+                return state == HeaderState::Complete;
+            }
+            if (position >= url.size())
+            {
+                return false;
+            }
+            chunkLength = header.size();
+        }
+    }
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    enum class ImageFormat
+    {
+        Unknown = 0,
+        Png,
+        Jpeg,
+        Gif,
+        Bmp
+    };
+
+    // An image's size in pixels as stored in the image itself; format is Unknown, and the size 0x0, when it isn't known
+    struct IntrinsicImageSize
+    {
+        ImageFormat format = ImageFormat::Unknown;
+        unsigned int width = 0;
+        unsigned int height = 0;
+    };
+
+    // Reads the size of PNG, JPEG, GIF and BMP images from their headers, without decoding them
+    class ImageHeaderUtil
+    {
+    public:
+        // data holds the start of an image file; returns false when it isn't one of the formats above or is cut short
+        // before its size
+        static bool TryReadHeader(const char* data, size_t length, IntrinsicImageSize& size);
+
+        // For a "data:[<mediatype>];base64,<data>" url, base64-decodes as little of the data as the header needs (for
+        // a JPEG, up to its frame header) and reads it; returns false for any other url
+        static bool TryReadDataUri(const std::string& url, IntrinsicImageSize& size);
+    };
+}
@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 
 ImageSet::ImageSet() : BaseCardElement(CardElementType::ImageSet), m_imageSize(ImageSize::None)
 {
-    PopulateKnownPropertiesSet();
 }
 
 ImageSize ImageSet::GetImageSize() const
@@ -17,6 +16,7 @@ ImageSize ImageSet::GetImageSize() const
 
 void ImageSet::SetImageSize(const ImageSize value)
 {
+    MarkChanged();
     m_imageSize = value;
 }
 
@@ -27,6 +27,7 @@ const std::vector<std::shared_ptr<Image>>& ImageSet::GetImages() const
 
 std::vector<std::shared_ptr<Image>>& ImageSet::GetImages()
 {
+    ThrowIfFrozen();
     return m_images;
 }
 
@@ -43,7 +44,7 @@ Json::Value ImageSet::SerializeToJsonValue() const
     root[itemsPropertyName] = Json::Value(Json::arrayValue);
     for (const auto& image : m_images)
     {
-        root[itemsPropertyName].append(image->SerializeToJsonValue());
+        root[itemsPropertyName].append(SerializeNested(*image));
     }
 
     return root;
@@ -61,7 +62,8 @@ std::shared_ptr<BaseCardElement> ImageSetParser::Deserialize(ParseContext& conte
     // Parse Images
     auto images = ParseUtil::GetElementCollection(context, value, AdaptiveCardSchemaKey::Images, true);
 
-    for (auto image : images)
+    imageSet->m_images.reserve(images.size());
+    for (const auto& image : images)
     {
         imageSet->m_images.push_back(std::static_pointer_cast<Image>(image));
     }
@@ -76,16 +78,49 @@ std::shared_ptr<BaseCardElement> ImageSetParser::DeserializeFromString(ParseCont
 
 void ImageSet::PopulateKnownPropertiesSet()
 {
+    BaseCardElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Images),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ImageSize)});
 }
 
 void ImageSet::GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo)
 {
-    auto images = GetImages();
-    for (auto image : images)
+    for (const auto& image : m_images)
     {
         image->GetResourceInformation(resourceInfo);
     }
     return;
 }
+
+void ImageSet::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    for (unsigned int i = 0; i < m_images.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Images, i, *m_images[i]);
+    }
+}
+
+void ImageSet::Freeze()
+{
+    for (const auto& image : m_images)
+    {
+        image->Freeze();
+    }
+    BaseCardElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> ImageSet::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void ImageSet::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    for (auto& image : m_images)
+    {
+        image = std::static_pointer_cast<Image>(image->Clone());
+    }
+}
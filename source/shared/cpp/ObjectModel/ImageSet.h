@@ -20,6 +20,9 @@ namespace AdaptiveSharedNamespace
         ~ImageSet() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         ImageSize GetImageSize() const;
         void SetImageSize(const ImageSize value);
@@ -30,6 +33,7 @@ namespace AdaptiveSharedNamespace
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
 
         std::vector<std::shared_ptr<Image>> m_images;
@@ -0,0 +1,253 @@
+#include "pch.h"
+#include "IncrementalSerializer.h"
+#include "BaseElement.h"
+#include "SharedAdaptiveCard.h"
+
+namespace AdaptiveSharedNamespace
+{
+    std::string IncrementalSerializer::Serialize(const AdaptiveCard& card)
+    {
+        ++m_generation;
+        m_lastStatistics = Statistics{};
+
+        if (m_leafWriter == nullptr)
+        {
+            // the same settings as ParseUtil::JsonToString, which compose: a nested value's text appears verbatim in
+            // its parent's text
+            Json::StreamWriterBuilder builder;
+            builder["commentStyle"] = "None";
+            builder["indentation"] = "";
+            m_leafWriter.reset(builder.newStreamWriter());
+        }
+
+        std::string out;
+        // the card's own properties are written every time, and its elements reused
+        WriteNested(card, true, out);
+        out.push_back('\n');
+
+        // drop the text of elements that are no longer part of the card
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+        {
+            it = (it->second.generation == m_generation) ? std::next(it) : m_entries.erase(it);
+        }
+
+        return out;
+    }
+
+    void IncrementalSerializer::Clear()
+    {
+        m_entries.clear();
+        m_lastStatistics = Statistics{};
+    }
+
+    template<typename T> void IncrementalSerializer::WriteNested(const T& node, bool isRoot, std::string& out)
+    {
+        const std::uint64_t changeStamp = node.GetChangeStamp();
+        NestedSignature signature = NestedSignature::Of(node);
+        if (!isRoot)
+        {
+            if (IsReusable(changeStamp, signature))
+            {
+                out += m_entries[changeStamp].text;
+                ++m_lastStatistics.reusedElements;
+                return;
+            }
+            ++m_lastStatistics.serializedElements;
+        }
+
+        const std::size_t start = out.size();
+        std::vector<bool> spliced;
+        WriteOwn(BaseElement::SerializeOmitting(node, signature.GetSlotKeys()), signature, spliced, out);
+
+        std::vector<std::uint64_t> slotStamps;
+        slotStamps.reserve(signature.slots.size());
+        for (const auto& slot : signature.slots)
+        {
+            slotStamps.push_back(slot.element ? slot.element->GetChangeStamp() : slot.card->GetChangeStamp());
+        }
+
+        m_entries[changeStamp] = Entry{std::move(signature.stamps), std::move(slotStamps), std::move(spliced), out.substr(start), m_generation, m_generation, true};
+    }
+
+    template<typename T> bool IncrementalSerializer::IsReusable(const T& node)
+    {
+        return IsReusable(node.GetChangeStamp(), NestedSignature::Of(node));
+    }
+
+    bool IncrementalSerializer::IsReusable(std::uint64_t changeStamp, const NestedSignature& signature)
+    {
+        const auto found = m_entries.find(changeStamp);
+        if (found == m_entries.end())
+        {
+            return false;
+        }
+
+        Entry& entry = found->second;
+        if (entry.checkedGeneration == m_generation)
+        {
+            return entry.reusable;
+        }
+        entry.checkedGeneration = m_generation;
+        entry.reusable = false;
+
+        // The same stamps mean the same parts, and slots in the same places; the slots must also hold the same
+        // elements and cards, unchanged themselves
+        if (entry.stamps != signature.stamps || entry.slotStamps.size() != signature.slots.size())
+        {
+            return false;
+        }
+        for (std::size_t i = 0; i < signature.slots.size(); ++i)
+        {
+            const auto& slot = signature.slots[i];
+            if ((slot.element ? slot.element->GetChangeStamp() : slot.card->GetChangeStamp()) != entry.slotStamps[i])
+            {
+                return false;
+            }
+            if (entry.spliced[i] && !(slot.element ? IsReusable(*slot.element) : IsReusable(*slot.card)))
+            {
+                return false;
+            }
+        }
+
+        entry.reusable = true;
+        entry.generation = m_generation;
+        return true;
+    }
+
+    void IncrementalSerializer::WriteOwn(const Json::Value& own, const NestedSignature& signature, std::vector<bool>& spliced, std::string& out)
+    {
+        spliced.assign(signature.slots.size(), false);
+        std::unordered_map<std::string, std::vector<std::size_t>> slotsByName;
+        for (std::size_t i = 0; i < signature.slots.size(); ++i)
+        {
+            slotsByName[AdaptiveCardSchemaKeyToString(signature.slots[i].key)].push_back(i);
+        }
+
+        const auto writeSlot = [this, &signature, &spliced, &out](std::size_t i) {
+            spliced[i] = true;
+            const auto& slot = signature.slots[i];
+            if (slot.element)
+            {
+                WriteNested(*slot.element, false, out);
+            }
+            else
+            {
+                WriteNested(*slot.card, false, out);
+            }
+        };
+
+        // elements and cards serialize to objects
+        out.push_back('{');
+        bool first = true;
+        for (auto it = own.begin(); it != own.end(); ++it)
+        {
+            if (!first)
+            {
+                out.push_back(',');
+            }
+            first = false;
+            const std::string name = it.name();
+            Write(Json::Value(name.data(), name.data() + name.size()), out);
+            out.push_back(':');
+
+            const auto found = slotsByName.find(name);
+            if (found == slotsByName.end())
+            {
+                Write(*it, out);
+            }
+            else if (it->isNull())
+            {
+                const auto slot = std::find_if(found->second.begin(), found->second.end(), [&signature](std::size_t i) {
+                    return signature.slots[i].index == NestedVisitor::NoIndex;
+                });
+                if (slot != found->second.end())
+                {
+                    writeSlot(*slot);
+                }
+                else
+                {
+                    Write(*it, out);
+                }
+            }
+            else if (it->isArray())
+            {
+                std::unordered_map<unsigned int, std::size_t> slotsByIndex;
+                for (std::size_t i : found->second)
+                {
+                    slotsByIndex.emplace(signature.slots[i].index, i);
+                }
+
+                out.push_back('[');
+                for (Json::ArrayIndex index = 0; index < it->size(); ++index)
+                {
+                    if (index != 0)
+                    {
+                        out.push_back(',');
+                    }
+                    const Json::Value& item = (*it)[index];
+                    const auto slot = item.isNull() ? slotsByIndex.find(index) : slotsByIndex.end();
+                    if (slot != slotsByIndex.end())
+                    {
+                        writeSlot(slot->second);
+                    }
+                    else
+                    {
+                        Write(item, out);
+                    }
+                }
+                out.push_back(']');
+            }
+            else
+            {
+                Write(*it, out);
+            }
+        }
+        out.push_back('}');
+    }
+
+    void IncrementalSerializer::Write(const Json::Value& value, std::string& out)
+    {
+        switch (value.type())
+        {
+        case Json::objectValue:
+        {
+            out.push_back('{');
+            bool first = true;
+            for (auto it = value.begin(); it != value.end(); ++it)
+            {
+                if (!first)
+                {
+                    out.push_back(',');
+                }
+                first = false;
+                const std::string name = it.name();
+                Write(Json::Value(name.data(), name.data() + name.size()), out);
+                out.push_back(':');
+                Write(*it, out);
+            }
+            out.push_back('}');
+            return;
+        }
+        case Json::arrayValue:
+        {
+            out.push_back('[');
+            for (Json::ArrayIndex i = 0; i < value.size(); ++i)
+            {
+                if (i != 0)
+                {
+                    out.push_back(',');
+                }
+                Write(value[i], out);
+            }
+            out.push_back(']');
+            return;
+        }
+        default:
+            break;
+        }
+
+        m_leafStream.str(std::string());
+        m_leafWriter->write(value, &m_leafStream);
+        out += m_leafStream.str();
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseElement;
+    struct NestedSignature;
+
+    // Re-serializes cards that are updated in place. The serialized text of every element is retained, and an element
+    // whose change stamp and nested elements (see BaseElement::VisitNested) are unchanged since the previous call has
+    // its text spliced in rather than being serialized again, so the cost follows the size of the edit rather than the
+    // size of the card. Serialize() returns exactly what AdaptiveCard::Serialize() does.
+    //
+    // Text is retained from the previous Serialize() call, not from parsing: the parsed json is normalized on the way
+    // into the object model, so the source text is no match for what serializing gives. Entries are keyed on change
+    // stamps, which are never reused, so an element destroyed and another allocated in its place can't be taken for
+    // one another. Text is kept for the elements reached by the latest call only. A serializer may be used for several
+    // cards in turn, but not from several threads at once.
+    class IncrementalSerializer
+    {
+    public:
+        struct Statistics
+        {
+            // elements spliced from retained text; elements nested in them aren't counted
+            std::size_t reusedElements;
+            std::size_t serializedElements;
+        };
+
+        IncrementalSerializer() = default;
+        IncrementalSerializer(const IncrementalSerializer&) = delete;
+        IncrementalSerializer& operator=(const IncrementalSerializer&) = delete;
+
+        std::string Serialize(const AdaptiveCard& card);
+
+        // Counts for the latest Serialize() call
+        Statistics GetLastStatistics() const { return m_lastStatistics; }
+        void Clear();
+
+    private:
+        struct Entry
+        {
+            // the signature (see NestedSignature) the text was written for
+            std::vector<std::uint64_t> stamps;
+            // change stamps of the slots' elements and cards, and whether each was written from its own entry
+            std::vector<std::uint64_t> slotStamps;
+            std::vector<bool> spliced;
+            std::string text;
+            std::uint64_t generation;
+            // whether the entry can be reused was decided in checkedGeneration
+            std::uint64_t checkedGeneration;
+            bool reusable;
+        };
+
+        // Writes an element or card, reusing its text unless it is the card being serialized
+        template<typename T> void WriteNested(const T& node, bool isRoot, std::string& out);
+        template<typename T> bool IsReusable(const T& node);
+        bool IsReusable(std::uint64_t changeStamp, const NestedSignature& signature);
+        // Writes the json of a node's own properties, with the elements and cards of its slots written in the places
+        // left null for them, and notes which slots those were
+        void WriteOwn(const Json::Value& own, const NestedSignature& signature, std::vector<bool>& spliced, std::string& out);
+        void Write(const Json::Value& value, std::string& out);
+
+        // by change stamp
+        std::unordered_map<std::uint64_t, Entry> m_entries;
+        std::uint64_t m_generation = 0;
+        Statistics m_lastStatistics{};
+        std::unique_ptr<Json::StreamWriter> m_leafWriter;
+        std::ostringstream m_leafStream;
+    };
+}
@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 Inline::Inline(InlineElementType type) : m_type(type)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value Inline::SerializeToJsonValue() const
@@ -35,6 +34,7 @@ Json::Value Inline::GetAdditionalProperties() const
 
 void Inline::SetAdditionalProperties(Json::Value const& value)
 {
+    MarkChanged();
     m_additionalProperties = value;
 }
 
@@ -49,3 +49,7 @@ void Inline::PopulateKnownPropertiesSet()
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)});
 }
 
+std::shared_ptr<Inline> Inline::Clone() const
+{
+    return std::make_shared<Inline>(*this);
+}
@@ -7,7 +7,7 @@
 
 namespace AdaptiveSharedNamespace
 {
-    class Inline
+    class Inline : public ElementPart
     {
     public:
         Inline(InlineElementType type);
@@ -19,6 +19,7 @@ namespace AdaptiveSharedNamespace
         ~Inline() = default;
 
         virtual Json::Value SerializeToJsonValue() const;
+        virtual std::shared_ptr<Inline> Clone() const;
 
         // Element type
         virtual const InlineElementType GetInlineType() const;
@@ -31,7 +32,7 @@ namespace AdaptiveSharedNamespace
 
     protected:
         virtual void PopulateKnownPropertiesSet();
-        std::unordered_set<std::string> m_knownProperties;
+        KnownPropertiesSet m_knownProperties;
         Json::Value m_additionalProperties;
 
     private:
@@ -0,0 +1,336 @@
+#include "pch.h"
+#include "InputValidator.h"
+#include "CardTraversal.h"
+#include "ChoiceSetInput.h"
+#include "DateInput.h"
+#include "NumberInput.h"
+#include "SharedAdaptiveCard.h"
+#include "TextInput.h"
+#include "TimeInput.h"
+#include <cmath>
+#include <system_error>
+#include <thread>
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        bool ParseDigits(const std::string& value, std::size_t position, std::size_t count, int& result)
+        {
+            result = 0;
+            for (std::size_t i = position; i < position + count; ++i)
+            {
+                if (value[i] < '0' || value[i] > '9')
+                {
+                    return false;
+                }
+                result = result * 10 + (value[i] - '0');
+            }
+            return true;
+        }
+
+        // YYYY-MM-DD as yyyymmdd, which orders as the dates do
+        bool ParseDate(const std::string& value, double& result)
+        {
+            int year, month, day;
+            if (value.size() != 10 || value[4] != '-' || value[7] != '-' || !ParseDigits(value, 0, 4, year) ||
+                !ParseDigits(value, 5, 2, month) || !ParseDigits(value, 8, 2, day) || month < 1 || month > 12 || day < 1)
+            {
+                return false;
+            }
+
+            static const int c_daysInMonth[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+            const bool isLeapYear = (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+            if (day > c_daysInMonth[month - 1] + ((month == 2 && isLeapYear) ? 1 : 0))
+            {
+                return false;
+            }
+
+            result = year * 10000.0 + month * 100 + day;
+            return true;
+        }
+
+        // HH:MM as minutes since midnight
+        bool ParseTime(const std::string& value, double& result)
+        {
+            int hours, minutes;
+            if (value.size() != 5 || value[2] != ':' || !ParseDigits(value, 0, 2, hours) || !ParseDigits(value, 3, 2, minutes) ||
+                hours > 23 || minutes > 59)
+            {
+                return false;
+            }
+
+            result = hours * 60.0 + minutes;
+            return true;
+        }
+
+        bool ParseNumber(const std::string& value, double& result)
+        {
+            // strtod accepts leading whitespace, hex and "inf", none of which a number input produces
+            if (value.empty() || std::isspace(static_cast<unsigned char>(value[0])) ||
+                value.find_first_of("xXnN") != std::string::npos)
+            {
+                return false;
+            }
+
+            char* end = nullptr;
+            result = std::strtod(value.c_str(), &end);
+            return end == value.c_str() + value.size() && std::isfinite(result);
+        }
+
+        // Length in characters (UTF-8 code points), as maxLength counts them
+        std::size_t CharacterCount(const std::string& value)
+        {
+            return std::count_if(value.begin(), value.end(), [](char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; });
+        }
+
+        // A bound from the card, or the given default if it's absent or doesn't parse
+        double ParseBound(const std::string& value, bool (*parse)(const std::string&, double&), double defaultValue)
+        {
+            double result;
+            return parse(value, result) ? result : defaultValue;
+        }
+    }
+
+    InputValidator InputValidator::Compile(AdaptiveCard& card)
+    {
+        InputValidator validator;
+        const double lowest = -std::numeric_limits<double>::infinity();
+        const double highest = std::numeric_limits<double>::infinity();
+
+        auto nodes = PreOrder(card);
+        for (auto node = nodes.begin(); node != nodes.end(); ++node)
+        {
+            if (node->IsFallback())
+            {
+                node.SkipChildren();
+                continue;
+            }
+            if (node->GetKind() != CardNodeKind::CardElement)
+            {
+                continue;
+            }
+
+            const BaseCardElement& element = *node->GetCardElement();
+            Constraint input{element.GetIdRef(), ValueKind::Any, false, lowest, highest, 0, false};
+            switch (node->GetCardElementType())
+            {
+            case CardElementType::TextInput:
+            {
+                const auto maxLength = static_cast<const TextInput&>(element).GetMaxLength();
+                input.kind = ValueKind::Text;
+                input.maximum = (maxLength == 0) ? highest : maxLength;
+                break;
+            }
+            case CardElementType::NumberInput:
+            {
+                // the parser's defaults for absent bounds are the int limits
+                const auto& number = static_cast<const NumberInput&>(element);
+                input.kind = ValueKind::Number;
+                input.minimum = (number.GetMin() == std::numeric_limits<int>::min()) ? lowest : number.GetMin();
+                input.maximum = (number.GetMax() == std::numeric_limits<int>::max()) ? highest : number.GetMax();
+                break;
+            }
+            case CardElementType::DateInput:
+            {
+                const auto& date = static_cast<const DateInput&>(element);
+                input.kind = ValueKind::Date;
+                input.minimum = ParseBound(date.GetMinRef(), ParseDate, lowest);
+                input.maximum = ParseBound(date.GetMaxRef(), ParseDate, highest);
+                break;
+            }
+            case CardElementType::TimeInput:
+            {
+                const auto& time = static_cast<const TimeInput&>(element);
+                input.kind = ValueKind::Time;
+                input.minimum = ParseBound(time.GetMinRef(), ParseTime, lowest);
+                input.maximum = ParseBound(time.GetMaxRef(), ParseTime, highest);
+                break;
+            }
+            case CardElementType::ChoiceSetInput:
+            {
+                const auto& choiceSet = static_cast<const ChoiceSetInput&>(element);
+                std::unordered_set<std::string> values;
+                values.reserve(choiceSet.GetChoiceCount());
+                for (std::size_t i = 0; i < choiceSet.GetChoiceCount(); ++i)
+                {
+                    values.insert(choiceSet.GetChoiceView(i).GetValue());
+                }
+                input.kind = ValueKind::Choice;
+                input.choices = validator.m_choices.size();
+                input.isMultiSelect = choiceSet.GetIsMultiSelect();
+                validator.m_choices.push_back(std::move(values));
+                break;
+            }
+            case CardElementType::ToggleInput:
+                break;
+            default:
+                continue;
+            }
+
+            input.isRequired = static_cast<const BaseInputElement&>(element).GetIsRequired();
+            validator.m_inputs.push_back(std::move(input));
+        }
+        return validator;
+    }
+
+    std::vector<InputValidationError> InputValidator::Validate(const Json::Value& submission) const
+    {
+        std::vector<InputValidationError> errors;
+        const bool isObject = submission.isObject();
+        for (const auto& input : m_inputs)
+        {
+            const Json::Value* value = isObject ? submission.find(input.id.data(), input.id.data() + input.id.size()) : nullptr;
+            const bool isEmpty = value == nullptr || value->isNull() || (value->isString() && value->asString().empty());
+
+            InputValidationErrorType error;
+            if (isEmpty)
+            {
+                if (input.isRequired)
+                {
+                    errors.push_back(InputValidationError{input.id, InputValidationErrorType::Required});
+                }
+            }
+            else if (!ValidateValue(input, *value, error))
+            {
+                errors.push_back(InputValidationError{input.id, error});
+            }
+        }
+        return errors;
+    }
+
+    bool InputValidator::ValidateValue(const Constraint& input, const Json::Value& value, InputValidationErrorType& error) const
+    {
+        double parsed = 0;
+        if (input.kind == ValueKind::Number && value.isNumeric())
+        {
+            parsed = value.asDouble();
+        }
+        else if (!value.isString())
+        {
+            error = InputValidationErrorType::InvalidFormat;
+            return false;
+        }
+        else
+        {
+            const std::string text = value.asString();
+            switch (input.kind)
+            {
+            case ValueKind::Text:
+                if (CharacterCount(text) > input.maximum)
+                {
+                    error = InputValidationErrorType::TooLong;
+                    return false;
+                }
+                return true;
+            case ValueKind::Number:
+            case ValueKind::Date:
+            case ValueKind::Time:
+            {
+                const bool parses = (input.kind == ValueKind::Number) ? ParseNumber(text, parsed) :
+                                    (input.kind == ValueKind::Date) ? ParseDate(text, parsed) : ParseTime(text, parsed);
+                if (!parses)
+                {
+                    error = InputValidationErrorType::InvalidFormat;
+                    return false;
+                }
+                break;
+            }
+            case ValueKind::Choice:
+            {
+                // as ChoiceSetInput::IsValidValue: comma-separated entries, at most one unless multi-select
+                const auto& choices = m_choices[input.choices];
+                std::size_t entries = 0;
+                for (std::size_t start = 0;;)
+                {
+                    ++entries;
+                    const std::size_t end = std::min(text.find(',', start), text.size());
+                    if (choices.find(text.substr(start, end - start)) == choices.end())
+                    {
+                        error = InputValidationErrorType::InvalidChoice;
+                        return false;
+                    }
+                    if (end == text.size())
+                    {
+                        break;
+                    }
+                    start = end + 1;
+                }
+                if (entries > 1 && !input.isMultiSelect)
+                {
+                    error = InputValidationErrorType::InvalidChoice;
+                    return false;
+                }
+                return true;
+            }
+            case ValueKind::Any:
+            default:
+                return true;
+            }
+        }
+
+        if (parsed < input.minimum)
+        {
+            error = InputValidationErrorType::BelowMinimum;
+            return false;
+        }
+        if (parsed > input.maximum)
+        {
+            error = InputValidationErrorType::AboveMaximum;
+            return false;
+        }
+        return true;
+    }
+
+    std::vector<std::vector<InputValidationError>> InputValidator::ValidateBatch(const std::vector<Json::Value>& submissions,
+                                                                                 unsigned int threadCount) const
+    {
+        std::vector<std::vector<InputValidationError>> results(submissions.size());
+        if (threadCount == 0)
+        {
+            threadCount = std::max(1u, std::thread::hardware_concurrency());
+        }
+        threadCount = static_cast<unsigned int>(std::min<std::size_t>(threadCount, submissions.size()));
+
+        // threads take submissions one at a time, so that a few slow ones don't hold up a whole share of the batch
+        std::atomic<std::size_t> next{0};
+        const auto work = [this, &submissions, &results, &next]() {
+            for (std::size_t i = next++; i < submissions.size(); i = next++)
+            {
+                results[i] = Validate(submissions[i]);
+            }
+        };
+
+        {
+            // joins the started threads however the block is left (destroying a joinable thread terminates), before the
+            // results are returned
+            struct Joiner
+            {
+                std::vector<std::thread> threads;
+                ~Joiner()
+                {
+                    for (auto& thread : threads)
+                    {
+                        thread.join();
+                    }
+                }
+            } joiner;
+            joiner.threads.reserve(threadCount);
+
+            for (unsigned int i = 1; i < threadCount; ++i)
+            {
+                try
+                {
+                    joiner.threads.emplace_back(work);
+                }
+                catch (const std::system_error&)
+                {
+                    // out of threads: the ones already started and this one share the rest
+                    break;
+                }
+            }
+            work();
+        }
+        return results;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+
+    enum class InputValidationErrorType
+    {
+        // A required input is missing or empty
+        Required,
+        // The value has the wrong JSON type, or isn't a number, date (YYYY-MM-DD) or time (HH:MM) as the input expects
+        InvalidFormat,
+        // A text input's value has more than maxLength characters
+        TooLong,
+        BelowMinimum,
+        AboveMaximum,
+        // A choice set's value names a choice the set doesn't have, or several choices for a single-select set
+        InvalidChoice
+    };
+
+    struct InputValidationError
+    {
+        std::string inputId;
+        InputValidationErrorType type;
+    };
+
+    // Validates submitted input values on the server against the card that produced them. Compiling reads each input's
+    // constraints once: isRequired, a text input's maxLength, a number input's min and max, a date or time input's
+    // min and max (parsed from their strings) and a choice set's values (kept in a hash set). Validating a submission
+    // is then one pass over the inputs, looking each one up in the submitted object.
+    //
+    // A submission is a JSON object mapping input ids to values, as a Submit action sends them: strings, though numbers
+    // are also accepted for number inputs. Members that aren't inputs of the card (such as the action's data) are
+    // ignored. Inputs inside the cards of ShowCard actions are included; fallback content isn't, and min or max values
+    // that don't parse in the card are ignored as renderers ignore them.
+    //
+    // A compiled validator holds no reference to the card and isn't modified by validation, so it may be shared between
+    // threads.
+    class InputValidator
+    {
+    public:
+        static InputValidator Compile(AdaptiveCard& card);
+
+        // Errors in input order; empty if the submission is valid. A submission that isn't an object is validated as
+        // an empty one.
+        std::vector<InputValidationError> Validate(const Json::Value& submission) const;
+
+        // Validates each submission, spreading the batch over up to threadCount threads (0 for one per hardware
+        // thread). Results are in submission order.
+        std::vector<std::vector<InputValidationError>> ValidateBatch(const std::vector<Json::Value>& submissions,
+                                                                     unsigned int threadCount = 0) const;
+
+        std::size_t GetInputCount() const { return m_inputs.size(); }
+
+    private:
+        enum class ValueKind
+        {
+            Text,
+            Number,
+            Date,
+            Time,
+            Choice,
+            // toggles: only isRequired applies
+            Any
+        };
+
+        struct Constraint
+        {
+            std::string id;
+            ValueKind kind;
+            bool isRequired;
+            // Text: maxLength in characters (0 for none); Number: as given; Date: yyyymmdd; Time: minutes since midnight
+            double minimum;
+            double maximum;
+            // index into m_choices for a choice set
+            std::size_t choices;
+            bool isMultiSelect;
+        };
+
+        InputValidator() = default;
+
+        // The error in a present, non-empty value, if any
+        bool ValidateValue(const Constraint& input, const Json::Value& value, InputValidationErrorType& error) const;
+
+        std::vector<Constraint> m_inputs;
+        std::vector<std::unordered_set<std::string>> m_choices;
+    };
+}
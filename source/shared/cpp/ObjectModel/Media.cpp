@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 
 Media::Media() : BaseCardElement(CardElementType::Media)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value Media::SerializeToJsonValue() const
@@ -39,8 +38,14 @@ std::string Media::GetPoster() const
     return m_poster;
 }
 
+const std::string& Media::GetPosterRef() const
+{
+    return m_poster;
+}
+
 void Media::SetPoster(const std::string& value)
 {
+    MarkChanged();
     m_poster = value;
 }
 
@@ -49,18 +54,32 @@ std::string Media::GetAltText() const
     return m_altText;
 }
 
+const std::string& Media::GetAltTextRef() const
+{
+    return m_altText;
+}
+
 void Media::SetAltText(const std::string& value)
 {
+    MarkChanged();
     m_altText = value;
 }
 
 std::vector<std::shared_ptr<MediaSource>>& Media::GetSources()
+{
+    ThrowIfFrozen();
+    return m_sources;
+}
+
+const std::vector<std::shared_ptr<MediaSource>>& Media::GetSources() const
 {
     return m_sources;
 }
 
 void Media::PopulateKnownPropertiesSet()
 {
+    BaseCardElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Poster),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::AltText),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Sources)});
@@ -73,8 +92,7 @@ void Media::GetResourceInformation(std::vector<RemoteResourceInformation>& resou
     posterResourceInfo.mimeType = "image";
     resourceInfo.push_back(posterResourceInfo);
 
-    auto sources = GetSources();
-    for (auto source : sources)
+    for (const auto& source : m_sources)
     {
         source->GetResourceInformation(resourceInfo);
     }
@@ -86,14 +104,16 @@ std::shared_ptr<BaseCardElement> MediaParser::Deserialize(ParseContext& context,
     ParseUtil::ExpectTypeString(json, CardElementType::Media);
 
     std::shared_ptr<Media> media = BaseCardElement::Deserialize<Media>(context, json);
-    media->SetPoster(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Poster, false));
+    std::string poster = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Poster, false);
+    context.ReadUrl(UrlKind::MediaPoster, poster);
+    media->SetPoster(poster);
     media->SetAltText(ParseUtil::GetString(json, AdaptiveCardSchemaKey::AltText, false));
 
     auto sources = ParseUtil::GetElementCollectionOfSingleType<MediaSource>(
         context, json, AdaptiveCardSchemaKey::Sources, MediaSourceParser::Deserialize, true);
 
     std::string mimeBaseType;
-    for (auto source : sources)
+    for (const auto& source : sources)
     {
         std::string currentMimeType = source->GetMimeType();
 
@@ -123,3 +143,39 @@ std::shared_ptr<BaseCardElement> MediaParser::DeserializeFromString(ParseContext
 {
     return MediaParser::Deserialize(context, ParseUtil::GetJsonValueFromString(jsonString));
 }
+
+std::shared_ptr<BaseElement> Media::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void Media::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    for (const auto& source : m_sources)
+    {
+        visitor.Part(*source);
+    }
+}
+
+void Media::Freeze()
+{
+    if (!IsFrozen())
+    {
+        // links the sources, whose setters then throw
+        for (const auto& source : m_sources)
+        {
+            m_partOwner.Link(*this, *source);
+        }
+    }
+    BaseCardElement::Freeze();
+}
+
+void Media::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    for (auto& source : m_sources)
+    {
+        source = std::make_shared<MediaSource>(*source);
+    }
+}
@@ -20,18 +20,25 @@ namespace AdaptiveSharedNamespace
         ~Media() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         std::string GetPoster() const;
+        const std::string& GetPosterRef() const;
         void SetPoster(const std::string& value);
 
         std::string GetAltText() const;
+        const std::string& GetAltTextRef() const;
         void SetAltText(const std::string& value);
 
         std::vector<std::shared_ptr<MediaSource>>& GetSources();
+        const std::vector<std::shared_ptr<MediaSource>>& GetSources() const;
 
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
     private:
+        void DeepCopyMembers() override;
         std::string m_poster;
         std::string m_altText;
         std::vector<std::shared_ptr<MediaSource>> m_sources;
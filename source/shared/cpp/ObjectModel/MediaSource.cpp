@@ -30,8 +30,14 @@ std::string MediaSource::GetMimeType() const
     return m_mimeType;
 }
 
+const std::string& MediaSource::GetMimeTypeRef() const
+{
+    return m_mimeType;
+}
+
 void MediaSource::SetMimeType(const std::string& value)
 {
+    MarkChanged();
     m_mimeType = value;
 }
 
@@ -40,8 +46,14 @@ std::string MediaSource::GetUrl() const
     return m_url;
 }
 
+const std::string& MediaSource::GetUrlRef() const
+{
+    return m_url;
+}
+
 void MediaSource::SetUrl(const std::string& value)
 {
+    MarkChanged();
     m_url = value;
 }
 
@@ -55,12 +67,14 @@ void MediaSource::GetResourceInformation(std::vector<RemoteResourceInformation>&
     return;
 }
 
-std::shared_ptr<MediaSource> MediaSourceParser::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<MediaSource> MediaSourceParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::shared_ptr<MediaSource> mediaSource = std::make_shared<MediaSource>();
 
     mediaSource->SetMimeType(ParseUtil::GetString(json, AdaptiveCardSchemaKey::MimeType, false));
-    mediaSource->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, false));
+    std::string url = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, false);
+    context.ReadUrl(UrlKind::MediaSource, url);
+    mediaSource->SetUrl(url);
 
     return mediaSource;
 }
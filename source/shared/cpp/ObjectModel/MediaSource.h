@@ -7,7 +7,7 @@
 
 namespace AdaptiveSharedNamespace
 {
-    class MediaSource
+    class MediaSource : public ElementPart
     {
     public:
         MediaSource();
@@ -20,9 +20,11 @@ namespace AdaptiveSharedNamespace
         virtual Json::Value SerializeToJsonValue() const;
 
         std::string GetMimeType() const;
+        const std::string& GetMimeTypeRef() const;
         void SetMimeType(const std::string& value);
 
         std::string GetUrl() const;
+        const std::string& GetUrlRef() const;
         void SetUrl(const std::string& value);
 
         virtual void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo);
@@ -8,7 +8,6 @@ NumberInput::NumberInput() :
     BaseInputElement(CardElementType::NumberInput), m_value(0), m_max(std::numeric_limits<int>::max()),
     m_min(std::numeric_limits<int>::min())
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value NumberInput::SerializeToJsonValue() const
@@ -43,8 +42,14 @@ std::string NumberInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+const std::string& NumberInput::GetPlaceholderRef() const
+{
+    return m_placeholder;
+}
+
 void NumberInput::SetPlaceholder(const std::string& value)
 {
+    MarkChanged();
     m_placeholder = value;
 }
 
@@ -55,6 +60,7 @@ int NumberInput::GetValue() const
 
 void NumberInput::SetValue(const int value)
 {
+    MarkChanged();
     m_value = value;
 }
 
@@ -65,6 +71,7 @@ int NumberInput::GetMax() const
 
 void NumberInput::SetMax(const int value)
 {
+    MarkChanged();
     m_max = value;
 }
 
@@ -75,6 +82,7 @@ int NumberInput::GetMin() const
 
 void NumberInput::SetMin(const int value)
 {
+    MarkChanged();
     m_min = value;
 }
 
@@ -100,8 +108,15 @@ NumberInputParser::DeserializeFromString(ParseContext& context, const std::strin
 
 void NumberInput::PopulateKnownPropertiesSet()
 {
+    BaseInputElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min)});
 }
+
+std::shared_ptr<BaseElement> NumberInput::Clone() const
+{
+    return MakeClone(*this);
+}
@@ -17,8 +17,10 @@ namespace AdaptiveSharedNamespace
         ~NumberInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
 
         std::string GetPlaceholder() const;
+        const std::string& GetPlaceholderRef() const;
         void SetPlaceholder(const std::string& value);
 
         int GetValue() const;
@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 
 OpenUrlAction::OpenUrlAction() : BaseActionElement(ActionType::OpenUrl)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value OpenUrlAction::SerializeToJsonValue() const
@@ -24,16 +23,30 @@ std::string OpenUrlAction::GetUrl() const
     return m_url;
 }
 
+const std::string& OpenUrlAction::GetUrlRef() const
+{
+    return m_url;
+}
+
 void OpenUrlAction::SetUrl(const std::string& value)
 {
+    MarkChanged();
     m_url = value;
 }
 
+void OpenUrlAction::SetUrl(std::string&& value)
+{
+    MarkChanged();
+    m_url = std::move(value);
+}
+
 std::shared_ptr<BaseActionElement> OpenUrlActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::shared_ptr<OpenUrlAction> openUrlAction = BaseActionElement::Deserialize<OpenUrlAction>(context, json);
 
-    openUrlAction->SetUrl(ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true));
+    std::string url = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Url, true);
+    context.ReadUrl(UrlKind::OpenUrl, url);
+    openUrlAction->SetUrl(std::move(url));
 
     return openUrlAction;
 }
@@ -46,5 +59,12 @@ OpenUrlActionParser::DeserializeFromString(ParseContext& context, const std::str
 
 void OpenUrlAction::PopulateKnownPropertiesSet()
 {
+    BaseActionElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Url)});
 }
+
+std::shared_ptr<BaseElement> OpenUrlAction::Clone() const
+{
+    return MakeClone(*this);
+}
@@ -17,9 +17,12 @@ namespace AdaptiveSharedNamespace
         ~OpenUrlAction() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
 
         std::string GetUrl() const;
+        const std::string& GetUrlRef() const;
         void SetUrl(const std::string& value);
+        void SetUrl(std::string&& value);
 
     private:
         void PopulateKnownPropertiesSet() override;
@@ -5,11 +5,11 @@ using namespace AdaptiveSharedNamespace;
 
 Paragraph::Paragraph()
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::vector<std::shared_ptr<Inline>>& Paragraph::GetInlines()
 {
+    ThrowIfFrozen();
     return m_inlines;
 }
 
@@ -25,6 +25,7 @@ Json::Value Paragraph::GetAdditionalProperties() const
 
 void Paragraph::SetAdditionalProperties(Json::Value const& value)
 {
+    MarkChanged();
     m_additionalProperties = value;
 }
 
@@ -36,7 +37,12 @@ std::shared_ptr<Paragraph> AdaptiveSharedNamespace::Paragraph::Deserialize(Parse
         ParseUtil::GetElementCollectionOfSingleType<Inline>(context, json, AdaptiveCardSchemaKey::Inlines, Inline::Deserialize, true);
     paragraph->m_inlines = std::move(inlines);
 
-    HandleUnknownProperties(json, paragraph->m_knownProperties, paragraph->m_additionalProperties);
+    static const std::unordered_set<std::string> knownProperties = []() {
+        Paragraph prototype;
+        prototype.PopulateKnownPropertiesSet();
+        return std::move(prototype.m_knownProperties.Get());
+    }();
+    HandleUnknownProperties(json, knownProperties, paragraph->m_additionalProperties);
 
     return paragraph;
 }
@@ -60,3 +66,13 @@ Json::Value Paragraph::SerializeToJsonValue() const
 
     return root;
 }
+
+std::shared_ptr<Paragraph> Paragraph::Clone() const
+{
+    auto clone = std::make_shared<Paragraph>(*this);
+    for (auto& inlineElement : clone->m_inlines)
+    {
+        inlineElement = inlineElement->Clone();
+    }
+    return clone;
+}
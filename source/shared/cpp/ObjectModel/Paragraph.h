@@ -5,7 +5,7 @@
 
 namespace AdaptiveSharedNamespace
 {
-    class Paragraph
+    class Paragraph : public ElementPart
     {
     public:
         Paragraph();
@@ -16,6 +16,7 @@ namespace AdaptiveSharedNamespace
         ~Paragraph() = default;
 
         virtual Json::Value SerializeToJsonValue() const;
+        std::shared_ptr<Paragraph> Clone() const;
 
         std::vector<std::shared_ptr<Inline>>& GetInlines();
         const std::vector<std::shared_ptr<Inline>>& GetInlines() const;
@@ -29,7 +30,7 @@ namespace AdaptiveSharedNamespace
         void PopulateKnownPropertiesSet();
 
         std::vector<std::shared_ptr<Inline>> m_inlines;
-        std::unordered_set<std::string> m_knownProperties;
+        KnownPropertiesSet m_knownProperties;
         Json::Value m_additionalProperties;
     };
 }
@@ -3,6 +3,7 @@
 #include "AdaptiveCardParseException.h"
 #include "BaseElement.h"
 #include "CollectionTypeElement.h"
+#include "ToggleVisibilityTarget.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -287,10 +288,123 @@ namespace AdaptiveSharedNamespace
         }
     }
 
+    bool ParseContext::IsAtRoot() const
+    {
+        return m_idStack.empty();
+    }
+
+    void ParseContext::AddToElementIndex(const std::shared_ptr<BaseCardElement>& element, std::size_t ordinal)
+    {
+        m_elementIndex.Add(element, ordinal);
+    }
+
+    void ParseContext::AddToElementIndex(const std::shared_ptr<BaseActionElement>& action, std::size_t ordinal)
+    {
+        m_elementIndex.Add(action, ordinal);
+    }
+
+    void ParseContext::AddToggleVisibilityTarget(const std::shared_ptr<ToggleVisibilityTarget>& target)
+    {
+        m_toggleVisibilityTargets.push_back(target);
+    }
+
+    ElementIdIndex ParseContext::TakeElementIndex()
+    {
+        for (const auto& target : m_toggleVisibilityTargets)
+        {
+            target->SetElement(m_elementIndex.FindCardElement(target->GetElementIdRef()));
+        }
+        m_toggleVisibilityTargets.clear();
+
+        ElementIdIndex index = std::move(m_elementIndex);
+        m_elementIndex.Clear();
+        m_nextElementOrdinal = 0;
+        return index;
+    }
+
     void ParseContext::SetLanguage(const std::string& value)
     {
         m_language = value;
     }
 
     std::string ParseContext::GetLanguage() const { return m_language; }
+
+    void ParseContext::SetShowCardVersion(const std::string& value) { m_showCardVersion = value; }
+
+    const std::string& ParseContext::GetShowCardVersion() const { return m_showCardVersion; }
+
+    void ParseContext::SetChoiceIndexThreshold(std::size_t minimumChoices) { m_choiceIndexThreshold = minimumChoices; }
+
+    std::size_t ParseContext::GetChoiceIndexThreshold() const { return m_choiceIndexThreshold; }
+
+    void ParseContext::SetUrlRewriter(UrlRewriter rewriter, std::size_t memoCapacity)
+    {
+        m_urlRewriter = std::move(rewriter);
+        m_urlMemoCapacity = memoCapacity;
+        m_urlMemo.clear();
+    }
+
+    const ParseContext::UrlRewriter& ParseContext::GetUrlRewriter() const { return m_urlRewriter; }
+
+    std::size_t ParseContext::GetUrlMemoCapacity() const { return m_urlMemoCapacity; }
+
+    void ParseContext::SetResourceCallback(ResourceCallback callback)
+    {
+        m_resourceCallback = std::move(callback);
+        m_reportedUrls.clear();
+    }
+
+    const ParseContext::ResourceCallback& ParseContext::GetResourceCallback() const { return m_resourceCallback; }
+
+    void ParseContext::BeginCard() { m_reportedUrls.clear(); }
+
+    void ParseContext::SetDataUriImageSizing(bool enabled) { m_dataUriImageSizing = enabled; }
+
+    bool ParseContext::GetDataUriImageSizing() const { return m_dataUriImageSizing; }
+
+    void ParseContext::ReadUrl(UrlKind kind, std::string& url)
+    {
+        if (url.empty())
+        {
+            return;
+        }
+
+        RewriteUrl(kind, url);
+        if (m_resourceCallback && kind != UrlKind::OpenUrl && m_reportedUrls.insert(url).second)
+        {
+            m_resourceCallback(kind, url);
+        }
+    }
+
+    void ParseContext::RewriteUrl(UrlKind kind, std::string& url)
+    {
+        if (!m_urlRewriter)
+        {
+            return;
+        }
+        if (m_urlMemoCapacity == 0)
+        {
+            m_urlRewriter(kind, url);
+            return;
+        }
+
+        std::string key;
+        key.reserve(url.size() + 1);
+        key.push_back(static_cast<char>('0' + static_cast<int>(kind)));
+        key += url;
+
+        const auto memo = m_urlMemo.find(key);
+        if (memo != m_urlMemo.end())
+        {
+            url = memo->second;
+            return;
+        }
+
+        m_urlRewriter(kind, url);
+        if (m_urlMemo.size() >= m_urlMemoCapacity)
+        {
+            m_urlMemo.clear();
+        }
+        m_urlMemo.emplace(std::move(key), url);
+    }
 }
@@ -5,12 +5,26 @@
 #include "ElementParserRegistration.h"
 #include "ActionParserRegistration.h"
 #include "AdaptiveCardParseWarning.h"
+#include "ElementIdIndex.h"
 
 namespace AdaptiveSharedNamespace
 {
     class BaseElement;
     class InternalId;
     class CollectionTypeElement;
+    class ToggleVisibilityTarget;
+
+    // The URL-typed properties passed to a ParseContext's url rewriter
+    enum class UrlKind
+    {
+        Image,
+        BackgroundImage,
+        MediaSource,
+        MediaPoster,
+        ActionIcon,
+        OpenUrl
+    };
+
     class ParseContext
     {
     public:
@@ -27,9 +41,62 @@ namespace AdaptiveSharedNamespace
                          const bool isFallback = false);
         void PopElement();
 
+        // True while no element is being parsed, i.e. at the level of the outermost card rather than a ShowCard's card
+        bool IsAtRoot() const;
+
+        // Records parsed elements by id and type, and toggle targets to resolve against those ids once the whole card has
+        // been seen (a target may precede its element in the document). An element's ordinal is taken from
+        // NextElementOrdinal before its children are parsed, so that ordinals follow pre-order.
+        std::size_t NextElementOrdinal() { return m_nextElementOrdinal++; }
+        void AddToElementIndex(const std::shared_ptr<BaseCardElement>& element, std::size_t ordinal);
+        void AddToElementIndex(const std::shared_ptr<BaseActionElement>& action, std::size_t ordinal);
+        void AddToggleVisibilityTarget(const std::shared_ptr<ToggleVisibilityTarget>& target);
+
+        // Resolves the recorded toggle targets and hands over the index, leaving the context ready for another parse
+        ElementIdIndex TakeElementIndex();
+
         void SetLanguage(const std::string& value);
         std::string GetLanguage() const;
 
+        // The version given by the card whose actions are being parsed, which the cards of its ShowCard actions take
+        // when they give none. Empty elsewhere, including in the card's body.
+        void SetShowCardVersion(const std::string& value);
+        const std::string& GetShowCardVersion() const;
+
+        // Choice sets with at least this many choices get a lookup index while parsing (see
+        // ChoiceSetInput::BuildChoiceIndex). 0, the default, turns indexing off.
+        void SetChoiceIndexThreshold(std::size_t minimumChoices);
+        std::size_t GetChoiceIndexThreshold() const;
+
+        // Called for each URL-typed property as it's read (image urls, background images, media sources and posters,
+        // action icons and OpenUrl targets) to rewrite it in place, e.g. to resolve HostConfig's imageBaseUrl or route
+        // through a proxy, without a second pass over the card. Empty urls aren't passed. With a memoCapacity, up to
+        // that many distinct urls keep their rewritten form, so that repeated urls are rewritten once; the memo is
+        // emptied when it fills up.
+        using UrlRewriter = std::function<void(UrlKind kind, std::string& url)>;
+        void SetUrlRewriter(UrlRewriter rewriter, std::size_t memoCapacity = 0);
+        const UrlRewriter& GetUrlRewriter() const;
+        std::size_t GetUrlMemoCapacity() const;
+
+        // Called with each distinct resource url (any UrlKind but OpenUrl) as soon as it has been read and rewritten,
+        // so that a host can start downloads before parsing finishes. Urls are distinct per card: a context reused for
+        // another card reports that card's urls again. See also BuildPrefetchPlan.
+        using ResourceCallback = std::function<void(UrlKind kind, const std::string& url)>;
+        void SetResourceCallback(ResourceCallback callback);
+        const ResourceCallback& GetResourceCallback() const;
+
+        // Called as the outermost card starts parsing, to forget the urls reported for the cards parsed before it
+        void BeginCard();
+
+        // When enabled, images whose url is a base64 data: uri get their intrinsic size read from the image header
+        // while parsing (see Image::GetIntrinsicSize), so that layout can reserve space before the image is decoded.
+        // Off by default.
+        void SetDataUriImageSizing(bool enabled);
+        bool GetDataUriImageSizing() const;
+
+        // Parsers call this for each URL-typed property they read, to rewrite the url and report it
+        void ReadUrl(UrlKind kind, std::string& url);
+
         ContainerStyle GetParentalContainerStyle() const;
         AdaptiveSharedNamespace::InternalId PaddingParentInternalId() const;
         void SaveContextForCollectionTypeElement(
@@ -38,6 +105,7 @@ namespace AdaptiveSharedNamespace
             const std::shared_ptr<CollectionTypeElement>& current);
 
     private:
+        void RewriteUrl(UrlKind kind, std::string& url);
         const AdaptiveSharedNamespace::InternalId GetNearestFallbackId(const AdaptiveSharedNamespace::InternalId& skipId) const;
         // This enum is just a helper to keep track of the position of contents within the std::tuple used in m_idStack
         // below. We don't use enum class here because we don't want typed values for use in std::get
@@ -67,5 +135,21 @@ namespace AdaptiveSharedNamespace
         std::vector<AdaptiveSharedNamespace::InternalId> m_parentalPadding;
 
         std::string m_language;
+        std::string m_showCardVersion;
+        std::size_t m_choiceIndexThreshold = 0;
+
+        UrlRewriter m_urlRewriter;
+        std::size_t m_urlMemoCapacity = 0;
+        // rewritten urls by kind (as a leading character) and original url
+        std::unordered_map<std::string, std::string> m_urlMemo;
+
+        bool m_dataUriImageSizing = false;
+
+        ResourceCallback m_resourceCallback;
+        std::unordered_set<std::string> m_reportedUrls;
+
+        ElementIdIndex m_elementIndex;
+        std::size_t m_nextElementOrdinal = 0;
+        std::vector<std::shared_ptr<ToggleVisibilityTarget>> m_toggleVisibilityTargets;
     };
 }
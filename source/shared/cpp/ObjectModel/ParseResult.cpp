@@ -1,12 +1,32 @@
 #include "pch.h"
 #include "ParseResult.h"
-#include "ParseResult.h"
 #include "SharedAdaptiveCard.h"
 
 using namespace AdaptiveSharedNamespace;
 
 ParseResult::ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings) :
-    m_adaptiveCard(adaptiveCard), m_warnings(warnings)
+    m_adaptiveCard(adaptiveCard), m_warnings(warnings), m_hasElementIndex(false)
+{
+    if (m_adaptiveCard != nullptr)
+    {
+        m_contentHash = m_adaptiveCard->ComputeContentHash();
+    }
+}
+
+ParseResult::ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard,
+                         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings,
+                         const ContentHash& contentHash) :
+    m_adaptiveCard(adaptiveCard),
+    m_warnings(warnings), m_contentHash(contentHash), m_hasElementIndex(false)
+{
+}
+
+ParseResult::ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard,
+                         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings,
+                         const ContentHash& contentHash,
+                         ElementIdIndex&& elementIndex) :
+    m_adaptiveCard(adaptiveCard),
+    m_warnings(warnings), m_contentHash(contentHash), m_elementIndex(std::move(elementIndex)), m_hasElementIndex(true)
 {
 }
 
@@ -19,3 +39,28 @@ std::vector<std::shared_ptr<AdaptiveCardParseWarning>> ParseResult::GetWarnings(
 {
     return m_warnings;
 }
+
+const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& ParseResult::GetWarningsRef() const
+{
+    return m_warnings;
+}
+
+const ContentHash& ParseResult::GetContentHash() const
+{
+    return m_contentHash;
+}
+
+bool ParseResult::HasElementIndex() const
+{
+    return m_hasElementIndex;
+}
+
+const ElementIdIndex& ParseResult::GetElementIndex() const
+{
+    return m_elementIndex;
+}
+
+std::shared_ptr<BaseElement> ParseResult::GetElementById(const std::string& id) const
+{
+    return m_elementIndex.Find(id);
+}
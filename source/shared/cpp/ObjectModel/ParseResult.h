@@ -1,6 +1,8 @@
 #pragma once
 
 #include "pch.h"
+#include "ContentHash.h"
+#include "ElementIdIndex.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -9,14 +11,39 @@ namespace AdaptiveSharedNamespace
 
     class ParseResult
     {
+        friend class CardPatcher;
+
     public:
         ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard, std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings);
+        ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard,
+                    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings,
+                    const ContentHash& contentHash);
+        ParseResult(std::shared_ptr<AdaptiveCard> adaptiveCard,
+                    std::vector<std::shared_ptr<AdaptiveCardParseWarning>> warnings,
+                    const ContentHash& contentHash,
+                    ElementIdIndex&& elementIndex);
 
         std::shared_ptr<AdaptiveCard> GetAdaptiveCard() const;
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> GetWarnings() const;
+        const std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& GetWarningsRef() const;
+
+        // Hash of the card's canonical form (see AdaptiveCard::SerializeToCanonicalString). Cards that differ only in
+        // key order, whitespace or explicitly spelled default values hash equal.
+        const ContentHash& GetContentHash() const;
+
+        // Elements and actions of the parsed card by id and type, including those inside ShowCard cards and fallback
+        // content. The index reflects the card as parsed and as patched by a CardPatcher made from this result; elements
+        // added by other means aren't in it. Results that weren't produced by parsing a card's elements (e.g. the
+        // fallback text card for an unsupported version) have no index.
+        bool HasElementIndex() const;
+        const ElementIdIndex& GetElementIndex() const;
+        std::shared_ptr<BaseElement> GetElementById(const std::string& id) const;
 
     private:
         std::shared_ptr<AdaptiveCard> m_adaptiveCard;
         std::vector<std::shared_ptr<AdaptiveCardParseWarning>> m_warnings;
+        ContentHash m_contentHash;
+        ElementIdIndex m_elementIndex;
+        bool m_hasElementIndex;
     };
 }
@@ -0,0 +1,139 @@
+#include "pch.h"
+#include "ParseResultCache.h"
+#include "ParseContext.h"
+#include "SharedAdaptiveCard.h"
+
+namespace
+{
+    // Rough cost of an entry beyond its json: list and index nodes, the ParseResult and the card object itself
+    constexpr std::size_t c_entryOverhead = 512;
+}
+
+namespace AdaptiveSharedNamespace
+{
+    ParseResultCache::ParseResultCache(std::size_t memoryBudget) :
+        m_memoryBudget(memoryBudget), m_memoryUsage(0), m_hits(0), m_misses(0), m_evictions(0)
+    {
+    }
+
+    std::shared_ptr<const ParseResult> ParseResultCache::DeserializeFromString(const std::string& jsonString,
+                                                                               const std::string& rendererVersion)
+    {
+        ParseContext context;
+        return DeserializeFromString(jsonString, rendererVersion, context);
+    }
+
+    std::shared_ptr<const ParseResult> ParseResultCache::DeserializeFromString(const std::string& jsonString,
+                                                                               const std::string& rendererVersion,
+                                                                               ParseContext& context)
+    {
+        if (!IsCacheable(context))
+        {
+            std::shared_ptr<const ParseResult> result = AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context);
+            result->GetAdaptiveCard()->Freeze();
+            return result;
+        }
+
+        const ContentHash key = ComputeKey(jsonString, rendererVersion, context);
+
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            auto found = m_index.find(key);
+            if (found != m_index.end())
+            {
+                ++m_hits;
+                m_entries.splice(m_entries.begin(), m_entries, found->second);
+                std::shared_ptr<const ParseResult> result = found->second->result;
+
+                const auto& warnings = result->GetWarningsRef();
+                context.warnings.insert(context.warnings.end(), warnings.begin(), warnings.end());
+                return result;
+            }
+            ++m_misses;
+        }
+
+        // Parse without holding the lock. Parse failures throw and are never cached.
+        std::shared_ptr<const ParseResult> result = AdaptiveCard::DeserializeFromString(jsonString, rendererVersion, context);
+        result->GetAdaptiveCard()->Freeze();
+
+        const std::size_t charge = jsonString.size() + c_entryOverhead;
+
+        std::lock_guard<std::mutex> lock(m_lock);
+        if (charge > m_memoryBudget)
+        {
+            return result;
+        }
+
+        // Another thread may have parsed the same card in the meantime; keep the first result so callers share it
+        auto found = m_index.find(key);
+        if (found != m_index.end())
+        {
+            return found->second->result;
+        }
+
+        m_entries.push_front(Entry{key, result, charge});
+        m_index.emplace(key, m_entries.begin());
+        m_memoryUsage += charge;
+        EvictToBudget();
+
+        return result;
+    }
+
+    ParseResultCache::Statistics ParseResultCache::GetStatistics() const
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return Statistics{m_hits, m_misses, m_evictions, m_entries.size(), m_memoryUsage};
+    }
+
+    std::size_t ParseResultCache::GetMemoryBudget() const
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        return m_memoryBudget;
+    }
+
+    void ParseResultCache::SetMemoryBudget(std::size_t memoryBudget)
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_memoryBudget = memoryBudget;
+        EvictToBudget();
+    }
+
+    void ParseResultCache::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_entries.clear();
+        m_index.clear();
+        m_memoryUsage = 0;
+    }
+
+    bool ParseResultCache::IsCacheable(const ParseContext& context)
+    {
+        return !context.GetUrlRewriter() && !context.GetResourceCallback();
+    }
+
+    ContentHash ParseResultCache::ComputeKey(const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context)
+    {
+        ContentHasher hasher;
+        hasher.Append(jsonString);
+        hasher.Append(rendererVersion);
+        // cards without a "lang" inherit the context's language
+        hasher.Append(context.GetLanguage());
+        hasher.Append(static_cast<std::uint64_t>(context.GetChoiceIndexThreshold()));
+        hasher.Append(static_cast<std::uint64_t>(context.GetDataUriImageSizing()));
+        hasher.Append(context.elementParserRegistration->GetFingerprint());
+        hasher.Append(context.actionParserRegistration->GetFingerprint());
+        return hasher.Finish();
+    }
+
+    void ParseResultCache::EvictToBudget()
+    {
+        while (m_memoryUsage > m_memoryBudget && !m_entries.empty())
+        {
+            const Entry& leastRecentlyUsed = m_entries.back();
+            m_memoryUsage -= leastRecentlyUsed.charge;
+            m_index.erase(leastRecentlyUsed.key);
+            m_entries.pop_back();
+            ++m_evictions;
+        }
+    }
+}
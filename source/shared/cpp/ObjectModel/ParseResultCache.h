@@ -0,0 +1,76 @@
+#pragma once
+
+#include "pch.h"
+#include "ContentHash.h"
+#include "ParseResult.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class ParseContext;
+
+    // Opt-in LRU cache in front of AdaptiveCard::DeserializeFromString. Byte-identical card json parsed for the same
+    // renderer version with the same parser registrations is parsed once and the resulting ParseResult is shared by
+    // every caller. Cached cards are frozen (see AdaptiveCard::Freeze); use AdaptiveCard::Derive to modify one, or
+    // AdaptiveCard::Clone to hand one to a renderer that writes to the model.
+    //
+    // All members are safe to call from multiple threads.
+    class ParseResultCache
+    {
+    public:
+        struct Statistics
+        {
+            std::uint64_t hits;
+            std::uint64_t misses;
+            std::uint64_t evictions;
+            std::size_t entryCount;
+            std::size_t memoryUsage;
+        };
+
+        // memoryBudget is in bytes. Entries are charged the size of their card json plus a fixed per-entry overhead,
+        // which approximates the parsed card's footprint without walking it.
+        explicit ParseResultCache(std::size_t memoryBudget);
+
+        ParseResultCache(const ParseResultCache&) = delete;
+        ParseResultCache& operator=(const ParseResultCache&) = delete;
+
+        std::shared_ptr<const ParseResult> DeserializeFromString(const std::string& jsonString, const std::string& rendererVersion);
+
+        // The context's parser registrations, language and parse options are part of the cache key. On a hit, the cached warnings are
+        // appended to context.warnings just as a parse would have done. A context with a url rewriter or a resource
+        // callback always parses (the result is still frozen but isn't cached), since the rewriter's output can't be
+        // keyed on and the callback must see every url the card reads.
+        std::shared_ptr<const ParseResult> DeserializeFromString(const std::string& jsonString,
+                                                                 const std::string& rendererVersion,
+                                                                 ParseContext& context);
+
+        Statistics GetStatistics() const;
+        std::size_t GetMemoryBudget() const;
+        void SetMemoryBudget(std::size_t memoryBudget);
+        void Clear();
+
+    private:
+        struct Entry
+        {
+            ContentHash key;
+            std::shared_ptr<const ParseResult> result;
+            std::size_t charge;
+        };
+
+        static bool IsCacheable(const ParseContext& context);
+        static ContentHash ComputeKey(const std::string& jsonString, const std::string& rendererVersion, const ParseContext& context);
+
+        // Must be called with m_lock held
+        void EvictToBudget();
+
+        mutable std::mutex m_lock;
+        std::size_t m_memoryBudget;
+        std::size_t m_memoryUsage;
+        std::uint64_t m_hits;
+        std::uint64_t m_misses;
+        std::uint64_t m_evictions;
+
+        // most recently used first
+        std::list<Entry> m_entries;
+        std::unordered_map<ContentHash, std::list<Entry>::iterator, ContentHashKeyHash> m_index;
+    };
+}
@@ -22,6 +22,19 @@ namespace AdaptiveSharedNamespace
         return outStream.str();
     }
 
+    std::string ParseUtil::JsonToCanonicalString(const Json::Value& json)
+    {
+        Json::StreamWriterBuilder builder;
+        builder["commentStyle"] = "None";
+        builder["indentation"] = "";
+        builder["precision"] = 17;
+        std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
+
+        std::ostringstream outStream;
+        writer->write(json, &outStream);
+        return outStream.str();
+    }
+
     void ParseUtil::ThrowIfNotJsonObject(const Json::Value& json)
     {
         if (!json.isObject())
@@ -133,20 +146,25 @@ namespace AdaptiveSharedNamespace
     }
 
     std::shared_ptr<BackgroundImage> ParseUtil::GetBackgroundImage(const Json::Value& json)
+    {
+        ParseContext context;
+        return GetBackgroundImage(context, json);
+    }
+
+    std::shared_ptr<BackgroundImage> ParseUtil::GetBackgroundImage(ParseContext& context, const Json::Value& json)
     {
         try
         {
             // handle "backgroundImage": <string>
             std::string backgroundImageUrl = ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundImage, false);
-            if (backgroundImageUrl != "")
+            if (backgroundImageUrl == "")
             {
-                return std::shared_ptr<BackgroundImage>(new BackgroundImage(backgroundImageUrl));
+                // handle "backgroundImageUrl": <string>
+                backgroundImageUrl = ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundImageUrl, false);
             }
-
-            // handle "backgroundImageUrl": <string>
-            backgroundImageUrl = ParseUtil::GetString(json, AdaptiveCardSchemaKey::BackgroundImageUrl, false);
             if (backgroundImageUrl != "")
             {
+                context.ReadUrl(UrlKind::BackgroundImage, backgroundImageUrl);
                 return std::shared_ptr<BackgroundImage>(new BackgroundImage(backgroundImageUrl));
             }
             return nullptr;
@@ -155,7 +173,7 @@ namespace AdaptiveSharedNamespace
         {
             // handle "backgroundImage": { <content> }
             auto jsonValue = ParseUtil::ExtractJsonValue(json, AdaptiveCardSchemaKey::BackgroundImage, false);
-            return BackgroundImage::Deserialize(jsonValue);
+            return BackgroundImage::Deserialize(context, jsonValue);
         }
     }
 
@@ -307,8 +325,13 @@ namespace AdaptiveSharedNamespace
 
     Json::Value ParseUtil::GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto elementArray = json.get(propertyName, Json::Value());
+        return GetArrayRef(json, key, isRequired);
+    }
+
+    const Json::Value& ParseUtil::GetArrayRef(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        const std::string propertyName = AdaptiveCardSchemaKeyToString(key);
+        const auto& elementArray = ExtractJsonValueRef(json, key, false);
         if (isRequired && elementArray.empty())
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
@@ -341,14 +364,19 @@ namespace AdaptiveSharedNamespace
 
     Json::Value ParseUtil::ExtractJsonValue(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        std::string propertyName = AdaptiveCardSchemaKeyToString(key);
-        auto propertyValue = json.get(propertyName, Json::Value());
-        if (isRequired && propertyValue.empty())
+        return ExtractJsonValueRef(json, key, isRequired);
+    }
+
+    const Json::Value& ParseUtil::ExtractJsonValueRef(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
+    {
+        const std::string propertyName = AdaptiveCardSchemaKeyToString(key);
+        const Json::Value* propertyValue = json.find(propertyName.data(), propertyName.data() + propertyName.size());
+        if (isRequired && (propertyValue == nullptr || propertyValue->empty()))
         {
             throw AdaptiveCardParseException(ErrorStatusCode::RequiredPropertyMissing,
                                              "Could not extract required key: " + propertyName + ".");
         }
-        return propertyValue;
+        return (propertyValue == nullptr) ? Json::Value::nullSingleton() : *propertyValue;
     }
 
     std::string ParseUtil::ToLowercase(std::string const& value)
@@ -366,24 +394,22 @@ namespace AdaptiveSharedNamespace
                                                                                   AdaptiveCardSchemaKey key,
                                                                                   bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArrayRef(json, key, isRequired);
 
         std::vector<std::shared_ptr<BaseCardElement>> elements;
         if (elementArray.empty())
         {
-            return std::move(elements);
+            return elements;
         }
 
         elements.reserve(elementArray.size());
 
         for (const auto& curJsonValue : elementArray)
         {
-            std::shared_ptr<BaseElement> curElement;
-            BaseElement::ParseJsonObject<BaseCardElement>(context, curJsonValue, curElement);
-            elements.push_back(std::static_pointer_cast<BaseCardElement>(curElement));
+            elements.push_back(BaseCardElement::DeserializeElement(context, curJsonValue));
         }
 
-        return std::move(elements);
+        return elements;
     }
 
     std::shared_ptr<BaseActionElement> ParseUtil::GetActionFromJsonValue(ParseContext& context, const Json::Value& json)
@@ -417,7 +443,7 @@ namespace AdaptiveSharedNamespace
                                                                                    AdaptiveCardSchemaKey key,
                                                                                    bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArrayRef(json, key, isRequired);
 
         std::vector<std::shared_ptr<BaseActionElement>> elements;
 
@@ -433,7 +459,7 @@ namespace AdaptiveSharedNamespace
             auto action = ParseUtil::GetActionFromJsonValue(context, curJsonValue);
             if (action != nullptr)
             {
-                elements.push_back(action);
+                elements.push_back(std::move(action));
             }
         }
 
@@ -442,7 +468,7 @@ namespace AdaptiveSharedNamespace
 
     std::shared_ptr<BaseActionElement> ParseUtil::GetAction(ParseContext& context, const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired)
     {
-        auto selectAction = ParseUtil::ExtractJsonValue(json, key, isRequired);
+        const auto& selectAction = ParseUtil::ExtractJsonValueRef(json, key, isRequired);
 
         if (!selectAction.empty())
         {
@@ -14,6 +14,10 @@ namespace AdaptiveSharedNamespace
     {
         std::string JsonToString(const Json::Value& json);
 
+        // Compact json with members in sorted key order and no trailing newline. Equal values always produce
+        // byte-identical output.
+        std::string JsonToCanonicalString(const Json::Value& json);
+
         void ThrowIfNotJsonObject(const Json::Value& json);
 
         std::string GetTypeAsString(const Json::Value& json);
@@ -31,6 +35,8 @@ namespace AdaptiveSharedNamespace
 
         std::shared_ptr<BackgroundImage> GetBackgroundImage(const Json::Value& json);
 
+        std::shared_ptr<BackgroundImage> GetBackgroundImage(ParseContext& context, const Json::Value& json);
+
         bool GetBool(const Json::Value& json, AdaptiveCardSchemaKey key, bool defaultValue, bool isRequired = false);
 
         unsigned int GetUInt(const Json::Value& json, AdaptiveCardSchemaKey key, unsigned int defaultValue, bool isRequired = false);
@@ -46,10 +52,13 @@ namespace AdaptiveSharedNamespace
         ActionType TryGetActionType(const Json::Value& json);
 
         Json::Value GetArray(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
+        // Non-copying counterpart of GetArray: a reference into json, or to a null value if the key is absent
+        const Json::Value& GetArrayRef(const Json::Value& json, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         Json::Value GetJsonValueFromString(const std::string& jsonString);
 
         Json::Value ExtractJsonValue(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
+        const Json::Value& ExtractJsonValueRef(const Json::Value& jsonRoot, AdaptiveCardSchemaKey key, bool isRequired = false);
 
         template<typename T>
         T GetEnumValue(const Json::Value& json,
@@ -146,7 +155,7 @@ namespace AdaptiveSharedNamespace
         const std::function<std::shared_ptr<T>(ParseContext& context, const Json::Value&)>& deserializer,
         bool isRequired)
     {
-        auto elementArray = GetArray(json, key, isRequired);
+        const auto& elementArray = GetArrayRef(json, key, isRequired);
 
         std::vector<std::shared_ptr<T>> elements;
         if (elementArray.empty())
@@ -163,7 +172,7 @@ namespace AdaptiveSharedNamespace
             auto el = deserializer(context, curJsonValue);
             if (el != nullptr)
             {
-                elements.push_back(el);
+                elements.push_back(std::move(el));
             }
         }
 
@@ -176,7 +185,7 @@ namespace AdaptiveSharedNamespace
                                                      const T& defaultValue,
                                                      const std::function<T(const Json::Value&, const T&)>& deserializer)
     {
-        auto jsonObject = ParseUtil::ExtractJsonValue(rootJson, key);
+        const auto& jsonObject = ParseUtil::ExtractJsonValueRef(rootJson, key);
         T result = jsonObject.empty() ? defaultValue : deserializer(jsonObject, defaultValue);
         return result;
     }
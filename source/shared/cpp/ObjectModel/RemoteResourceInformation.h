@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pch.h"
+#include "ImageHeaderUtil.h"
 
 namespace AdaptiveSharedNamespace
 {
@@ -8,6 +9,8 @@ namespace AdaptiveSharedNamespace
     {
         std::string url;
         std::string mimeType;
+        // Only known for data: uri images parsed with ParseContext::SetDataUriImageSizing
+        IntrinsicImageSize intrinsicSize;
     };
 
 }
@@ -0,0 +1,127 @@
+#include "pch.h"
+#include "ResourcePrefetchPlan.h"
+#include "BackgroundImage.h"
+#include "CardTraversal.h"
+#include "CollectionTypeElement.h"
+#include "Image.h"
+#include "Media.h"
+#include "MediaSource.h"
+#include "SharedAdaptiveCard.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        class PlanBuilder
+        {
+        public:
+            void Add(const std::string& url, UrlKind kind, bool isVisible, const std::string& mimeType = std::string(), unsigned int pixelWidth = 0, unsigned int pixelHeight = 0)
+            {
+                if (url.empty())
+                {
+                    return;
+                }
+
+                const auto known = m_indices.find(url);
+                if (known == m_indices.end())
+                {
+                    m_indices.emplace(url, m_resources.size());
+                    m_resources.push_back(PrefetchResource{url, kind, mimeType, isVisible, pixelWidth, pixelHeight});
+                    return;
+                }
+
+                PrefetchResource& resource = m_resources[known->second];
+                resource.isInitiallyVisible = resource.isInitiallyVisible || isVisible;
+                if (resource.pixelWidth == 0 && resource.pixelHeight == 0)
+                {
+                    resource.pixelWidth = pixelWidth;
+                    resource.pixelHeight = pixelHeight;
+                }
+            }
+
+            void AddBackgroundImage(const std::shared_ptr<BackgroundImage>& backgroundImage, bool isVisible)
+            {
+                if (backgroundImage != nullptr)
+                {
+                    Add(backgroundImage->GetUrlRef(), UrlKind::BackgroundImage, isVisible);
+                }
+            }
+
+            std::vector<PrefetchResource> TakePlan()
+            {
+                std::stable_partition(m_resources.begin(), m_resources.end(), [](const PrefetchResource& resource) {
+                    return resource.isInitiallyVisible;
+                });
+                m_indices.clear();
+                return std::move(m_resources);
+            }
+
+        private:
+            std::vector<PrefetchResource> m_resources;
+            std::unordered_map<std::string, std::size_t> m_indices;
+        };
+    }
+
+    std::vector<PrefetchResource> BuildPrefetchPlan(AdaptiveCard& card)
+    {
+        PlanBuilder builder;
+
+        // the depths of the nodes enclosing the current one that aren't initially shown; everything beneath them isn't
+        // shown either
+        std::vector<unsigned int> hidden;
+        for (const CardNode& node : PreOrder(card))
+        {
+            while (!hidden.empty() && hidden.back() >= node.GetDepth())
+            {
+                hidden.pop_back();
+            }
+
+            const BaseCardElement* element = node.GetCardElement();
+            const bool isShowCardCard = node.GetKind() == CardNodeKind::Card && node.GetDepth() != 0;
+            if (node.IsFallback() || isShowCardCard || (element != nullptr && !element->GetIsVisible()))
+            {
+                hidden.push_back(node.GetDepth());
+            }
+            const bool isVisible = hidden.empty();
+
+            switch (node.GetKind())
+            {
+            case CardNodeKind::Card:
+                builder.AddBackgroundImage(node.GetCard()->GetBackgroundImage(), isVisible);
+                break;
+            case CardNodeKind::Action:
+                builder.Add(node.GetAction()->GetIconUrlRef(), UrlKind::ActionIcon, isVisible);
+                break;
+            case CardNodeKind::CardElement:
+                switch (node.GetCardElementType())
+                {
+                case CardElementType::Image:
+                {
+                    const auto& image = static_cast<const Image&>(*element);
+                    builder.Add(image.GetUrlRef(), UrlKind::Image, isVisible, std::string(), image.GetPixelWidth(), image.GetPixelHeight());
+                    break;
+                }
+                case CardElementType::Media:
+                {
+                    const auto& media = static_cast<const Media&>(*element);
+                    builder.Add(media.GetPosterRef(), UrlKind::MediaPoster, isVisible);
+                    for (const auto& source : media.GetSources())
+                    {
+                        builder.Add(source->GetUrlRef(), UrlKind::MediaSource, isVisible, source->GetMimeTypeRef());
+                    }
+                    break;
+                }
+                case CardElementType::Column:
+                case CardElementType::ColumnSet:
+                case CardElementType::Container:
+                    builder.AddBackgroundImage(static_cast<const CollectionTypeElement&>(*element).GetBackgroundImage(), isVisible);
+                    break;
+                default:
+                    break;
+                }
+                break;
+            }
+        }
+        return builder.TakePlan();
+    }
+}
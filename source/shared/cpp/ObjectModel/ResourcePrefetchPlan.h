@@ -0,0 +1,33 @@
+#pragma once
+
+#include "pch.h"
+#include "ParseContext.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+
+    struct PrefetchResource
+    {
+        std::string url;
+        // never UrlKind::OpenUrl, which isn't a resource
+        UrlKind kind;
+        // Only known for media sources
+        std::string mimeType;
+        // Whether the resource is used by content shown when the card is first rendered, rather than only by hidden
+        // elements, the cards of ShowCard actions or fallback content
+        bool isInitiallyVisible;
+        // An image's explicit pixel size; 0 when not given
+        unsigned int pixelWidth;
+        unsigned int pixelHeight;
+    };
+
+    // The resources a card uses, for fetching ahead of rendering: each url appears once, initially visible resources
+    // come first, and within each group resources are in document order (background images ahead of an element's
+    // content, as the card graph is walked; see CardTraversal.h). A url used in several places is initially visible if
+    // any of its uses is, and takes the first pixel size given for it. Unlike AdaptiveCard::GetResourceInformation,
+    // resources are typed by UrlKind and include action icons.
+    //
+    // To start downloads while the card is still being parsed, set a resource callback on the ParseContext instead.
+    std::vector<PrefetchResource> BuildPrefetchPlan(AdaptiveCard& card);
+}
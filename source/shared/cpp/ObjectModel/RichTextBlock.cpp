@@ -5,6 +5,7 @@
 #include <codecvt>
 #include "ParseContext.h"
 #include "RichTextBlock.h"
+#include "TextRun.h"
 #include "DateTimePreparser.h"
 #include "ParseUtil.h"
 
@@ -14,7 +15,6 @@ RichTextBlock::RichTextBlock() :
     BaseCardElement(CardElementType::RichTextBlock), m_wrap(false), m_maxLines(0),
     m_hAlignment(HorizontalAlignment::Left)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value RichTextBlock::SerializeToJsonValue() const
@@ -53,6 +53,7 @@ bool RichTextBlock::GetWrap() const
 
 void RichTextBlock::SetWrap(const bool value)
 {
+    MarkChanged();
     m_wrap = value;
 }
 
@@ -63,6 +64,7 @@ unsigned int RichTextBlock::GetMaxLines() const
 
 void RichTextBlock::SetMaxLines(const unsigned int value)
 {
+    MarkChanged();
     m_maxLines = value;
 }
 
@@ -73,11 +75,13 @@ HorizontalAlignment RichTextBlock::GetHorizontalAlignment() const
 
 void RichTextBlock::SetHorizontalAlignment(const HorizontalAlignment value)
 {
+    MarkChanged();
     m_hAlignment = value;
 }
 
 std::vector<std::shared_ptr<Paragraph>>& RichTextBlock::GetParagraphs()
 {
+    ThrowIfFrozen();
     return m_paragraphs;
 }
 
@@ -110,8 +114,71 @@ std::shared_ptr<BaseCardElement> RichTextBlockParser::DeserializeFromString(Pars
 
 void RichTextBlock::PopulateKnownPropertiesSet()
 {
+    BaseCardElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Paragraphs),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
 }
+
+std::shared_ptr<BaseElement> RichTextBlock::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void RichTextBlock::VisitNested(NestedVisitor& visitor) const
+{
+    BaseCardElement::VisitNested(visitor);
+    for (const auto& paragraph : m_paragraphs)
+    {
+        visitor.Part(*paragraph);
+        for (const auto& inlineElement : static_cast<const Paragraph&>(*paragraph).GetInlines())
+        {
+            visitor.Part(*inlineElement);
+            if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+            {
+                // serialized by the text run itself
+                const auto selectAction = static_cast<const TextRun&>(*inlineElement).GetSelectAction();
+                if (selectAction != nullptr)
+                {
+                    visitor.Inline(*selectAction);
+                }
+            }
+        }
+    }
+}
+
+void RichTextBlock::Freeze()
+{
+    if (!IsFrozen())
+    {
+        // links the paragraphs and inlines, whose setters then throw
+        for (const auto& paragraph : m_paragraphs)
+        {
+            m_partOwner.Link(*this, *paragraph);
+            for (const auto& inlineElement : static_cast<const Paragraph&>(*paragraph).GetInlines())
+            {
+                m_partOwner.Link(*this, *inlineElement);
+                if (inlineElement->GetInlineType() == InlineElementType::TextRun)
+                {
+                    const auto selectAction = static_cast<const TextRun&>(*inlineElement).GetSelectAction();
+                    if (selectAction != nullptr)
+                    {
+                        selectAction->Freeze();
+                    }
+                }
+            }
+        }
+    }
+    BaseCardElement::Freeze();
+}
+
+void RichTextBlock::DeepCopyMembers()
+{
+    BaseCardElement::DeepCopyMembers();
+    for (auto& paragraph : m_paragraphs)
+    {
+        paragraph = paragraph->Clone();
+    }
+}
@@ -21,6 +21,9 @@ namespace AdaptiveSharedNamespace
         ~RichTextBlock() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         bool GetWrap() const;
         void SetWrap(const bool value);
@@ -35,6 +38,7 @@ namespace AdaptiveSharedNamespace
         const std::vector<std::shared_ptr<Paragraph>>& GetParagraphs() const;
 
     private:
+        void DeepCopyMembers() override;
         bool m_wrap;
         unsigned int m_maxLines;
         HorizontalAlignment m_hAlignment;
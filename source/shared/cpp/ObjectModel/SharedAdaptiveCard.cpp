@@ -11,8 +11,18 @@
 
 using namespace AdaptiveSharedNamespace;
 
+// Values derived from a frozen card on first use. call_once makes the first computation safe to race.
+struct AdaptiveCard::FrozenCardCache
+{
+    std::once_flag canonicalStringOnce;
+    std::string canonicalString;
+
+    std::once_flag resourceInformationOnce;
+    std::vector<RemoteResourceInformation> resourceInformation;
+};
+
 AdaptiveCard::AdaptiveCard() :
-    m_style(ContainerStyle::None), m_verticalContentAlignment(VerticalContentAlignment::Top), m_height(HeightType::Auto)
+    m_style(ContainerStyle::None), m_verticalContentAlignment(VerticalContentAlignment::Top), m_height(HeightType::Auto), m_frozen(false)
 {
 }
 
@@ -26,7 +36,7 @@ AdaptiveCard::AdaptiveCard(std::string const& version,
                            HeightType height) :
     m_version(version),
     m_fallbackText(fallbackText), m_speak(speak), m_style(style), m_language(language),
-    m_verticalContentAlignment(verticalContentAlignment), m_height(height)
+    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_frozen(false)
 {
     m_backgroundImage = std::shared_ptr<BackgroundImage>(new BackgroundImage(backgroundImageUrl));
 }
@@ -43,7 +53,7 @@ AdaptiveCard::AdaptiveCard(std::string const& version,
                            std::vector<std::shared_ptr<BaseActionElement>>& actions) :
     m_version(version),
     m_fallbackText(fallbackText), m_speak(speak), m_style(style), m_language(language),
-    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_body(body), m_actions(actions)
+    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_body(body), m_actions(actions), m_frozen(false)
 {
     m_backgroundImage = std::shared_ptr<BackgroundImage>(new BackgroundImage(backgroundImageUrl));
 }
@@ -58,7 +68,7 @@ AdaptiveCard::AdaptiveCard(std::string const& version,
                            HeightType height) :
     m_version(version),
     m_fallbackText(fallbackText), m_backgroundImage(backgroundImage), m_speak(speak), m_style(style),
-    m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height)
+    m_language(language), m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_frozen(false)
 {
 }
 
@@ -74,7 +84,24 @@ AdaptiveCard::AdaptiveCard(std::string const& version,
                            std::vector<std::shared_ptr<BaseActionElement>>& actions) :
     m_version(version),
     m_fallbackText(fallbackText), m_backgroundImage(backgroundImage), m_speak(speak), m_style(style), m_language(language),
-    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_body(body), m_actions(actions)
+    m_verticalContentAlignment(verticalContentAlignment), m_height(height), m_body(body), m_actions(actions), m_frozen(false)
+{
+}
+
+AdaptiveCard::AdaptiveCard(std::string&& version,
+                           std::string&& fallbackText,
+                           std::shared_ptr<BackgroundImage> backgroundImage,
+                           ContainerStyle style,
+                           std::string&& speak,
+                           std::string&& language,
+                           VerticalContentAlignment verticalContentAlignment,
+                           HeightType height,
+                           std::vector<std::shared_ptr<BaseCardElement>>&& body,
+                           std::vector<std::shared_ptr<BaseActionElement>>&& actions) :
+    m_version(std::move(version)),
+    m_fallbackText(std::move(fallbackText)), m_backgroundImage(std::move(backgroundImage)), m_speak(std::move(speak)),
+    m_style(style), m_language(std::move(language)), m_verticalContentAlignment(verticalContentAlignment), m_height(height),
+    m_body(std::move(body)), m_actions(std::move(actions)), m_frozen(false)
 {
 }
 
@@ -136,12 +163,24 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 {
     ParseUtil::ThrowIfNotJsonObject(json);
 
+    if (context.IsAtRoot())
+    {
+        context.BeginCard();
+    }
+
     const bool enforceVersion = !rendererVersion.empty();
 
     // Verify this is an adaptive card
     ParseUtil::ExpectTypeString(json, CardElementType::AdaptiveCard);
 
     std::string version = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Version, enforceVersion);
+    // the cards of this card's ShowCard actions take the version this card gives, if they give none
+    const std::string showCardVersion = version;
+    const std::string outerShowCardVersion = context.GetShowCardVersion();
+    if (version.empty())
+    {
+        version = outerShowCardVersion;
+    }
     std::string fallbackText = ParseUtil::GetString(json, AdaptiveCardSchemaKey::FallbackText);
     std::string language = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Language);
     std::string speak = ParseUtil::GetString(json, AdaptiveCardSchemaKey::Speak);
@@ -178,11 +217,12 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
 
             context.warnings.push_back(std::make_shared<AdaptiveCardParseWarning>(AdaptiveSharedNamespace::WarningStatusCode::UnsupportedSchemaVersion,
                                                                                   "Schema version not supported"));
-            return std::make_shared<ParseResult>(MakeFallbackTextCard(fallbackText, language, speak), context.warnings);
+            auto fallbackCard = MakeFallbackTextCard(fallbackText, language, speak);
+            return std::make_shared<ParseResult>(fallbackCard, context.warnings, fallbackCard->ComputeContentHash());
         }
     }
 
-    auto backgroundImage = ParseUtil::GetBackgroundImage(json);
+    auto backgroundImage = ParseUtil::GetBackgroundImage(context, json);
 
     ContainerStyle style =
         ParseUtil::GetEnumValue<ContainerStyle>(json, AdaptiveCardSchemaKey::Style, ContainerStyle::None, ContainerStyleFromString);
@@ -195,11 +235,12 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
         ParseUtil::GetEnumValue<HeightType>(json, AdaptiveCardSchemaKey::Height, HeightType::Auto, HeightTypeFromString);
 
     // Parse body
+    context.SetShowCardVersion("");
     auto body = ParseUtil::GetElementCollection(context, json, AdaptiveCardSchemaKey::Body, false);
     // Parse actions if present
+    context.SetShowCardVersion(showCardVersion);
     auto actions = ParseUtil::GetActionCollection(context, json, AdaptiveCardSchemaKey::Actions, false);
-
-    EnsureShowCardVersions(actions, version);
+    context.SetShowCardVersion(outerShowCardVersion);
 
     auto result = std::make_shared<AdaptiveCard>(
         version, fallbackText, backgroundImage, style, speak, language, verticalContentAlignment, height, body, actions);
@@ -208,7 +249,14 @@ std::shared_ptr<ParseResult> AdaptiveCard::Deserialize(const Json::Value& json,
     // Parse optional selectAction
     result->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-    return std::make_shared<ParseResult>(result, context.warnings);
+    // A ShowCard's card shares the context of the card it belongs to, whose result carries the index and content
+    // hash for both
+    if (context.IsAtRoot())
+    {
+        return std::make_shared<ParseResult>(result, context.warnings, result->ComputeContentHash(), context.TakeElementIndex());
+    }
+
+    return std::make_shared<ParseResult>(result, context.warnings, ContentHash());
 }
 
 #ifdef __ANDROID__
@@ -234,6 +282,28 @@ std::shared_ptr<ParseResult> AdaptiveCard::DeserializeFromString(const std::stri
 }
 
 Json::Value AdaptiveCard::SerializeToJsonValue() const
+{
+    Json::Value root = SerializeCardPropertiesToJsonValue();
+
+    std::string bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
+    root[bodyPropertyName] = Json::Value(Json::arrayValue);
+    for (const auto& cardElement : GetBody())
+    {
+        root[bodyPropertyName].append(BaseElement::SerializeNested(*cardElement));
+    }
+
+    std::string actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
+    root[actionsPropertyName] = Json::Value(Json::arrayValue);
+    for (const auto& action : GetActions())
+    {
+        root[actionsPropertyName].append(BaseElement::SerializeNested(*action));
+    }
+
+    return root;
+}
+
+// Everything but the body and actions
+Json::Value AdaptiveCard::SerializeCardPropertiesToJsonValue() const
 {
     Json::Value root;
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = CardElementTypeToString(CardElementType::AdaptiveCard);
@@ -251,7 +321,7 @@ Json::Value AdaptiveCard::SerializeToJsonValue() const
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FallbackText)] = m_fallbackText;
     }
-    if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrl().empty())
+    if (m_backgroundImage != nullptr && !m_backgroundImage->GetUrlRef().empty())
     {
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::BackgroundImage)] = m_backgroundImage->SerializeToJsonValue();
     }
@@ -279,20 +349,6 @@ Json::Value AdaptiveCard::SerializeToJsonValue() const
         root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Height)] = HeightTypeToString(GetHeight());
     }
 
-    std::string bodyPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Body);
-    root[bodyPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& cardElement : GetBody())
-    {
-        root[bodyPropertyName].append(cardElement->SerializeToJsonValue());
-    }
-
-    std::string actionsPropertyName = AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Actions);
-    root[actionsPropertyName] = Json::Value(Json::arrayValue);
-    for (const auto& action : GetActions())
-    {
-        root[actionsPropertyName].append(action->SerializeToJsonValue());
-    }
-
     return root;
 }
 
@@ -323,26 +379,72 @@ std::string AdaptiveCard::Serialize() const
     return ParseUtil::JsonToString(SerializeToJsonValue());
 }
 
+std::string AdaptiveCard::SerializeToCanonicalString() const
+{
+    if (m_frozen)
+    {
+        std::call_once(m_frozenCache->canonicalStringOnce,
+                       [this]() { m_frozenCache->canonicalString = ParseUtil::JsonToCanonicalString(SerializeToJsonValue()); });
+        return m_frozenCache->canonicalString;
+    }
+
+    return ParseUtil::JsonToCanonicalString(SerializeToJsonValue());
+}
+
+ContentHash AdaptiveCard::ComputeContentHash() const
+{
+    if (m_frozen)
+    {
+        return m_contentHash;
+    }
+    StructuralHashCache cache;
+    return cache.Get(*this);
+}
+
 std::string AdaptiveCard::GetVersion() const
 {
     return m_version;
 }
 
+const std::string& AdaptiveCard::GetVersionRef() const
+{
+    return m_version;
+}
+
 void AdaptiveCard::SetVersion(const std::string& value)
 {
+    MarkChanged();
     m_version = value;
 }
 
+void AdaptiveCard::SetVersion(std::string&& value)
+{
+    MarkChanged();
+    m_version = std::move(value);
+}
+
 std::string AdaptiveCard::GetFallbackText() const
 {
     return m_fallbackText;
 }
 
+const std::string& AdaptiveCard::GetFallbackTextRef() const
+{
+    return m_fallbackText;
+}
+
 void AdaptiveCard::SetFallbackText(const std::string& value)
 {
+    MarkChanged();
     m_fallbackText = value;
 }
 
+void AdaptiveCard::SetFallbackText(std::string&& value)
+{
+    MarkChanged();
+    m_fallbackText = std::move(value);
+}
+
 std::shared_ptr<BackgroundImage> AdaptiveCard::GetBackgroundImage() const
 {
     return m_backgroundImage;
@@ -350,6 +452,7 @@ std::shared_ptr<BackgroundImage> AdaptiveCard::GetBackgroundImage() const
 
 void AdaptiveCard::SetBackgroundImage(const std::shared_ptr<BackgroundImage> value)
 {
+    MarkChanged();
     m_backgroundImage = value;
 }
 
@@ -358,11 +461,23 @@ std::string AdaptiveCard::GetSpeak() const
     return m_speak;
 }
 
+const std::string& AdaptiveCard::GetSpeakRef() const
+{
+    return m_speak;
+}
+
 void AdaptiveCard::SetSpeak(const std::string& value)
 {
+    MarkChanged();
     m_speak = value;
 }
 
+void AdaptiveCard::SetSpeak(std::string&& value)
+{
+    MarkChanged();
+    m_speak = std::move(value);
+}
+
 ContainerStyle AdaptiveCard::GetStyle() const
 {
     return m_style;
@@ -370,6 +485,7 @@ ContainerStyle AdaptiveCard::GetStyle() const
 
 void AdaptiveCard::SetStyle(const ContainerStyle value)
 {
+    MarkChanged();
     m_style = value;
 }
 
@@ -378,11 +494,23 @@ std::string AdaptiveCard::GetLanguage() const
     return m_language;
 }
 
+const std::string& AdaptiveCard::GetLanguageRef() const
+{
+    return m_language;
+}
+
 void AdaptiveCard::SetLanguage(const std::string& value)
 {
+    MarkChanged();
     m_language = value;
 }
 
+void AdaptiveCard::SetLanguage(std::string&& value)
+{
+    MarkChanged();
+    m_language = std::move(value);
+}
+
 HeightType AdaptiveCard::GetHeight() const
 {
     return m_height;
@@ -390,6 +518,7 @@ HeightType AdaptiveCard::GetHeight() const
 
 void AdaptiveCard::SetHeight(const HeightType value)
 {
+    MarkChanged();
     m_height = value;
 }
 
@@ -400,6 +529,7 @@ const CardElementType AdaptiveCard::GetElementType() const
 
 std::vector<std::shared_ptr<BaseCardElement>>& AdaptiveCard::GetBody()
 {
+    ThrowIfFrozen();
     return m_body;
 }
 
@@ -410,6 +540,7 @@ const std::vector<std::shared_ptr<BaseCardElement>>& AdaptiveCard::GetBody() con
 
 std::vector<std::shared_ptr<BaseActionElement>>& AdaptiveCard::GetActions()
 {
+    ThrowIfFrozen();
     return m_actions;
 }
 
@@ -425,6 +556,7 @@ std::shared_ptr<BaseActionElement> AdaptiveCard::GetSelectAction() const
 
 void AdaptiveCard::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 {
+    MarkChanged();
     m_selectAction = action;
 }
 
@@ -435,10 +567,23 @@ VerticalContentAlignment AdaptiveCard::GetVerticalContentAlignment() const
 
 void AdaptiveCard::SetVerticalContentAlignment(const VerticalContentAlignment value)
 {
+    MarkChanged();
     m_verticalContentAlignment = value;
 }
 
 std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
+{
+    if (m_frozen)
+    {
+        std::call_once(m_frozenCache->resourceInformationOnce,
+                       [this]() { m_frozenCache->resourceInformation = GatherResourceInformation(); });
+        return m_frozenCache->resourceInformation;
+    }
+
+    return GatherResourceInformation();
+}
+
+std::vector<RemoteResourceInformation> AdaptiveCard::GatherResourceInformation() const
 {
     auto resourceVector = std::vector<RemoteResourceInformation>();
 
@@ -451,15 +596,108 @@ std::vector<RemoteResourceInformation> AdaptiveCard::GetResourceInformation()
         resourceVector.push_back(backgroundImageInfo);
     }
 
-    for (auto item : m_body)
+    for (const auto& item : m_body)
     {
         item->GetResourceInformation(resourceVector);
     }
 
-    for (auto item : m_actions)
+    for (const auto& item : m_actions)
     {
         item->GetResourceInformation(resourceVector);
     }
 
     return resourceVector;
 }
+
+void AdaptiveCard::VisitNested(NestedVisitor& visitor) const
+{
+    if (m_backgroundImage != nullptr)
+    {
+        visitor.Part(*m_backgroundImage);
+    }
+    for (unsigned int i = 0; i < m_body.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Body, i, *m_body[i]);
+    }
+    for (unsigned int i = 0; i < m_actions.size(); ++i)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Actions, i, *m_actions[i]);
+    }
+}
+
+void AdaptiveCard::Freeze()
+{
+    if (m_frozen)
+    {
+        return;
+    }
+
+    for (const auto& cardElement : m_body)
+    {
+        cardElement->Freeze();
+    }
+    for (const auto& action : m_actions)
+    {
+        action->Freeze();
+    }
+    if (m_selectAction != nullptr)
+    {
+        m_selectAction->Freeze();
+    }
+    if (m_backgroundImage != nullptr)
+    {
+        m_partOwner.Link(*this, *m_backgroundImage);
+    }
+
+    // composed from the hashes the body and actions stored as they froze
+    m_contentHash = ComputeContentHash();
+    m_frozenCache = std::make_shared<FrozenCardCache>();
+    m_changeStamp.Get();
+    m_frozen = true;
+}
+
+std::shared_ptr<AdaptiveCard> AdaptiveCard::Derive() const
+{
+    auto derived = std::make_shared<AdaptiveCard>(*this);
+    derived->m_frozen = false;
+    derived->m_frozenCache = nullptr;
+    return derived;
+}
+
+void AdaptiveCard::ThrowIfFrozen() const
+{
+    if (m_frozen)
+    {
+        throw AdaptiveCardParseException(ErrorStatusCode::FrozenObjectModification, "Frozen cards can't be modified");
+    }
+}
+
+void AdaptiveCard::MarkChanged()
+{
+    ThrowIfFrozen();
+    m_changeStamp.Renew();
+}
+
+std::shared_ptr<AdaptiveCard> AdaptiveCard::Clone() const
+{
+    BaseElement::CloneScope scope;
+    auto clone = Derive();
+    if (m_backgroundImage != nullptr)
+    {
+        clone->m_backgroundImage = std::make_shared<BackgroundImage>(*m_backgroundImage);
+    }
+    for (auto& cardElement : clone->m_body)
+    {
+        cardElement = std::static_pointer_cast<BaseCardElement>(cardElement->Clone());
+    }
+    for (auto& action : clone->m_actions)
+    {
+        action = std::static_pointer_cast<BaseActionElement>(action->Clone());
+    }
+    if (m_selectAction != nullptr)
+    {
+        clone->m_selectAction = std::static_pointer_cast<BaseActionElement>(m_selectAction->Clone());
+    }
+    scope.Complete();
+    return clone;
+}
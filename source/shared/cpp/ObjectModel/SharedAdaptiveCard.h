@@ -12,6 +12,10 @@ namespace AdaptiveSharedNamespace
 
     class AdaptiveCard
     {
+        friend class CardPatcher;
+        friend class ElementPart;
+        friend class StructuralHashCache;
+
     public:
         AdaptiveCard();
 
@@ -55,18 +59,38 @@ namespace AdaptiveSharedNamespace
                      std::vector<std::shared_ptr<BaseCardElement>>& body,
                      std::vector<std::shared_ptr<BaseActionElement>>& actions);
 
+        // Takes ownership of body and actions without copying them (see also AdaptiveCardBuilder)
+        AdaptiveCard(std::string&& version,
+                     std::string&& fallbackText,
+                     std::shared_ptr<BackgroundImage> backgroundImage,
+                     ContainerStyle style,
+                     std::string&& speak,
+                     std::string&& language,
+                     VerticalContentAlignment verticalContentAlignment,
+                     HeightType height,
+                     std::vector<std::shared_ptr<BaseCardElement>>&& body,
+                     std::vector<std::shared_ptr<BaseActionElement>>&& actions);
+
         std::string GetVersion() const;
+        const std::string& GetVersionRef() const;
         void SetVersion(const std::string& value);
+        void SetVersion(std::string&& value);
         std::string GetFallbackText() const;
+        const std::string& GetFallbackTextRef() const;
         void SetFallbackText(const std::string& value);
+        void SetFallbackText(std::string&& value);
         std::shared_ptr<BackgroundImage> GetBackgroundImage() const;
         void SetBackgroundImage(const std::shared_ptr<BackgroundImage> value);
         std::string GetSpeak() const;
+        const std::string& GetSpeakRef() const;
         void SetSpeak(const std::string& value);
+        void SetSpeak(std::string&& value);
         ContainerStyle GetStyle() const;
         void SetStyle(const ContainerStyle value);
         std::string GetLanguage() const;
+        const std::string& GetLanguageRef() const;
         void SetLanguage(const std::string& value);
+        void SetLanguage(std::string&& value);
         VerticalContentAlignment GetVerticalContentAlignment() const;
         void SetVerticalContentAlignment(const VerticalContentAlignment value);
         HeightType GetHeight() const;
@@ -125,12 +149,50 @@ namespace AdaptiveSharedNamespace
         Json::Value SerializeToJsonValue() const;
         std::string Serialize() const;
 
+        // Canonical form: default-valued properties omitted, members in sorted key order, no whitespace. Two cards
+        // that mean the same thing serialize to the same canonical string.
+        std::string SerializeToCanonicalString() const;
+        // Hash of the canonical form, composed from the structural hashes of the body and actions (see
+        // BaseElement::GetStructuralHash) rather than by hashing the whole tree again. Freeze() stores it.
+        ContentHash ComputeContentHash() const;
+
+        // Reports the body and actions as slots and the background image as a part (see BaseElement::VisitNested)
+        void VisitNested(NestedVisitor& visitor) const;
+
+        // Makes the card and every element in it read-only (see BaseElement::Freeze). A frozen card may be shared
+        // across threads; SerializeToCanonicalString and GetResourceInformation are computed once and cached.
+        // Renderers that write to the model while rendering, as the iOS renderer does (it tags element ids and sets
+        // image sizes), or that read it through the non-const accessors, need a Clone() of a frozen card: a derived
+        // card still shares its elements with the frozen one.
+        void Freeze();
+        bool IsFrozen() const { return m_frozen; }
+
+        // Covers the card's own properties and its body and actions lists (see BaseElement::GetChangeStamp)
+        std::uint64_t GetChangeStamp() const { return m_changeStamp.Get(); }
+
+        // Returns a mutable shallow copy of this card whose body, actions, selectAction and background image are
+        // shared with the original. Replace entries (after BaseElement::Derive()-ing them) to build a modified card;
+        // untouched subtrees stay shared with the frozen original.
+        std::shared_ptr<AdaptiveCard> Derive() const;
+
+        // Deep copy of the card (see BaseElement::Clone)
+        std::shared_ptr<AdaptiveCard> Clone() const;
+
     private:
+        struct FrozenCardCache;
+
+        // As BaseElement's: ThrowIfFrozen() only checks, MarkChanged() also renews the change stamp
+        void ThrowIfFrozen() const;
+        void MarkChanged();
+        std::vector<RemoteResourceInformation> GatherResourceInformation() const;
+        Json::Value SerializeCardPropertiesToJsonValue() const;
+
         static void _ValidateLanguage(const std::string& language, std::vector<std::shared_ptr<AdaptiveCardParseWarning>>& warnings);
 
         std::string m_version;
         std::string m_fallbackText;
         std::shared_ptr<BackgroundImage> m_backgroundImage;
+        ElementPartOwner m_partOwner;
         std::string m_speak;
         ContainerStyle m_style;
         std::string m_language;
@@ -141,5 +203,11 @@ namespace AdaptiveSharedNamespace
         std::vector<std::shared_ptr<BaseActionElement>> m_actions;
 
         std::shared_ptr<BaseActionElement> m_selectAction;
+
+        ChangeStamp m_changeStamp;
+        // stored by Freeze()
+        ContentHash m_contentHash;
+        bool m_frozen;
+        std::shared_ptr<FrozenCardCache> m_frozenCache;
     };
 }
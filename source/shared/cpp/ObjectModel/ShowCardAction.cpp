@@ -8,14 +8,13 @@ using namespace AdaptiveSharedNamespace;
 
 ShowCardAction::ShowCardAction() : BaseActionElement(ActionType::ShowCard)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value ShowCardAction::SerializeToJsonValue() const
 {
     Json::Value root = BaseActionElement::SerializeToJsonValue();
 
-    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)] = GetCard()->SerializeToJsonValue();
+    root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)] = SerializeNested(*GetCard());
 
     return root;
 }
@@ -27,13 +26,15 @@ std::shared_ptr<AdaptiveCard> ShowCardAction::GetCard() const
 
 void ShowCardAction::SetCard(const std::shared_ptr<AdaptiveCard> card)
 {
+    MarkChanged();
     m_card = card;
 }
 
 void ShowCardAction::SetLanguage(const std::string& value)
 {
+    MarkChanged();
     // If the card inside doesn't specify language, propagate
-    if (m_card->GetLanguage().empty())
+    if (m_card->GetLanguageRef().empty())
     {
         m_card->SetLanguage(value);
     }
@@ -47,7 +48,7 @@ std::shared_ptr<BaseActionElement> ShowCardActionParser::Deserialize(ParseContex
 
     auto parseResult = AdaptiveCard::Deserialize(json.get(propertyName, Json::Value()), "", context);
 
-    auto showCardWarnings = parseResult->GetWarnings();
+    const auto& showCardWarnings = parseResult->GetWarningsRef();
     auto warningsEnd = context.warnings.insert(context.warnings.end(), showCardWarnings.begin(), showCardWarnings.end());
 
     showCardAction->SetCard(parseResult->GetAdaptiveCard());
@@ -63,6 +64,8 @@ ShowCardActionParser::DeserializeFromString(ParseContext& context, const std::st
 
 void ShowCardAction::PopulateKnownPropertiesSet()
 {
+    BaseActionElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Card)});
 }
 
@@ -73,3 +76,35 @@ void ShowCardAction::GetResourceInformation(std::vector<RemoteResourceInformatio
     auto resourceInfoEnd = resourceInfo.insert(resourceInfo.end(), showCardResources.begin(), showCardResources.end());
     return;
 }
+
+void ShowCardAction::VisitNested(NestedVisitor& visitor) const
+{
+    BaseActionElement::VisitNested(visitor);
+    if (m_card != nullptr)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::Card, NestedVisitor::NoIndex, *m_card);
+    }
+}
+
+void ShowCardAction::Freeze()
+{
+    if (m_card != nullptr)
+    {
+        m_card->Freeze();
+    }
+    BaseActionElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> ShowCardAction::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void ShowCardAction::DeepCopyMembers()
+{
+    BaseActionElement::DeepCopyMembers();
+    if (m_card != nullptr)
+    {
+        m_card = m_card->Clone();
+    }
+}
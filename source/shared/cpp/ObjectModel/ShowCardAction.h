@@ -18,6 +18,9 @@ namespace AdaptiveSharedNamespace
         ~ShowCardAction() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCard> GetCard() const;
         void SetCard(const std::shared_ptr<AdaptiveSharedNamespace::AdaptiveCard>);
@@ -27,6 +30,7 @@ namespace AdaptiveSharedNamespace
         void GetResourceInformation(std::vector<RemoteResourceInformation>& resourceInfo) override;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
 
         std::shared_ptr<AdaptiveCard> m_card;
@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 SubmitAction::SubmitAction() : BaseActionElement(ActionType::Submit)
 {
-    PopulateKnownPropertiesSet();
 }
 
 std::string SubmitAction::GetDataJson() const
@@ -21,14 +20,22 @@ Json::Value SubmitAction::GetDataJsonAsValue() const
 
 void SubmitAction::SetDataJson(const std::string value)
 {
+    MarkChanged();
     SetDataJson(ParseUtil::GetJsonValueFromString(value));
 }
 
 void SubmitAction::SetDataJson(const Json::Value& value)
 {
+    MarkChanged();
     m_dataJson = value;
 }
 
+void SubmitAction::SetDataJson(Json::Value&& value)
+{
+    MarkChanged();
+    m_dataJson = std::move(value);
+}
+
 Json::Value SubmitAction::SerializeToJsonValue() const
 {
     Json::Value root = BaseActionElement::SerializeToJsonValue();
@@ -57,5 +64,12 @@ std::shared_ptr<BaseActionElement> SubmitActionParser::DeserializeFromString(Par
 
 void SubmitAction::PopulateKnownPropertiesSet()
 {
+    BaseActionElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Data)});
 }
+
+std::shared_ptr<BaseElement> SubmitAction::Clone() const
+{
+    return MakeClone(*this);
+}
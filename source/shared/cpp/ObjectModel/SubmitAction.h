@@ -19,9 +19,11 @@ namespace AdaptiveSharedNamespace
         std::string GetDataJson() const;
         Json::Value GetDataJsonAsValue() const;
         void SetDataJson(const Json::Value& value);
+        void SetDataJson(Json::Value&& value);
         void SetDataJson(const std::string value);
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
 
     private:
         void PopulateKnownPropertiesSet() override;
@@ -0,0 +1,190 @@
+#include "pch.h"
+#include "SubmitPayloadWriter.h"
+#include "AdaptiveCardParseException.h"
+#include "BaseInputElement.h"
+#include "CardState.h"
+#include "CardTraversal.h"
+#include "ParseUtil.h"
+#include "SharedAdaptiveCard.h"
+#include "SubmitAction.h"
+
+namespace AdaptiveSharedNamespace
+{
+    namespace
+    {
+        // Appends value as a json string, as ParseUtil::JsonToCanonicalString would write it
+        void AppendQuoted(const std::string& value, std::string& out)
+        {
+            // printable ASCII other than '"' and '\' is written as it is; jsoncpp handles everything else
+            const bool isPlain = std::all_of(value.begin(), value.end(), [](char c) { return c >= 0x20 && c < 0x7F && c != '"' && c != '\\'; });
+            if (!isPlain)
+            {
+                out += ParseUtil::JsonToCanonicalString(Json::Value(value));
+                return;
+            }
+
+            out.push_back('"');
+            out += value;
+            out.push_back('"');
+        }
+
+        bool IsInput(CardElementType type)
+        {
+            switch (type)
+            {
+            case CardElementType::ChoiceSetInput:
+            case CardElementType::DateInput:
+            case CardElementType::NumberInput:
+            case CardElementType::TextInput:
+            case CardElementType::TimeInput:
+            case CardElementType::ToggleInput:
+                return true;
+            default:
+                return false;
+            }
+        }
+    }
+
+    SubmitPayloadWriter SubmitPayloadWriter::Compile(std::shared_ptr<AdaptiveCard> card)
+    {
+        SubmitPayloadWriter writer;
+        writer.m_card = std::move(card);
+
+        // the cards enclosing the node being visited, as (depth, index into m_cardInputs), innermost last
+        std::vector<std::pair<unsigned int, std::size_t>> cards;
+        std::vector<std::pair<const SubmitAction*, std::vector<std::size_t>>> actions;
+
+        auto nodes = PreOrder(*writer.m_card);
+        for (auto node = nodes.begin(); node != nodes.end(); ++node)
+        {
+            if (node->IsFallback())
+            {
+                node.SkipChildren();
+                continue;
+            }
+            while (!cards.empty() && cards.back().first >= node->GetDepth())
+            {
+                cards.pop_back();
+            }
+
+            if (node->GetKind() == CardNodeKind::Card)
+            {
+                cards.emplace_back(node->GetDepth(), writer.m_cardInputs.size());
+                writer.m_cardInputs.emplace_back();
+            }
+            else if (node->GetKind() == CardNodeKind::CardElement && IsInput(node->GetCardElementType()))
+            {
+                const auto& input = static_cast<const BaseInputElement&>(*node->GetCardElement());
+                std::string key;
+                AppendQuoted(input.GetIdRef(), key);
+                key.push_back(':');
+                writer.m_cardInputs[cards.back().second].push_back(ScopeInput{&input, std::move(key)});
+            }
+            else if (node->GetKind() == CardNodeKind::Action && node->GetActionType() == ActionType::Submit)
+            {
+                std::vector<std::size_t> scope;
+                for (const auto& enclosing : cards)
+                {
+                    scope.push_back(enclosing.second);
+                }
+                actions.emplace_back(static_cast<const SubmitAction*>(node->GetAction()), std::move(scope));
+            }
+        }
+
+        // the data is serialized once every scope's inputs are known, since inputs replace data members
+        for (auto& action : actions)
+        {
+            ActionPayload payload{std::string(), true, std::move(action.second)};
+            const Json::Value data = action.first->GetDataJsonAsValue();
+            if (data.isObject())
+            {
+                std::unordered_set<std::string> inputIds;
+                for (const auto scope : payload.scope)
+                {
+                    for (const auto& scopeInput : writer.m_cardInputs[scope])
+                    {
+                        inputIds.insert(scopeInput.input->GetIdRef());
+                    }
+                }
+
+                for (auto member = data.begin(); member != data.end(); ++member)
+                {
+                    const std::string name = member.name();
+                    if (inputIds.count(name) == 0)
+                    {
+                        if (!payload.data.empty())
+                        {
+                            payload.data.push_back(',');
+                        }
+                        AppendQuoted(name, payload.data);
+                        payload.data.push_back(':');
+                        payload.data += ParseUtil::JsonToCanonicalString(*member);
+                    }
+                }
+            }
+            else if (!data.isNull())
+            {
+                payload.data = ParseUtil::JsonToCanonicalString(data);
+                payload.isObject = false;
+            }
+            writer.m_payloads.emplace(action.first, std::move(payload));
+        }
+        return writer;
+    }
+
+    void SubmitPayloadWriter::Write(const SubmitAction& action, const CardState& state, std::string& out) const
+    {
+        Write(FindPayload(action), state, out);
+    }
+
+    void SubmitPayloadWriter::Write(const SubmitAction& action, std::string& out) const
+    {
+        // an empty state reads every value from its input
+        Write(FindPayload(action), CardState(m_card), out);
+    }
+
+    std::string SubmitPayloadWriter::GetPayload(const SubmitAction& action, const CardState& state) const
+    {
+        std::string payload;
+        Write(action, state, payload);
+        return payload;
+    }
+
+    const SubmitPayloadWriter::ActionPayload& SubmitPayloadWriter::FindPayload(const SubmitAction& action) const
+    {
+        const auto payload = m_payloads.find(&action);
+        if (payload == m_payloads.end())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Not a Submit action of the compiled card");
+        }
+        return payload->second;
+    }
+
+    void SubmitPayloadWriter::Write(const ActionPayload& payload, const CardState& state, std::string& out) const
+    {
+        if (!payload.isObject)
+        {
+            out += payload.data;
+            return;
+        }
+
+        out.push_back('{');
+        out += payload.data;
+        bool isFirst = payload.data.empty();
+        for (const auto scope : payload.scope)
+        {
+            for (const auto& scopeInput : m_cardInputs[scope])
+            {
+                if (!isFirst)
+                {
+                    out.push_back(',');
+                }
+                isFirst = false;
+                out += scopeInput.key;
+                const std::string* value = state.FindInputValue(scopeInput.input->GetIdRef());
+                AppendQuoted(value != nullptr ? *value : state.GetInputValue(*scopeInput.input), out);
+            }
+        }
+        out.push_back('}');
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    class AdaptiveCard;
+    class BaseInputElement;
+    class CardState;
+    class SubmitAction;
+
+    // Writes Action.Submit payloads for a card, so that every platform submits the same json. A Submit action's
+    // scope is the card it belongs to together with the cards that card is nested in (through ShowCard actions), and
+    // its payload is its data with the values of the inputs in scope added as strings by input id:
+    //
+    //   - data that is an object gets the input values as additional members, which replace data members of the same
+    //     name
+    //   - an action without data submits an object of just the input values
+    //   - any other data (e.g. a string) is submitted as it is, without input values
+    //
+    // Compiling walks the card once, lists the inputs of each scope and serializes each action's data, leaving only
+    // the input values to write per submission. Inputs in fallback content aren't in any scope. The writer refers to
+    // the card's inputs and actions and keeps the card alive; compile again after changing the card's elements or an
+    // action's data. Output is compact json, escaped as ParseUtil::JsonToCanonicalString escapes it.
+    class SubmitPayloadWriter
+    {
+    public:
+        static SubmitPayloadWriter Compile(std::shared_ptr<AdaptiveCard> card);
+
+        // Appends the payload for action, which must be a Submit action of the card, taking input values from state
+        // (which must be a state of the card) or from the inputs themselves. Throws AdaptiveCardParseException with
+        // ErrorStatusCode::InvalidPropertyValue for any other action.
+        void Write(const SubmitAction& action, const CardState& state, std::string& out) const;
+        void Write(const SubmitAction& action, std::string& out) const;
+
+        std::string GetPayload(const SubmitAction& action, const CardState& state) const;
+
+    private:
+        struct ScopeInput
+        {
+            const BaseInputElement* input;
+            // the input's id, quoted and followed by ':'
+            std::string key;
+        };
+
+        struct ActionPayload
+        {
+            // Data members not replaced by inputs, joined with ','; or, when the data isn't submitted as an object,
+            // the whole payload
+            std::string data;
+            bool isObject;
+            // scopes (indices into m_cardInputs) from the outermost card in
+            std::vector<std::size_t> scope;
+        };
+
+        SubmitPayloadWriter() = default;
+
+        const ActionPayload& FindPayload(const SubmitAction& action) const;
+        void Write(const ActionPayload& payload, const CardState& state, std::string& out) const;
+
+        std::shared_ptr<AdaptiveCard> m_card;
+        // the inputs whose nearest card is the root card or a ShowCard action's card, in card order
+        std::vector<std::vector<ScopeInput>> m_cardInputs;
+        std::unordered_map<const SubmitAction*, ActionPayload> m_payloads;
+    };
+}
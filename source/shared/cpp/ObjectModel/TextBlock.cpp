@@ -11,20 +11,20 @@
 using namespace AdaptiveSharedNamespace;
 
 TextBlock::TextBlock() :
-    BaseCardElement(CardElementType::TextBlock), m_wrap(false), m_maxLines(0), m_hAlignment(HorizontalAlignment::Left),
-    m_textElementProperties(std::make_shared<TextElementProperties>())
+    BaseCardElement(CardElementType::TextBlock), m_maxLines(0),
+    m_hAlignment(static_cast<std::uint8_t>(HorizontalAlignment::Left)), m_wrap(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TextBlock::SerializeToJsonValue() const
 {
     Json::Value root = BaseCardElement::SerializeToJsonValue();
-    m_textElementProperties->SerializeToJsonValue(root);
+    m_textElementProperties.SerializeToJsonValue(root);
 
-    if (m_hAlignment != HorizontalAlignment::Left)
+    if (GetHorizontalAlignment() != HorizontalAlignment::Left)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)] = HorizontalAlignmentToString(m_hAlignment);
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)] =
+            HorizontalAlignmentToString(GetHorizontalAlignment());
     }
 
     if (m_maxLines != 0)
@@ -42,57 +42,73 @@ Json::Value TextBlock::SerializeToJsonValue() const
 
 std::string TextBlock::GetText() const
 {
-    return m_textElementProperties->GetText();
+    return m_textElementProperties.GetText();
+}
+
+const std::string& TextBlock::GetTextRef() const
+{
+    return m_textElementProperties.GetTextRef();
 }
 
 void TextBlock::SetText(const std::string& value)
 {
-    m_textElementProperties->SetText(value);
+    MarkChanged();
+    m_textElementProperties.SetText(value);
+}
+
+void TextBlock::SetText(std::string&& value)
+{
+    MarkChanged();
+    m_textElementProperties.SetText(std::move(value));
 }
 
 DateTimePreparser TextBlock::GetTextForDateParsing() const
 {
-    return m_textElementProperties->GetTextForDateParsing();
+    return m_textElementProperties.GetTextForDateParsing();
 }
 
 TextSize TextBlock::GetTextSize() const
 {
-    return m_textElementProperties->GetTextSize();
+    return m_textElementProperties.GetTextSize();
 }
 
 void TextBlock::SetTextSize(const TextSize value)
 {
-    m_textElementProperties->SetTextSize(value);
+    MarkChanged();
+    m_textElementProperties.SetTextSize(value);
 }
 
 TextWeight TextBlock::GetTextWeight() const
 {
-    return m_textElementProperties->GetTextWeight();
+    return m_textElementProperties.GetTextWeight();
 }
 
 void TextBlock::SetTextWeight(const TextWeight value)
 {
-    m_textElementProperties->SetTextWeight(value);
+    MarkChanged();
+    m_textElementProperties.SetTextWeight(value);
 }
 
 FontStyle TextBlock::GetFontStyle() const
 {
-    return m_textElementProperties->GetFontStyle();
+    return m_textElementProperties.GetFontStyle();
 }
 
 void TextBlock::SetFontStyle(const FontStyle value)
 {
-    m_textElementProperties->SetFontStyle(value);
+    MarkChanged();
+    m_textElementProperties.SetFontStyle(value);
 }
 
 ForegroundColor TextBlock::GetTextColor() const
 {
-    return m_textElementProperties->GetTextColor();
+    return m_textElementProperties.GetTextColor();
 }
 
 void TextBlock::SetTextColor(const ForegroundColor value)
 {
-    m_textElementProperties->SetTextColor(value);
+    MarkChanged();
+    m_textElementProperties.SetTextColor(value);
 }
 
 bool TextBlock::GetWrap() const
@@ -102,17 +118,19 @@ bool TextBlock::GetWrap() const
 
 void TextBlock::SetWrap(const bool value)
 {
+    MarkChanged();
     m_wrap = value;
 }
 
 bool TextBlock::GetIsSubtle() const
 {
-    return m_textElementProperties->GetIsSubtle();
+    return m_textElementProperties.GetIsSubtle();
 }
 
 void TextBlock::SetIsSubtle(const bool value)
 {
-    m_textElementProperties->SetIsSubtle(value);
+    MarkChanged();
+    m_textElementProperties.SetIsSubtle(value);
 }
 
 unsigned int TextBlock::GetMaxLines() const
@@ -122,27 +140,35 @@ unsigned int TextBlock::GetMaxLines() const
 
 void TextBlock::SetMaxLines(const unsigned int value)
 {
+    MarkChanged();
     m_maxLines = value;
 }
 
 HorizontalAlignment TextBlock::GetHorizontalAlignment() const
 {
-    return m_hAlignment;
+    return static_cast<HorizontalAlignment>(m_hAlignment);
 }
 
 void TextBlock::SetHorizontalAlignment(const HorizontalAlignment value)
 {
-    m_hAlignment = value;
+    MarkChanged();
+    m_hAlignment = static_cast<std::uint8_t>(value);
 }
 
 std::string TextBlock::GetLanguage() const
 {
-    return m_textElementProperties->GetLanguage();
+    return m_textElementProperties.GetLanguage();
+}
+
+const std::string& TextBlock::GetLanguageRef() const
+{
+    return m_textElementProperties.GetLanguageRef();
 }
 
 void TextBlock::SetLanguage(const std::string& value)
 {
-    m_textElementProperties->SetLanguage(value);
+    MarkChanged();
+    m_textElementProperties.SetLanguage(value);
 }
 
 std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& context, const Json::Value& json)
@@ -150,7 +176,7 @@ std::shared_ptr<BaseCardElement> TextBlockParser::Deserialize(ParseContext& cont
     ParseUtil::ExpectTypeString(json, CardElementType::TextBlock);
 
     std::shared_ptr<TextBlock> textBlock = BaseCardElement::Deserialize<TextBlock>(context, json);
-    textBlock->m_textElementProperties->Deserialize(context, json);
+    textBlock->m_textElementProperties.Deserialize(context, json);
 
     textBlock->SetWrap(ParseUtil::GetBool(json, AdaptiveCardSchemaKey::Wrap, false));
     textBlock->SetMaxLines(ParseUtil::GetUInt(json, AdaptiveCardSchemaKey::MaxLines, 0));
@@ -167,9 +193,16 @@ std::shared_ptr<BaseCardElement> TextBlockParser::DeserializeFromString(ParseCon
 
 void TextBlock::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    BaseCardElement::PopulateKnownPropertiesSet();
+
+    m_textElementProperties.PopulateKnownPropertiesSet(m_knownProperties.Get());
 
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLines),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::HorizontalAlignment)});
 }
+
+std::shared_ptr<BaseElement> TextBlock::Clone() const
+{
+    return MakeClone(*this);
+}
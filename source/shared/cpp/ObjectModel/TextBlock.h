@@ -22,9 +22,12 @@ namespace AdaptiveSharedNamespace
         ~TextBlock() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
 
         std::string GetText() const;
+        const std::string& GetTextRef() const;
         void SetText(const std::string& value);
+        void SetText(std::string&& value);
         DateTimePreparser GetTextForDateParsing() const;
 
         TextSize GetTextSize() const;
@@ -53,12 +56,13 @@ namespace AdaptiveSharedNamespace
 
         void SetLanguage(const std::string& value);
         std::string GetLanguage() const;
+        const std::string& GetLanguageRef() const;
 
     private:
-        bool m_wrap;
+        TextElementProperties m_textElementProperties;
         unsigned int m_maxLines;
-        HorizontalAlignment m_hAlignment;
-        std::shared_ptr<TextElementProperties> m_textElementProperties;
+        std::uint8_t m_hAlignment; // HorizontalAlignment
+        bool m_wrap;
         void PopulateKnownPropertiesSet() override;
     };
 
@@ -11,31 +11,32 @@
 using namespace AdaptiveSharedNamespace;
 
 TextElementProperties::TextElementProperties() :
-    m_textSize(TextSize::Default), m_textWeight(TextWeight::Default), m_fontStyle(FontStyle::Default),
-    m_textColor(ForegroundColor::Default), m_isSubtle(false), m_language()
+    m_language(), m_textSize(static_cast<std::uint8_t>(TextSize::Default)),
+    m_textWeight(static_cast<std::uint8_t>(TextWeight::Default)), m_fontStyle(static_cast<std::uint8_t>(FontStyle::Default)),
+    m_textColor(static_cast<std::uint8_t>(ForegroundColor::Default)), m_isSubtle(false)
 {
 }
 
 Json::Value TextElementProperties::SerializeToJsonValue(Json::Value& root) const
 {
-    if (m_textSize != TextSize::Default)
+    if (GetTextSize() != TextSize::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size)] = TextSizeToString(m_textSize);
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Size)] = TextSizeToString(GetTextSize());
     }
 
-    if (m_textColor != ForegroundColor::Default)
+    if (GetTextColor() != ForegroundColor::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color)] = ForegroundColorToString(m_textColor);
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Color)] = ForegroundColorToString(GetTextColor());
     }
 
-    if (m_textWeight != TextWeight::Default)
+    if (GetTextWeight() != TextWeight::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Weight)] = TextWeightToString(m_textWeight);
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Weight)] = TextWeightToString(GetTextWeight());
     }
 
-    if (m_fontStyle != FontStyle::Default)
+    if (GetFontStyle() != FontStyle::Default)
     {
-        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FontStyle)] = FontStyleToString(m_fontStyle);
+        root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::FontStyle)] = FontStyleToString(GetFontStyle());
     }
 
     if (m_isSubtle)
@@ -53,11 +54,21 @@ std::string TextElementProperties::GetText() const
     return m_text;
 }
 
+const std::string& TextElementProperties::GetTextRef() const
+{
+    return m_text;
+}
+
 void TextElementProperties::SetText(const std::string& value)
 {
     m_text = value;
 }
 
+void TextElementProperties::SetText(std::string&& value)
+{
+    m_text = std::move(value);
+}
+
 DateTimePreparser TextElementProperties::GetTextForDateParsing() const
 {
     return DateTimePreparser(m_text);
@@ -65,42 +76,42 @@ DateTimePreparser TextElementProperties::GetTextForDateParsing() const
 
 TextSize TextElementProperties::GetTextSize() const
 {
-    return m_textSize;
+    return static_cast<TextSize>(m_textSize);
 }
 
 void TextElementProperties::SetTextSize(const TextSize value)
 {
-    m_textSize = value;
+    m_textSize = static_cast<std::uint8_t>(value);
 }
 
 TextWeight TextElementProperties::GetTextWeight() const
 {
-    return m_textWeight;
+    return static_cast<TextWeight>(m_textWeight);
 }
 
 void TextElementProperties::SetTextWeight(const TextWeight value)
 {
-    m_textWeight = value;
+    m_textWeight = static_cast<std::uint8_t>(value);
 }
 
 FontStyle TextElementProperties::GetFontStyle() const
 {
-    return m_fontStyle;
+    return static_cast<FontStyle>(m_fontStyle);
 }
 
 void TextElementProperties::SetFontStyle(const FontStyle value)
 {
-    m_fontStyle = value;
+    m_fontStyle = static_cast<std::uint8_t>(value);
 }
 
 ForegroundColor TextElementProperties::GetTextColor() const
 {
-    return m_textColor;
+    return static_cast<ForegroundColor>(m_textColor);
 }
 
 void TextElementProperties::SetTextColor(const ForegroundColor value)
 {
-    m_textColor = value;
+    m_textColor = static_cast<std::uint8_t>(value);
 }
 
 bool TextElementProperties::GetIsSubtle() const
@@ -118,6 +129,11 @@ std::string TextElementProperties::GetLanguage() const
     return m_language;
 }
 
+const std::string& TextElementProperties::GetLanguageRef() const
+{
+    return m_language;
+}
+
 void TextElementProperties::SetLanguage(const std::string& value)
 {
     m_language = value;
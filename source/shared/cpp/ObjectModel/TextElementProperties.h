@@ -20,7 +20,9 @@ namespace AdaptiveSharedNamespace
         Json::Value SerializeToJsonValue(Json::Value& root) const;
 
         std::string GetText() const;
+        const std::string& GetTextRef() const;
         void SetText(const std::string& value);
+        void SetText(std::string&& value);
         DateTimePreparser GetTextForDateParsing() const;
 
         TextSize GetTextSize() const;
@@ -40,17 +42,20 @@ namespace AdaptiveSharedNamespace
 
         void SetLanguage(const std::string& value);
         std::string GetLanguage() const;
+        const std::string& GetLanguageRef() const;
 
         void Deserialize(ParseContext& context, const Json::Value& root);
         void PopulateKnownPropertiesSet(std::unordered_set<std::string>& knownProperties);
 
     private:
         std::string m_text;
-        TextSize m_textSize;
-        TextWeight m_textWeight;
-        FontStyle m_fontStyle;
-        ForegroundColor m_textColor;
-        bool m_isSubtle;
         std::string m_language;
+
+        // enum values are stored in a byte each
+        std::uint8_t m_textSize;
+        std::uint8_t m_textWeight;
+        std::uint8_t m_fontStyle;
+        std::uint8_t m_textColor;
+        bool m_isSubtle;
     };
 }
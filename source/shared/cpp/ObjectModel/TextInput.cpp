@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 TextInput::TextInput() :
     BaseInputElement(CardElementType::TextInput), m_isMultiline(false), m_maxLength(0), m_style(TextInputStyle::Text)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TextInput::SerializeToJsonValue() const
@@ -53,21 +52,45 @@ std::string TextInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+const std::string& TextInput::GetPlaceholderRef() const
+{
+    return m_placeholder;
+}
+
 void TextInput::SetPlaceholder(const std::string& value)
 {
+    MarkChanged();
     m_placeholder = value;
 }
 
+void TextInput::SetPlaceholder(std::string&& value)
+{
+    MarkChanged();
+    m_placeholder = std::move(value);
+}
+
 std::string TextInput::GetValue() const
 {
     return m_value;
 }
 
+const std::string& TextInput::GetValueRef() const
+{
+    return m_value;
+}
+
 void TextInput::SetValue(const std::string& value)
 {
+    MarkChanged();
     m_value = value;
 }
 
+void TextInput::SetValue(std::string&& value)
+{
+    MarkChanged();
+    m_value = std::move(value);
+}
+
 bool TextInput::GetIsMultiline() const
 {
     return m_isMultiline;
@@ -75,6 +98,7 @@ bool TextInput::GetIsMultiline() const
 
 void TextInput::SetIsMultiline(const bool value)
 {
+    MarkChanged();
     m_isMultiline = value;
 }
 
@@ -85,6 +109,7 @@ unsigned int TextInput::GetMaxLength() const
 
 void TextInput::SetMaxLength(const unsigned int value)
 {
+    MarkChanged();
     m_maxLength = value;
 }
 
@@ -95,6 +120,7 @@ TextInputStyle TextInput::GetTextInputStyle() const
 
 void TextInput::SetTextInputStyle(const TextInputStyle value)
 {
+    MarkChanged();
     m_style = value;
 }
 
@@ -105,6 +131,7 @@ std::shared_ptr<BaseActionElement> TextInput::GetInlineAction() const
 
 void TextInput::SetInlineAction(const std::shared_ptr<BaseActionElement> action)
 {
+    MarkChanged();
     m_inlineAction = action;
 }
 
@@ -131,9 +158,43 @@ std::shared_ptr<BaseCardElement> TextInputParser::DeserializeFromString(ParseCon
 
 void TextInput::PopulateKnownPropertiesSet()
 {
+    BaseInputElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::IsMultiline),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::MaxLength),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TextInput)});
 }
+
+void TextInput::VisitNested(NestedVisitor& visitor) const
+{
+    BaseInputElement::VisitNested(visitor);
+    if (m_inlineAction != nullptr)
+    {
+        visitor.Slot(AdaptiveCardSchemaKey::InlineAction, NestedVisitor::NoIndex, *m_inlineAction);
+    }
+}
+
+void TextInput::Freeze()
+{
+    if (m_inlineAction != nullptr)
+    {
+        m_inlineAction->Freeze();
+    }
+    BaseInputElement::Freeze();
+}
+
+std::shared_ptr<BaseElement> TextInput::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void TextInput::DeepCopyMembers()
+{
+    BaseInputElement::DeepCopyMembers();
+    if (m_inlineAction != nullptr)
+    {
+        m_inlineAction = std::static_pointer_cast<BaseActionElement>(m_inlineAction->Clone());
+    }
+}
@@ -17,12 +17,19 @@ namespace AdaptiveSharedNamespace
         ~TextInput() = default;
 
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
 
         std::string GetPlaceholder() const;
+        const std::string& GetPlaceholderRef() const;
         void SetPlaceholder(const std::string& value);
+        void SetPlaceholder(std::string&& value);
 
         std::string GetValue() const;
+        const std::string& GetValueRef() const;
         void SetValue(const std::string& value);
+        void SetValue(std::string&& value);
 
         bool GetIsMultiline() const;
         void SetIsMultiline(const bool value);
@@ -37,6 +44,7 @@ namespace AdaptiveSharedNamespace
         void SetInlineAction(const std::shared_ptr<BaseActionElement> action);
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
 
         std::string m_placeholder;
@@ -3,15 +3,15 @@
 
 using namespace AdaptiveSharedNamespace;
 
-TextRun::TextRun() :
-    Inline(InlineElementType::TextRun), m_textElementProperties(std::make_shared<TextElementProperties>())
+TextRun::TextRun() : Inline(InlineElementType::TextRun)
 {
-    PopulateKnownPropertiesSet();
 }
 
 void TextRun::PopulateKnownPropertiesSet()
 {
-    m_textElementProperties->PopulateKnownPropertiesSet(m_knownProperties);
+    Inline::PopulateKnownPropertiesSet();
+
+    m_textElementProperties.PopulateKnownPropertiesSet(m_knownProperties.Get());
 }
 
 Json::Value TextRun::SerializeToJsonValue() const
@@ -19,7 +19,7 @@ Json::Value TextRun::SerializeToJsonValue() const
     Json::Value root = Json::Value();
 
     root[AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Type)] = GetInlineTypeString();
-    m_textElementProperties->SerializeToJsonValue(root);
+    m_textElementProperties.SerializeToJsonValue(root);
 
     if (m_selectAction != nullptr)
     {
@@ -31,77 +31,94 @@ Json::Value TextRun::SerializeToJsonValue() const
 
 std::string TextRun::GetText() const
 {
-    return m_textElementProperties->GetText();
+    return m_textElementProperties.GetText();
+}
+
+const std::string& TextRun::GetTextRef() const
+{
+    return m_textElementProperties.GetTextRef();
 }
 
 void TextRun::SetText(const std::string& value)
 {
-    m_textElementProperties->SetText(value);
+    MarkChanged();
+    m_textElementProperties.SetText(value);
 }
 
 DateTimePreparser TextRun::GetTextForDateParsing() const
 {
-    return m_textElementProperties->GetTextForDateParsing();
+    return m_textElementProperties.GetTextForDateParsing();
 }
 
 TextSize TextRun::GetTextSize() const
 {
-    return m_textElementProperties->GetTextSize();
+    return m_textElementProperties.GetTextSize();
 }
 
 void TextRun::SetTextSize(const TextSize value)
 {
-    m_textElementProperties->SetTextSize(value);
+    MarkChanged();
+    m_textElementProperties.SetTextSize(value);
 }
 
 TextWeight TextRun::GetTextWeight() const
 {
-    return m_textElementProperties->GetTextWeight();
+    return m_textElementProperties.GetTextWeight();
 }
 
 void TextRun::SetTextWeight(const TextWeight value)
 {
-    m_textElementProperties->SetTextWeight(value);
+    MarkChanged();
+    m_textElementProperties.SetTextWeight(value);
 }
 
 FontStyle TextRun::GetFontStyle() const
 {
-    return m_textElementProperties->GetFontStyle();
+    return m_textElementProperties.GetFontStyle();
 }
 
 void TextRun::SetFontStyle(const FontStyle value)
 {
-    m_textElementProperties->SetFontStyle(value);
+    MarkChanged();
+    m_textElementProperties.SetFontStyle(value);
 }
 
 ForegroundColor TextRun::GetTextColor() const
 {
-    return m_textElementProperties->GetTextColor();
+    return m_textElementProperties.GetTextColor();
 }
 
 void TextRun::SetTextColor(const ForegroundColor value)
 {
-    m_textElementProperties->SetTextColor(value);
+    MarkChanged();
+    m_textElementProperties.SetTextColor(value);
 }
 
 bool TextRun::GetIsSubtle() const
 {
-    return m_textElementProperties->GetIsSubtle();
+    return m_textElementProperties.GetIsSubtle();
 }
 
 void TextRun::SetIsSubtle(const bool value)
 {
-    m_textElementProperties->SetIsSubtle(value);
+    MarkChanged();
+    m_textElementProperties.SetIsSubtle(value);
 }
 
 std::string TextRun::GetLanguage() const
 {
-    return m_textElementProperties->GetLanguage();
+    return m_textElementProperties.GetLanguage();
+}
+
+const std::string& TextRun::GetLanguageRef() const
+{
+    return m_textElementProperties.GetLanguageRef();
 }
 
 void TextRun::SetLanguage(const std::string& value)
 {
-    m_textElementProperties->SetLanguage(value);
+    MarkChanged();
+    m_textElementProperties.SetLanguage(value);
 }
 
 std::shared_ptr<BaseActionElement> TextRun::GetSelectAction() const
@@ -111,6 +128,7 @@ std::shared_ptr<BaseActionElement> TextRun::GetSelectAction() const
 
 void TextRun::SetSelectAction(const std::shared_ptr<BaseActionElement> action)
 {
+    MarkChanged();
     m_selectAction = action;
 }
 
@@ -119,11 +137,26 @@ std::shared_ptr<Inline> TextRun::Deserialize(ParseContext& context, const Json::
     std::shared_ptr<TextRun> inlineTextRun = std::make_shared<TextRun>();
 
     ParseUtil::ExpectTypeString(json, InlineElementTypeToString(InlineElementType::TextRun));
-    inlineTextRun->m_textElementProperties->Deserialize(context, json);
+    inlineTextRun->m_textElementProperties.Deserialize(context, json);
 
     inlineTextRun->SetSelectAction(ParseUtil::GetAction(context, json, AdaptiveCardSchemaKey::SelectAction, false));
 
-    HandleUnknownProperties(json, inlineTextRun->m_knownProperties, inlineTextRun->m_additionalProperties);
+    static const std::unordered_set<std::string> knownProperties = []() {
+        TextRun prototype;
+        prototype.PopulateKnownPropertiesSet();
+        return std::move(prototype.m_knownProperties.Get());
+    }();
+    HandleUnknownProperties(json, knownProperties, inlineTextRun->m_additionalProperties);
 
     return inlineTextRun;
 }
+
+std::shared_ptr<Inline> TextRun::Clone() const
+{
+    auto clone = std::make_shared<TextRun>(*this);
+    if (m_selectAction != nullptr)
+    {
+        clone->m_selectAction = std::static_pointer_cast<BaseActionElement>(m_selectAction->Clone());
+    }
+    return clone;
+}
@@ -18,10 +18,12 @@ namespace AdaptiveSharedNamespace
         ~TextRun() = default;
 
         virtual Json::Value SerializeToJsonValue() const;
+        std::shared_ptr<Inline> Clone() const override;
 
         static std::shared_ptr<Inline> Deserialize(ParseContext& context, const Json::Value& root);
 
         std::string GetText() const;
+        const std::string& GetTextRef() const;
         void SetText(const std::string& value);
         DateTimePreparser GetTextForDateParsing() const;
 
@@ -42,12 +44,13 @@ namespace AdaptiveSharedNamespace
 
         void SetLanguage(const std::string& value);
         std::string GetLanguage() const;
+        const std::string& GetLanguageRef() const;
 
         std::shared_ptr<BaseActionElement> GetSelectAction() const;
         void SetSelectAction(const std::shared_ptr<BaseActionElement> action);
 
     protected:
-        std::shared_ptr<TextElementProperties> m_textElementProperties;
+        TextElementProperties m_textElementProperties;
         virtual void PopulateKnownPropertiesSet() override;
         std::shared_ptr<BaseActionElement> m_selectAction;
     };
@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 TimeInput::TimeInput() : BaseInputElement(CardElementType::TimeInput)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value TimeInput::SerializeToJsonValue() const
@@ -41,8 +40,14 @@ std::string TimeInput::GetMax() const
     return m_max;
 }
 
+const std::string& TimeInput::GetMaxRef() const
+{
+    return m_max;
+}
+
 void TimeInput::SetMax(const std::string& value)
 {
+    MarkChanged();
     m_max = value;
 }
 
@@ -51,8 +56,14 @@ std::string TimeInput::GetMin() const
     return m_min;
 }
 
+const std::string& TimeInput::GetMinRef() const
+{
+    return m_min;
+}
+
 void TimeInput::SetMin(const std::string& value)
 {
+    MarkChanged();
     m_min = value;
 }
 
@@ -61,8 +72,14 @@ std::string TimeInput::GetPlaceholder() const
     return m_placeholder;
 }
 
+const std::string& TimeInput::GetPlaceholderRef() const
+{
+    return m_placeholder;
+}
+
 void TimeInput::SetPlaceholder(const std::string& value)
 {
+    MarkChanged();
     m_placeholder = value;
 }
 
@@ -71,8 +88,14 @@ std::string TimeInput::GetValue() const
     return m_value;
 }
 
+const std::string& TimeInput::GetValueRef() const
+{
+    return m_value;
+}
+
 void TimeInput::SetValue(const std::string& value)
 {
+    MarkChanged();
     m_value = value;
 }
 
@@ -97,8 +120,15 @@ std::shared_ptr<BaseCardElement> TimeInputParser::DeserializeFromString(ParseCon
 
 void TimeInput::PopulateKnownPropertiesSet()
 {
+    BaseInputElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Max),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Min),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Placeholder),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value)});
 }
+
+std::shared_ptr<BaseElement> TimeInput::Clone() const
+{
+    return MakeClone(*this);
+}
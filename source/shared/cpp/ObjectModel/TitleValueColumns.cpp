@@ -0,0 +1,98 @@
+#include "pch.h"
+#include "TitleValueColumns.h"
+#include "AdaptiveCardParseException.h"
+
+namespace AdaptiveSharedNamespace
+{
+    void TitleValueColumns::Reserve(std::size_t pairs) { m_offsets.reserve(2 * pairs); }
+
+    void TitleValueColumns::Append(const std::string& title, const std::string& value)
+    {
+        AppendString(title);
+        AppendString(value);
+    }
+
+    void TitleValueColumns::Clear()
+    {
+        // swap rather than clear() so that the memory is released as well
+        std::string().swap(m_arena);
+        std::vector<std::uint32_t>().swap(m_offsets);
+    }
+
+    void TitleValueColumns::Replace(std::size_t index, const std::string& title, const std::string& value)
+    {
+        Splice(index, 1, &title, &value);
+    }
+
+    void TitleValueColumns::Insert(std::size_t index, const std::string& title, const std::string& value)
+    {
+        Splice(index, 0, &title, &value);
+    }
+
+    void TitleValueColumns::Erase(std::size_t index) { Splice(index, 1, nullptr, nullptr); }
+
+    TitleValueView TitleValueColumns::operator[](std::size_t index) const
+    {
+        const std::size_t titleStart = m_offsets[2 * index];
+        const std::size_t valueStart = m_offsets[2 * index + 1];
+        return TitleValueView(m_arena.data() + titleStart,
+                              EndOf(2 * index) - titleStart,
+                              m_arena.data() + valueStart,
+                              EndOf(2 * index + 1) - valueStart);
+    }
+
+    void TitleValueColumns::AppendString(const std::string& value)
+    {
+        if (m_arena.size() + value.size() + 1 > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Collection is too large");
+        }
+
+        m_offsets.push_back(static_cast<std::uint32_t>(m_arena.size()));
+        m_arena.append(value);
+        m_arena.push_back('\0');
+    }
+
+    void TitleValueColumns::Splice(std::size_t index, std::size_t removeCount, const std::string* title, const std::string* value)
+    {
+        const std::size_t start = (index < Size()) ? m_offsets[2 * index] : m_arena.size();
+        const std::size_t end = (index + removeCount < Size()) ? m_offsets[2 * (index + removeCount)] : m_arena.size();
+
+        std::string inserted;
+        if (title != nullptr)
+        {
+            inserted.reserve(title->size() + value->size() + 2);
+            inserted.append(*title).push_back('\0');
+            inserted.append(*value).push_back('\0');
+        }
+        if (m_arena.size() - (end - start) + inserted.size() > std::numeric_limits<std::uint32_t>::max())
+        {
+            throw AdaptiveCardParseException(ErrorStatusCode::InvalidPropertyValue, "Collection is too large");
+        }
+        m_arena.replace(start, end - start, inserted);
+
+        const auto first = m_offsets.begin() + 2 * index;
+        const auto next = m_offsets.erase(first, first + 2 * removeCount);
+        std::size_t shifted = next - m_offsets.begin();
+        if (title != nullptr)
+        {
+            const std::uint32_t offsets[] = {static_cast<std::uint32_t>(start), static_cast<std::uint32_t>(start + title->size() + 1)};
+            m_offsets.insert(next, std::begin(offsets), std::end(offsets));
+            shifted += 2;
+        }
+
+        // the strings after the spliced ones moved by the difference in length (modulo 2^32, which undoes itself)
+        const std::uint32_t delta = static_cast<std::uint32_t>(inserted.size()) - static_cast<std::uint32_t>(end - start);
+        for (std::size_t i = shifted; i < m_offsets.size(); ++i)
+        {
+            m_offsets[i] += delta;
+        }
+    }
+
+    std::size_t TitleValueColumns::EndOf(std::size_t stringIndex) const
+    {
+        // each string is followed by its terminator and then the next string
+        const std::size_t nextStart = (stringIndex + 1 < m_offsets.size()) ? m_offsets[stringIndex + 1] : m_arena.size();
+        return nextStart - 1;
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "pch.h"
+
+namespace AdaptiveSharedNamespace
+{
+    // A read-only view of one title/value pair of a FactSet or ChoiceSetInput. Both strings are null-terminated. A view
+    // is valid until the collection it was taken from is next modified.
+    class TitleValueView
+    {
+    public:
+        TitleValueView(const char* title, std::size_t titleLength, const char* value, std::size_t valueLength) :
+            m_title(title), m_value(value), m_titleLength(titleLength), m_valueLength(valueLength)
+        {
+        }
+
+        TitleValueView(const std::string& title, const std::string& value) :
+            TitleValueView(title.c_str(), title.size(), value.c_str(), value.size())
+        {
+        }
+
+        const char* GetTitleData() const { return m_title; }
+        std::size_t GetTitleLength() const { return m_titleLength; }
+        std::string GetTitle() const { return std::string(m_title, m_titleLength); }
+
+        const char* GetValueData() const { return m_value; }
+        std::size_t GetValueLength() const { return m_valueLength; }
+        std::string GetValue() const { return std::string(m_value, m_valueLength); }
+
+    private:
+        const char* m_title;
+        const char* m_value;
+        std::size_t m_titleLength;
+        std::size_t m_valueLength;
+    };
+
+    // Columnar storage for a list of title/value pairs. Every string is kept, null-terminated, in one contiguous arena
+    // and located by its offset, so n pairs take two allocations rather than a Fact or ChoiceInput object and two
+    // strings each.
+    class TitleValueColumns
+    {
+    public:
+        void Reserve(std::size_t pairs);
+        void Append(const std::string& title, const std::string& value);
+        void Clear();
+
+        // Edit one pair in place, shifting the strings after it; index must be in range (up to Size() for Insert)
+        void Replace(std::size_t index, const std::string& title, const std::string& value);
+        void Insert(std::size_t index, const std::string& title, const std::string& value);
+        void Erase(std::size_t index);
+
+        std::size_t Size() const { return m_offsets.size() / 2; }
+        bool IsEmpty() const { return m_offsets.empty(); }
+
+        TitleValueView operator[](std::size_t index) const;
+
+    private:
+        void AppendString(const std::string& value);
+        // Replaces removeCount pairs at index with the given pair, or with nothing if title is null
+        void Splice(std::size_t index, std::size_t removeCount, const std::string* title, const std::string* value);
+        std::size_t EndOf(std::size_t stringIndex) const;
+
+        std::string m_arena;
+        // start of each string in m_arena, title then value
+        std::vector<std::uint32_t> m_offsets;
+    };
+}
@@ -7,7 +7,6 @@ using namespace AdaptiveSharedNamespace;
 ToggleInput::ToggleInput() :
     BaseInputElement(CardElementType::ToggleInput), m_valueOff("false"), m_valueOn("true"), m_wrap(false)
 {
-    PopulateKnownPropertiesSet();
 }
 
 Json::Value ToggleInput::SerializeToJsonValue() const
@@ -44,8 +43,14 @@ std::string ToggleInput::GetTitle() const
     return m_title;
 }
 
+const std::string& ToggleInput::GetTitleRef() const
+{
+    return m_title;
+}
+
 void ToggleInput::SetTitle(const std::string& value)
 {
+    MarkChanged();
     m_title = value;
 }
 
@@ -54,12 +59,19 @@ std::string ToggleInput::GetValue() const
     return m_value;
 }
 
+const std::string& ToggleInput::GetValueRef() const
+{
+    return m_value;
+}
+
 void ToggleInput::SetValue(const std::string& value)
 {
+    MarkChanged();
     m_value = value;
 }
 void ToggleInput::SetValueOff(const std::string& valueOff)
 {
+    MarkChanged();
     m_valueOff = valueOff;
 }
 
@@ -68,13 +80,24 @@ std::string ToggleInput::GetValueOff() const
     return m_valueOff;
 }
 
+const std::string& ToggleInput::GetValueOffRef() const
+{
+    return m_valueOff;
+}
+
 std::string ToggleInput::GetValueOn() const
 {
     return m_valueOn;
 }
 
+const std::string& ToggleInput::GetValueOnRef() const
+{
+    return m_valueOn;
+}
+
 void ToggleInput::SetValueOn(const std::string& valueOn)
 {
+    MarkChanged();
     m_valueOn = valueOn;
 }
 
@@ -85,6 +108,7 @@ bool ToggleInput::GetWrap() const
 
 void ToggleInput::SetWrap(bool value)
 {
+    MarkChanged();
     m_wrap = value;
 }
 
@@ -121,9 +145,16 @@ ToggleInputParser::DeserializeFromString(ParseContext& context, const std::strin
 
 void ToggleInput::PopulateKnownPropertiesSet()
 {
+    BaseInputElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Title),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Value),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOn),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::ValueOff),
                               AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::Wrap)});
 }
+
+std::shared_ptr<BaseElement> ToggleInput::Clone() const
+{
+    return MakeClone(*this);
+}
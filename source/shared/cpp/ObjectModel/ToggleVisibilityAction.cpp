@@ -6,7 +6,6 @@ using namespace AdaptiveSharedNamespace;
 
 ToggleVisibilityAction::ToggleVisibilityAction() : BaseActionElement(ActionType::ToggleVisibility)
 {
-    PopulateKnownPropertiesSet();
 }
 
 const std::vector<std::shared_ptr<ToggleVisibilityTarget>>& ToggleVisibilityAction::GetTargetElements() const
@@ -16,6 +15,7 @@ const std::vector<std::shared_ptr<ToggleVisibilityTarget>>& ToggleVisibilityActi
 
 std::vector<std::shared_ptr<ToggleVisibilityTarget>>& ToggleVisibilityAction::GetTargetElements()
 {
+    ThrowIfFrozen();
     return m_targetElements;
 }
 
@@ -32,6 +32,28 @@ Json::Value ToggleVisibilityAction::SerializeToJsonValue() const
     return root;
 }
 
+void ToggleVisibilityAction::VisitNested(NestedVisitor& visitor) const
+{
+    BaseActionElement::VisitNested(visitor);
+    for (const auto& target : m_targetElements)
+    {
+        visitor.Part(*target);
+    }
+}
+
+void ToggleVisibilityAction::Freeze()
+{
+    if (!IsFrozen())
+    {
+        // links the targets, whose setters then throw
+        for (const auto& target : m_targetElements)
+        {
+            m_partOwner.Link(*this, *target);
+        }
+    }
+    BaseActionElement::Freeze();
+}
+
 std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::Deserialize(ParseContext& context, const Json::Value& json)
 {
     std::shared_ptr<ToggleVisibilityAction> toggleVisibilityAction = BaseActionElement::Deserialize<ToggleVisibilityAction>(context, json);
@@ -50,5 +72,23 @@ std::shared_ptr<BaseActionElement> ToggleVisibilityActionParser::DeserializeFrom
 
 void ToggleVisibilityAction::PopulateKnownPropertiesSet()
 {
+    BaseActionElement::PopulateKnownPropertiesSet();
+
     m_knownProperties.insert({AdaptiveCardSchemaKeyToString(AdaptiveCardSchemaKey::TargetElements)});
 }
+
+std::shared_ptr<BaseElement> ToggleVisibilityAction::Clone() const
+{
+    return MakeClone(*this);
+}
+
+void ToggleVisibilityAction::DeepCopyMembers()
+{
+    BaseActionElement::DeepCopyMembers();
+    for (auto& target : m_targetElements)
+    {
+        // the copy's element handle refers to the original card until the clone is complete
+        target = std::make_shared<ToggleVisibilityTarget>(*target);
+        RecordClonedTarget(target);
+    }
+}
@@ -18,8 +18,12 @@ namespace AdaptiveSharedNamespace
         std::vector<std::shared_ptr<ToggleVisibilityTarget>>& GetTargetElements();
 
         Json::Value SerializeToJsonValue() const override;
+        void VisitNested(NestedVisitor& visitor) const override;
+        void Freeze() override;
+        std::shared_ptr<BaseElement> Clone() const override;
 
     private:
+        void DeepCopyMembers() override;
         void PopulateKnownPropertiesSet() override;
 
         std::vector<std::shared_ptr<ToggleVisibilityTarget>> m_targetElements;
@@ -13,9 +13,33 @@ std::string ToggleVisibilityTarget::GetElementId() const
     return m_targetId;
 }
 
+const std::string& ToggleVisibilityTarget::GetElementIdRef() const
+{
+    return m_targetId;
+}
+
 void ToggleVisibilityTarget::SetElementId(const std::string& value)
 {
+    MarkChanged();
     m_targetId = value;
+    m_element.reset();
+}
+
+void ToggleVisibilityTarget::SetElementId(std::string&& value)
+{
+    MarkChanged();
+    m_targetId = std::move(value);
+    m_element.reset();
+}
+
+std::shared_ptr<BaseCardElement> ToggleVisibilityTarget::GetElement() const
+{
+    return m_element.lock();
+}
+
+void ToggleVisibilityTarget::SetElement(const std::shared_ptr<BaseCardElement>& element)
+{
+    m_element = element;
 }
 
 IsVisible ToggleVisibilityTarget::GetIsVisible() const
@@ -25,10 +49,11 @@ IsVisible ToggleVisibilityTarget::GetIsVisible() const
 
 void ToggleVisibilityTarget::SetIsVisible(IsVisible value)
 {
+    MarkChanged();
     m_visibilityToggle = value;
 }
 
-std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(ParseContext&, const Json::Value& json)
+std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(ParseContext& context, const Json::Value& json)
 {
     auto toggleVisibilityTargetElement = std::make_shared<ToggleVisibilityTarget>();
 
@@ -55,6 +80,9 @@ std::shared_ptr<ToggleVisibilityTarget> ToggleVisibilityTarget::Deserialize(Pars
         }
     }
 
+    // the target's element may not have been parsed yet, so it's resolved when the whole card has been seen
+    context.AddToggleVisibilityTarget(toggleVisibilityTargetElement);
+
     return toggleVisibilityTargetElement;
 }
 
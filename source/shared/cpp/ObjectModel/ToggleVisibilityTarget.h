@@ -6,6 +6,8 @@
 
 namespace AdaptiveSharedNamespace
 {
+    class BaseCardElement;
+
     enum IsVisible
     {
         IsVisibleToggle,
@@ -13,13 +15,21 @@ namespace AdaptiveSharedNamespace
         IsVisibleFalse
     };
 
-    class ToggleVisibilityTarget
+    class ToggleVisibilityTarget : public ElementPart
     {
     public:
         ToggleVisibilityTarget();
 
         std::string GetElementId() const;
+        const std::string& GetElementIdRef() const;
         void SetElementId(const std::string& value);
+        void SetElementId(std::string&& value);
+
+        // The element this target refers to, resolved from the element id when the card was parsed. Returns null if the id
+        // didn't match an element, the element has since been released or the id was changed after parsing. A clone's
+        // targets refer to the copies of their elements, or to nothing if those weren't copied along with them.
+        std::shared_ptr<BaseCardElement> GetElement() const;
+        void SetElement(const std::shared_ptr<BaseCardElement>& element);
 
         IsVisible GetIsVisible() const;
         void SetIsVisible(IsVisible value);
@@ -32,6 +42,7 @@ namespace AdaptiveSharedNamespace
 
     private:
         std::string m_targetId;
+        std::weak_ptr<BaseCardElement> m_element;
         IsVisible m_visibilityToggle;
     };
 }
@@ -20,3 +20,8 @@ std::shared_ptr<BaseActionElement> UnknownActionParser::Deserialize(ParseContext
     unknown->SetElementTypeString(actualType);
     return unknown;
 }
+
+std::shared_ptr<BaseElement> UnknownAction::Clone() const
+{
+    return MakeClone(*this);
+}
@@ -12,6 +12,7 @@ namespace AdaptiveSharedNamespace
     public:
         UnknownAction();
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
     };
 
     class UnknownActionParser : public ActionElementParser
@@ -35,3 +35,8 @@ Json::Value UnknownElement::SerializeToJsonValue() const
 {
     return GetAdditionalProperties();
 }
+
+std::shared_ptr<BaseElement> UnknownElement::Clone() const
+{
+    return MakeClone(*this);
+}
@@ -10,6 +10,7 @@ namespace AdaptiveSharedNamespace
     public:
         UnknownElement();
         Json::Value SerializeToJsonValue() const override;
+        std::shared_ptr<BaseElement> Clone() const override;
     };
 
     class UnknownElementParser : public BaseCardElementParser
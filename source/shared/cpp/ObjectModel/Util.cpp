@@ -1,10 +1,10 @@
 #include "pch.h"
 
+#include "ArgbColor.h"
 #include "ColumnSet.h"
 #include "Container.h"
 #include "FactSet.h"
 #include "RichTextBlock.h"
-#include "ShowCardAction.h"
 #include "TextBlock.h"
 #include "Util.h"
 
@@ -17,12 +17,8 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
         return backgroundColor;
     }
 
-    const size_t backgroundColorLength = backgroundColor.length();
-    bool isValidColor = ((backgroundColor.at(0) == '#') && (backgroundColorLength == 7 || backgroundColorLength == 9));
-    for (size_t i = 1; i < backgroundColorLength && isValidColor; ++i)
-    {
-        isValidColor = isxdigit(backgroundColor.at(i));
-    }
+    ArgbColor parsedColor;
+    const bool isValidColor = ArgbColor::TryParse(backgroundColor, parsedColor);
 
     if (!isValidColor)
     {
@@ -33,7 +29,7 @@ std::string ValidateColor(const std::string& backgroundColor, std::vector<std::s
 
     std::string validBackgroundColor;
     // If format given was #RRGGBB
-    if (backgroundColorLength == 7)
+    if (backgroundColor.length() == 7)
     {
         validBackgroundColor = "#FF" + backgroundColor.substr(1, 6);
     }
@@ -130,21 +126,6 @@ int ParseSizeForPixelSize(const std::string& sizeString, std::vector<std::shared
     return parsedDimension;
 }
 
-void EnsureShowCardVersions(const std::vector<std::shared_ptr<BaseActionElement>>& actions, const std::string& version)
-{
-    for (auto& action : actions)
-    {
-        if (action->GetElementType() == ActionType::ShowCard)
-        {
-            auto showCardAction = std::static_pointer_cast<ShowCardAction>(action);
-            if (showCardAction->GetCard()->GetVersion().empty())
-            {
-                showCardAction->GetCard()->SetVersion(version);
-            }
-        }
-    }
-}
-
 void HandleUnknownProperties(const Json::Value& json, const std::unordered_set<std::string>& knownProperties, Json::Value& unknownProperties)
 {
     for (auto it = json.begin(); it != json.end(); ++it)
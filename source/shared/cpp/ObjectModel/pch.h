@@ -9,12 +9,18 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cstdint>
 #include <exception>
 #include <fstream>
 #include <functional>
+#include <iterator>
+#include <list>
 #include <locale>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <regex>
 #include <sstream>
@@ -30,9 +30,9 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        if (!sharedImage->GetUrl().empty())
+        if (!sharedImage->GetUrlRef().empty())
         {
-            RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetUrl(), m_url.GetAddressOf()));
+            RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetUrlRef(), m_url.GetAddressOf()));
         }
 
         m_mode = static_cast<ABI::AdaptiveNamespace::BackgroundImageMode>(sharedImage->GetMode());
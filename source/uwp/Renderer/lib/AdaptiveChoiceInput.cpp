@@ -27,7 +27,7 @@ namespace AdaptiveNamespace
 
     HRESULT AdaptiveChoiceInput::get_Title(_Outptr_ HSTRING* title)
     {
-        return UTF8ToHString(m_sharedChoiceInput->GetTitle(), title);
+        return UTF8ToHString(m_sharedChoiceInput->GetTitleRef(), title);
     }
 
     HRESULT AdaptiveChoiceInput::put_Title(_In_ HSTRING title)
@@ -40,7 +40,7 @@ namespace AdaptiveNamespace
 
     HRESULT AdaptiveChoiceInput::get_Value(_Outptr_ HSTRING* value)
     {
-        return UTF8ToHString(m_sharedChoiceInput->GetValue(), value);
+        return UTF8ToHString(m_sharedChoiceInput->GetValueRef(), value);
     }
 
     HRESULT AdaptiveChoiceInput::put_Value(_In_ HSTRING value)
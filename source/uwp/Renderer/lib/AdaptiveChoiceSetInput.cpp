@@ -34,12 +34,12 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        GenerateInputChoicesProjection(sharedChoiceSetInput->GetChoices(), m_choices.Get());
+        GenerateInputChoicesProjection(*sharedChoiceSetInput, m_choices.Get());
 
         m_isMultiSelect = sharedChoiceSetInput->GetIsMultiSelect();
         m_wrap = sharedChoiceSetInput->GetWrap();
         m_choiceSetStyle = static_cast<ABI::AdaptiveNamespace::ChoiceSetStyle>(sharedChoiceSetInput->GetChoiceSetStyle());
-        RETURN_IF_FAILED(UTF8ToHString(sharedChoiceSetInput->GetValue(), m_value.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedChoiceSetInput->GetValueRef(), m_value.GetAddressOf()));
 
         InitializeBaseElement(std::static_pointer_cast<BaseInputElement>(sharedChoiceSetInput));
         return S_OK;
@@ -32,7 +32,7 @@ namespace AdaptiveNamespace
         m_verticalAlignment =
             static_cast<ABI::AdaptiveNamespace::VerticalContentAlignment>(sharedColumn->GetVerticalContentAlignment());
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedColumn->GetWidth(), m_width.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedColumn->GetWidthRef(), m_width.GetAddressOf()));
         m_pixelWidth = sharedColumn->GetPixelWidth();
 
         auto backgroundImage = sharedColumn->GetBackgroundImage();
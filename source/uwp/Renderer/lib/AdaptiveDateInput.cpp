@@ -26,10 +26,10 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetMax(), m_max.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetMin(), m_min.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetPlaceholder(), m_placeholder.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetValue(), m_value.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetMaxRef(), m_max.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetMinRef(), m_min.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetPlaceholderRef(), m_placeholder.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedDateInput->GetValueRef(), m_value.GetAddressOf()));
 
         InitializeBaseElement(std::static_pointer_cast<BaseInputElement>(sharedDateInput));
         return S_OK;
@@ -22,8 +22,8 @@ namespace AdaptiveNamespace
     HRESULT AdaptiveFact::RuntimeClassInitialize(const std::shared_ptr<AdaptiveSharedNamespace::Fact>& sharedFact)
     {
         RETURN_IF_FAILED(UTF8ToHString(sharedFact->GetTitle(), m_title.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedFact->GetValue(), m_value.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedFact->GetLanguage(), m_language.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedFact->GetValueRef(), m_value.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedFact->GetLanguageRef(), m_language.GetAddressOf()));
         return S_OK;
     }
 
@@ -30,7 +30,7 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        GenerateFactsProjection(sharedFactSet->GetFacts(), m_facts.Get());
+        GenerateFactsProjection(*sharedFactSet, m_facts.Get());
 
         InitializeBaseElement(std::static_pointer_cast<BaseCardElement>(sharedFactSet));
         return S_OK;
@@ -28,16 +28,16 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetUrl(), m_url.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetUrlRef(), m_url.GetAddressOf()));
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetBackgroundColor(), m_backgroundColor.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetBackgroundColorRef(), m_backgroundColor.GetAddressOf()));
 
         m_imageStyle = static_cast<ABI::AdaptiveNamespace::ImageStyle>(sharedImage->GetImageStyle());
         m_imageSize = static_cast<ABI::AdaptiveNamespace::ImageSize>(sharedImage->GetImageSize());
         m_pixelWidth = sharedImage->GetPixelWidth();
         m_pixelHeight = sharedImage->GetPixelHeight();
         m_horizontalAlignment = static_cast<ABI::AdaptiveNamespace::HAlignment>(sharedImage->GetHorizontalAlignment());
-        RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetAltText(), m_altText.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedImage->GetAltTextRef(), m_altText.GetAddressOf()));
         GenerateActionProjection(sharedImage->GetSelectAction(), &m_selectAction);
 
         InitializeBaseElement(std::static_pointer_cast<BaseCardElement>(sharedImage));
@@ -21,8 +21,8 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedMedia->GetPoster(), m_poster.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedMedia->GetAltText(), m_altText.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedMedia->GetPosterRef(), m_poster.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedMedia->GetAltTextRef(), m_altText.GetAddressOf()));
 
         m_sources = Microsoft::WRL::Make<Vector<AdaptiveMediaSource*>>();
         GenerateMediaSourcesProjection(sharedMedia->GetSources(), m_sources.Get());
@@ -18,8 +18,8 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedMediaSource->GetMimeType(), m_mimeType.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedMediaSource->GetUrl(), m_url.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedMediaSource->GetMimeTypeRef(), m_mimeType.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedMediaSource->GetUrlRef(), m_url.GetAddressOf()));
 
         return S_OK;
     }
@@ -26,7 +26,7 @@ namespace AdaptiveNamespace
 
         ComPtr<IUriRuntimeClassFactory> uriActivationFactory;
         RETURN_IF_FAILED(GetActivationFactory(HStringReference(RuntimeClass_Windows_Foundation_Uri).Get(), &uriActivationFactory));
-        std::wstring imageUri = StringToWstring(sharedOpenUrlAction->GetUrl());
+        std::wstring imageUri = StringToWstring(sharedOpenUrlAction->GetUrlRef());
 
         if (!imageUri.empty())
         {
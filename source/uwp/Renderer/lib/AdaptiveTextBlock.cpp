@@ -37,8 +37,8 @@ namespace AdaptiveNamespace
         m_foregroundColor = static_cast<ABI::AdaptiveNamespace::ForegroundColor>(sharedTextBlock->GetTextColor());
         m_horizontalAlignment = static_cast<ABI::AdaptiveNamespace::HAlignment>(sharedTextBlock->GetHorizontalAlignment());
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedTextBlock->GetText(), m_text.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedTextBlock->GetLanguage(), m_language.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedTextBlock->GetTextRef(), m_text.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedTextBlock->GetLanguageRef(), m_language.GetAddressOf()));
 
         InitializeBaseElement(std::static_pointer_cast<BaseCardElement>(sharedTextBlock));
         return S_OK;
@@ -27,10 +27,10 @@ namespace AdaptiveNamespace
             return E_INVALIDARG;
         }
 
-        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetMax(), m_max.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetMin(), m_min.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetPlaceholder(), m_placeholder.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetValue(), m_value.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetMaxRef(), m_max.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetMinRef(), m_min.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetPlaceholderRef(), m_placeholder.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedTimeInput->GetValueRef(), m_value.GetAddressOf()));
 
         InitializeBaseElement(std::static_pointer_cast<BaseInputElement>(sharedTimeInput));
 
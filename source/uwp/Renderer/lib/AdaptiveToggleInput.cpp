@@ -29,9 +29,9 @@ namespace AdaptiveNamespace
         }
 
         RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetTitle(), m_title.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetValue(), m_value.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetValueOn(), m_valueOn.GetAddressOf()));
-        RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetValueOff(), m_valueOff.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetValueRef(), m_value.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetValueOnRef(), m_valueOn.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedToggleInput->GetValueOffRef(), m_valueOff.GetAddressOf()));
         m_wrap = sharedToggleInput->GetWrap();
 
         InitializeBaseElement(std::static_pointer_cast<BaseInputElement>(sharedToggleInput));
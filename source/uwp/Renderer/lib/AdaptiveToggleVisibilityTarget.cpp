@@ -22,7 +22,7 @@ namespace AdaptiveNamespace
 
     HRESULT AdaptiveToggleVisibilityTarget::RuntimeClassInitialize(const std::shared_ptr<AdaptiveSharedNamespace::ToggleVisibilityTarget>& sharedToggleTarget)
     {
-        RETURN_IF_FAILED(UTF8ToHString(sharedToggleTarget->GetElementId(), m_elementId.GetAddressOf()));
+        RETURN_IF_FAILED(UTF8ToHString(sharedToggleTarget->GetElementIdRef(), m_elementId.GetAddressOf()));
         m_visibilityToggle = (ABI::AdaptiveNamespace::IsVisible)sharedToggleTarget->GetIsVisible();
         return S_OK;
     }
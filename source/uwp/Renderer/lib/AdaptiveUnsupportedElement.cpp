@@ -30,7 +30,7 @@ namespace AdaptiveNamespace
         }
 
         InitializeBaseElement(std::static_pointer_cast<BaseCardElement>(sharedUnknown));
-        m_actualType = sharedUnknown->GetElementTypeString();
+        m_actualType = sharedUnknown->GetElementTypeStringRef();
         return S_OK;
     }
     CATCH_RETURN;
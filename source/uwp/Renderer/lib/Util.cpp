@@ -578,14 +578,18 @@ HRESULT GenerateColumnsProjection(const std::vector<std::shared_ptr<AdaptiveShar
 }
 CATCH_RETURN;
 
-HRESULT GenerateFactsProjection(const std::vector<std::shared_ptr<AdaptiveSharedNamespace::Fact>>& containedElements,
+HRESULT GenerateFactsProjection(const AdaptiveSharedNamespace::FactSet& factSet,
                                 _In_ ABI::Windows::Foundation::Collections::IVector<ABI::AdaptiveNamespace::AdaptiveFact*>* projectedParentContainer) noexcept try
 {
-    for (auto& containedElement : containedElements)
+    // reads the facts through their views, which leaves columnar facts as they are
+    for (std::size_t i = 0; i < factSet.GetFactCount(); ++i)
     {
+        const auto view = factSet.GetFactView(i);
+        auto fact = std::make_shared<AdaptiveSharedNamespace::Fact>(view.GetTitle(), view.GetValue());
+        fact->SetLanguage(factSet.GetFactLanguageRef(i));
+
         ComPtr<ABI::AdaptiveNamespace::IAdaptiveFact> projectedContainedElement;
-        RETURN_IF_FAILED(MakeAndInitialize<::AdaptiveNamespace::AdaptiveFact>(
-            &projectedContainedElement, std::static_pointer_cast<AdaptiveSharedNamespace::Fact>(containedElement)));
+        RETURN_IF_FAILED(MakeAndInitialize<::AdaptiveNamespace::AdaptiveFact>(&projectedContainedElement, fact));
 
         RETURN_IF_FAILED(projectedParentContainer->Append(projectedContainedElement.Detach()));
     }
@@ -609,14 +613,19 @@ HRESULT GenerateImagesProjection(const std::vector<std::shared_ptr<AdaptiveShare
 CATCH_RETURN;
 
 HRESULT GenerateInputChoicesProjection(
-    const std::vector<std::shared_ptr<AdaptiveSharedNamespace::ChoiceInput>>& containedElements,
+    const AdaptiveSharedNamespace::ChoiceSetInput& choiceSet,
     _In_ ABI::Windows::Foundation::Collections::IVector<ABI::AdaptiveNamespace::AdaptiveChoiceInput*>* projectedParentContainer) noexcept try
 {
-    for (auto& containedElement : containedElements)
+    // the projected choices are the projection's own to edit, so they are copies made from the choices' views
+    for (std::size_t i = 0; i < choiceSet.GetChoiceCount(); ++i)
     {
+        const auto view = choiceSet.GetChoiceView(i);
+        auto choice = std::make_shared<AdaptiveSharedNamespace::ChoiceInput>();
+        choice->SetTitle(view.GetTitle());
+        choice->SetValue(view.GetValue());
+
         ComPtr<ABI::AdaptiveNamespace::IAdaptiveChoiceInput> projectedContainedElement;
-        RETURN_IF_FAILED(MakeAndInitialize<::AdaptiveNamespace::AdaptiveChoiceInput>(
-            &projectedContainedElement, std::static_pointer_cast<AdaptiveSharedNamespace::ChoiceInput>(containedElement)));
+        RETURN_IF_FAILED(MakeAndInitialize<::AdaptiveNamespace::AdaptiveChoiceInput>(&projectedContainedElement, choice));
 
         RETURN_IF_FAILED(projectedParentContainer->Append(projectedContainedElement.Detach()));
     }